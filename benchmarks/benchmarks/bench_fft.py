@@ -0,0 +1,52 @@
+from __future__ import absolute_import, division, print_function
+
+from .common import Benchmark
+
+import numpy as np
+
+
+class FFT(Benchmark):
+    params = [[np.fft.fft, np.fft.ifft, np.fft.rfft, np.fft.irfft],
+              [16, 100, 1024, 4096],
+              [None, 'single']]
+    param_names = ['func', 'size', 'precision']
+
+    def setup(self, func, size, precision):
+        x = np.random.rand(20000 // size + 1, size)
+        if func in (np.fft.fft, np.fft.ifft, np.fft.irfft):
+            x = x + 1j*x
+        self.x = x
+        self.xt = np.ascontiguousarray(x.T)
+        self.func = func
+
+    def time_rows(self, func, size, precision):
+        self.func(self.x, precision=precision)
+
+    def time_columns(self, func, size, precision):
+        self.func(self.xt, axis=0, precision=precision)
+
+
+class FFTLength(Benchmark):
+    params = [[1024, 1000, 1009, 2**16, 1000003]]
+    param_names = ['size']
+
+    def setup(self, size):
+        self.x = np.random.rand(size) + 1j*np.random.rand(size)
+
+    def time_fft(self, size):
+        np.fft.fft(self.x)
+
+    def time_rfft(self, size):
+        np.fft.rfft(self.x.real)
+
+
+class FFTn(Benchmark):
+    def setup(self):
+        self.a = np.random.rand(256, 256) + 1j*np.random.rand(256, 256)
+        self.b = np.random.rand(64, 64, 64)
+
+    def time_fft2(self):
+        np.fft.fft2(self.a)
+
+    def time_rfftn(self):
+        np.fft.rfftn(self.b)
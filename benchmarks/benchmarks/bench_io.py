@@ -62,3 +62,27 @@ class Savez(Benchmark):
 
     def time_vb_savez_squares(self):
         np.savez('tmp.npz', self.squares)
+
+
+class FromText(Benchmark):
+    params = ['repr', 'short', 'int']
+    param_names = ['values']
+
+    def setup(self, values):
+        rnd = np.random.RandomState(0)
+        if values == 'int':
+            x = rnd.randint(-10**9, 10**9, 10**5)
+            self.dtype = np.int64
+        else:
+            x = rnd.standard_normal(10**5) * 10.0**rnd.randint(-5, 5, 10**5)
+            self.dtype = np.float64
+        fmt = {'repr': repr, 'short': '%.4f'.__mod__, 'int': str}[values]
+        self.text = ' '.join(fmt(v) for v in x.tolist()).encode('ascii')
+        with open('tmp.txt', 'wb') as f:
+            f.write(self.text)
+
+    def time_fromstring(self, values):
+        np.fromstring(self.text, dtype=self.dtype, sep=' ')
+
+    def time_fromfile(self, values):
+        np.fromfile('tmp.txt', dtype=self.dtype, sep=' ')
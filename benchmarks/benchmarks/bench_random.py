@@ -21,6 +21,67 @@ class Random(Benchmark):
         self.func(*self.params)
 
 
+class Sampler(Benchmark):
+    params = [['standard_normal', 'standard_exponential',
+               'standard_gamma 2.5'],
+              ['legacy', 'ziggurat']]
+    param_names = ['distribution', 'sampler']
+
+    def setup(self, name, sampler):
+        items = name.split()
+        name = items.pop(0)
+        params = [float(x) for x in items]
+
+        rs = np.random.RandomState(1234, sampler=sampler)
+        self.func = getattr(rs, name)
+        self.params = tuple(params) + ((1000, 1000),)
+
+    def time_rng(self, name, sampler):
+        self.func(*self.params)
+
+
+class SinglePrecision(Benchmark):
+    params = [['random_sample', 'standard_normal', 'standard_exponential',
+               'standard_gamma 2.5'],
+              ['float64', 'float32']]
+    param_names = ['distribution', 'dtype']
+
+    def setup(self, name, dtype):
+        items = name.split()
+        name = items.pop(0)
+        params = [float(x) for x in items]
+
+        rs = np.random.RandomState(1234)
+        self.func = getattr(rs, name)
+        self.params = tuple(params) + ((1000, 1000),)
+        self.dtype = np.dtype(dtype)
+
+    def time_rng(self, name, dtype):
+        self.func(*self.params, dtype=self.dtype)
+
+
+class ArrayParams(Benchmark):
+    params = [['normal', 'exponential', 'uniform', 'gamma'],
+              ['scalar', 'contiguous', 'broadcast']]
+    param_names = ['distribution', 'params']
+
+    def setup(self, name, params):
+        self.func = getattr(np.random.RandomState(1234), name)
+        self.kwargs = {}
+        if params == 'scalar':
+            first = 1.0
+            self.kwargs['size'] = (1000, 1000)
+        elif params == 'contiguous':
+            first = np.ones((1000, 1000))
+        else:
+            first = np.ones((1000, 1))
+            self.kwargs['size'] = (1000, 1000)
+        self.args = (first,) if name == 'exponential' else (first, 1.0)
+
+    def time_rng(self, name, params):
+        self.func(*self.args, **self.kwargs)
+
+
 class Shuffle(Benchmark):
     def setup(self):
         self.a = np.arange(100000)
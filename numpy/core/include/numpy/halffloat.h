@@ -17,6 +17,13 @@ float npy_half_to_float(npy_half h);
 double npy_half_to_double(npy_half h);
 npy_half npy_float_to_half(float f);
 npy_half npy_double_to_half(double d);
+/*
+ * Conversions of contiguous buffers, these use the F16C or AVX512F
+ * instructions when the cpu supports them and give the same results
+ * as the element-wise conversions.
+ */
+void npy_half_to_float_contig(float *dst, const npy_half *src, npy_intp n);
+void npy_float_to_half_contig(npy_half *dst, const float *src, npy_intp n);
 /* Comparisons */
 int npy_half_eq(npy_half h1, npy_half h2);
 int npy_half_ne(npy_half h1, npy_half h2);
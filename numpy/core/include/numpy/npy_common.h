@@ -28,6 +28,34 @@
 #define NPY_GCC_OPT_3
 #endif
 
+/*
+ * compile a function for a specific instruction set extension, the caller
+ * must check at runtime that the cpu supports it before calling
+ */
+#ifdef HAVE_ATTRIBUTE_TARGET_F16C
+#define NPY_GCC_TARGET_F16C __attribute__((target("f16c")))
+#else
+#define NPY_GCC_TARGET_F16C
+#endif
+
+#ifdef HAVE_ATTRIBUTE_TARGET_AVX512F
+#define NPY_GCC_TARGET_AVX512F __attribute__((target("avx512f")))
+#else
+#define NPY_GCC_TARGET_AVX512F
+#endif
+
+#ifdef HAVE_ATTRIBUTE_TARGET_SSSE3
+#define NPY_GCC_TARGET_SSSE3 __attribute__((target("ssse3")))
+#else
+#define NPY_GCC_TARGET_SSSE3
+#endif
+
+#ifdef HAVE_ATTRIBUTE_TARGET_AVX2
+#define NPY_GCC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define NPY_GCC_TARGET_AVX2
+#endif
+
 /*
  * mark an argument (starting from 1) that must not be NULL and is not checked
  * DO NOT USE IF FUNCTION CHECKS FOR NULL!! the compiler will remove the check
@@ -32,4 +32,15 @@ small_correlate(const char * d_, npy_intp dstride,
                 npy_intp nk, enum NPY_TYPES ktype,
                 char * out_, npy_intp ostride);
 
+/* for the text reader */
+NPY_NO_EXPORT int
+STRING_parse_longlong(const npy_uint8 *s, npy_intp len, npy_longlong *out);
+
+NPY_NO_EXPORT int
+STRING_parse_double(const npy_uint8 *s, npy_intp len, double *out);
+
+NPY_NO_EXPORT int
+npy_decimal_to_double(npy_uint64 mantissa, int exp10, int truncated,
+                      double *out);
+
 #endif
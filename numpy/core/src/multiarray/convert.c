@@ -18,6 +18,7 @@
 #include "lowlevel_strided_loops.h"
 #include "scalartypes.h"
 #include "array_assign.h"
+#include "textwriting.h"
 
 #include "convert.h"
 
@@ -107,6 +108,87 @@ PyArray_ToList(PyArrayObject *self)
     return recursive_tolist(self, PyArray_DATA(self), 0);
 }
 
+/* Bytes of text buffered by PyArray_ToFile between writes */
+#define NPY_TEXT_BLOCKSIZE (1 << 16)
+
+/*
+ * Appends the text of the element at dataptr, which is the repr of its
+ * Python object or that formatted by format. Returns 1 on success and -1
+ * on error.
+ */
+static int
+_element_text(npy_textbuf *buf, PyArrayObject *self, char *dataptr,
+              char *format, size_t n4)
+{
+    PyObject *obj, *strobj, *tupobj, *byteobj;
+    int ret;
+
+    obj = PyArray_DESCR(self)->f->getitem(dataptr, self);
+    if (obj == NULL) {
+        return -1;
+    }
+    if (n4 == 0) {
+        /*
+         * standard writing
+         */
+        strobj = PyObject_Repr(obj);
+        Py_DECREF(obj);
+        if (strobj == NULL) {
+            return -1;
+        }
+    }
+    else {
+        /*
+         * use format string
+         */
+        tupobj = PyTuple_New(1);
+        if (tupobj == NULL) {
+            Py_DECREF(obj);
+            return -1;
+        }
+        PyTuple_SET_ITEM(tupobj,0,obj);
+        obj = PyUString_FromString((const char *)format);
+        if (obj == NULL) {
+            Py_DECREF(tupobj);
+            return -1;
+        }
+        strobj = PyUString_Format(obj, tupobj);
+        Py_DECREF(obj);
+        Py_DECREF(tupobj);
+        if (strobj == NULL) {
+            return -1;
+        }
+    }
+#if defined(NPY_PY3K)
+    byteobj = PyUnicode_AsASCIIString(strobj);
+    Py_DECREF(strobj);
+    if (byteobj == NULL) {
+        return -1;
+    }
+#else
+    byteobj = strobj;
+#endif
+    ret = npy_textbuf_write(buf, PyBytes_AS_STRING(byteobj),
+                            PyBytes_GET_SIZE(byteobj));
+    Py_DECREF(byteobj);
+    if (ret < 0) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 1;
+}
+
+/* Writes out and empties buf, returns -1 on failure */
+static int
+_write_textbuf(npy_textbuf *buf, FILE *fp)
+{
+    size_t n = fwrite(buf->data, 1, buf->len, fp);
+    int ok = (n == (size_t)buf->len);
+
+    buf->len = 0;
+    return ok ? 0 : -1;
+}
+
 /* XXX: FIXME --- add ordering argument to
    Allow Fortran ordering on write
    This will need the addition of a Fortran-order iterator.
@@ -119,10 +201,9 @@ NPY_NO_EXPORT int
 PyArray_ToFile(PyArrayObject *self, FILE *fp, char *sep, char *format)
 {
     npy_intp size;
-    npy_intp n, n2;
+    npy_intp n;
     size_t n3, n4;
     PyArrayIterObject *it;
-    PyObject *obj, *strobj, *tupobj, *byteobj;
 
     n3 = (sep ? strlen((const char *)sep) : 0);
     if (n3 == 0) {
@@ -144,7 +225,7 @@ PyArray_ToFile(PyArrayObject *self, FILE *fp, char *sep, char *format)
             /* Workaround Win64 fwrite() bug. Ticket #1660 */
             {
                 npy_intp maxsize = 2147483648 / PyArray_DESCR(self)->elsize;
-                npy_intp chunksize;
+                npy_intp chunksize, n2;
 
                 n = 0;
                 while (size > 0) {
@@ -198,87 +279,95 @@ PyArray_ToFile(PyArrayObject *self, FILE *fp, char *sep, char *format)
     }
     else {
         /*
-         * text data
+         * text data, formatted without Python objects where that gives
+         * the same text and written in blocks
          */
+        npy_textformat tfmt = {NULL, NULL, 0, NULL, 0};
+        npy_textbuf buf = {NULL, 0, 0};
+        int type_num = PyArray_DESCR(self)->type_num;
+        int fast, ret = 0;
+        NPY_BEGIN_THREADS_DEF;
 
-        it = (PyArrayIterObject *)
-            PyArray_IterNew((PyObject *)self);
         n4 = (format ? strlen((const char *)format) : 0);
-        while (it->index < it->size) {
-            obj = PyArray_DESCR(self)->f->getitem(it->dataptr, self);
-            if (obj == NULL) {
-                Py_DECREF(it);
+        fast = PyArray_ISALIGNED(self) && PyArray_ISNOTSWAPPED(self);
+        if (fast && n4 > 0) {
+            ret = npy_textformat_parse(&tfmt, format, n4);
+            if (ret < 0) {
                 return -1;
             }
-            if (n4 == 0) {
-                /*
-                 * standard writing
-                 */
-                strobj = PyObject_Repr(obj);
-                Py_DECREF(obj);
-                if (strobj == NULL) {
-                    Py_DECREF(it);
-                    return -1;
+            fast = ret == 0 && tfmt.nconvs == 1 &&
+                   npy_textformat_usable(&tfmt, type_num);
+        }
+        else if (fast) {
+            fast = npy_textrepr_usable(type_num);
+        }
+
+        it = (PyArrayIterObject *)
+            PyArray_IterNew((PyObject *)self);
+        if (it == NULL) {
+            npy_textformat_clear(&tfmt);
+            return -1;
+        }
+        if (fast) {
+            NPY_BEGIN_THREADS;
+        }
+        while (it->index < it->size) {
+            ret = 0;
+            if (fast) {
+                if (n4 > 0) {
+                    ret = npy_textformat_write(&buf, &tfmt, type_num,
+                                               it->dataptr, 0);
                 }
-            }
-            else {
-                /*
-                 * use format string
-                 */
-                tupobj = PyTuple_New(1);
-                if (tupobj == NULL) {
-                    Py_DECREF(it);
-                    return -1;
+                else {
+                    ret = npy_textrepr_write(&buf, type_num, it->dataptr);
                 }
-                PyTuple_SET_ITEM(tupobj,0,obj);
-                obj = PyUString_FromString((const char *)format);
-                if (obj == NULL) {
-                    Py_DECREF(tupobj);
-                    Py_DECREF(it);
-                    return -1;
+            }
+            if (ret == 0) {
+                NPY_END_THREADS;
+                ret = _element_text(&buf, self, it->dataptr, format, n4);
+                if (ret < 0) {
+                    break;
                 }
-                strobj = PyUString_Format(obj, tupobj);
-                Py_DECREF(obj);
-                Py_DECREF(tupobj);
-                if (strobj == NULL) {
-                    Py_DECREF(it);
-                    return -1;
+                if (fast) {
+                    NPY_BEGIN_THREADS;
                 }
             }
-#if defined(NPY_PY3K)
-            byteobj = PyUnicode_AsASCIIString(strobj);
-#else
-            byteobj = strobj;
-#endif
-            NPY_BEGIN_ALLOW_THREADS;
-            n2 = PyBytes_GET_SIZE(byteobj);
-            n = fwrite(PyBytes_AS_STRING(byteobj), 1, n2, fp);
-            NPY_END_ALLOW_THREADS;
-#if defined(NPY_PY3K)
-            Py_DECREF(byteobj);
-#endif
-            if (n < n2) {
-                PyErr_Format(PyExc_IOError,
-                        "problem writing element %" NPY_INTP_FMT
-                        " to file", it->index);
-                Py_DECREF(strobj);
-                Py_DECREF(it);
-                return -1;
-            }
             /* write separator for all but last one */
-            if (it->index != it->size-1) {
-                if (fwrite(sep, 1, n3, fp) < n3) {
+            if (ret > 0 && it->index != it->size-1) {
+                ret = npy_textbuf_write(&buf, sep, n3) < 0 ? -1 : 1;
+            }
+            if (ret < 0) {
+                NPY_END_THREADS;
+                PyErr_NoMemory();
+                break;
+            }
+            if (buf.len >= NPY_TEXT_BLOCKSIZE ||
+                    it->index == it->size-1) {
+                if (fast) {
+                    ret = _write_textbuf(&buf, fp);
+                }
+                else {
+                    NPY_BEGIN_ALLOW_THREADS;
+                    ret = _write_textbuf(&buf, fp);
+                    NPY_END_ALLOW_THREADS;
+                }
+                if (ret < 0) {
+                    NPY_END_THREADS;
                     PyErr_Format(PyExc_IOError,
-                            "problem writing separator to file");
-                    Py_DECREF(strobj);
-                    Py_DECREF(it);
-                    return -1;
+                            "problem writing element %" NPY_INTP_FMT
+                            " to file", it->index);
+                    break;
                 }
             }
-            Py_DECREF(strobj);
             PyArray_ITER_NEXT(it);
         }
+        NPY_END_THREADS;
         Py_DECREF(it);
+        npy_textformat_clear(&tfmt);
+        npy_textbuf_clear(&buf);
+        if (ret < 0) {
+            return -1;
+        }
     }
     return 0;
 }
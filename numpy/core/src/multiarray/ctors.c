@@ -8,6 +8,7 @@
 #include "numpy/arrayscalars.h"
 
 #include "numpy/npy_math.h"
+#include "numpy/halffloat.h"
 
 #include "npy_config.h"
 
@@ -28,6 +29,8 @@
 #include "mapping.h" /* for array_item_asarray */
 #include "templ_common.h" /* for npy_mul_with_overflow_intp */
 #include "alloc.h"
+#include "arraytypes.h"
+#include "numpyos.h"
 #include <assert.h>
 
 /*
@@ -227,6 +230,582 @@ fromfile_skip_separator(FILE **fp, const char *sep, void *NPY_UNUSED(stream_data
     return result;
 }
 
+/*
+ * Native parsing of the elements of text for the common numeric types,
+ * which avoids the locale handling and copies of the strtod and scanf
+ * based parsers for plain decimal numbers. Anything else is handed to the
+ * parser of the type, so that results are the same either way.
+ */
+
+/* Whether text_parse_element handles the type */
+static int
+text_native_type(PyArray_Descr *dtype)
+{
+    if (!PyArray_ISNBO(dtype->byteorder)) {
+        return 0;
+    }
+    switch (dtype->type_num) {
+        case NPY_BOOL:
+        case NPY_BYTE:
+        case NPY_UBYTE:
+        case NPY_SHORT:
+        case NPY_USHORT:
+        case NPY_INT:
+        case NPY_UINT:
+        case NPY_LONG:
+        case NPY_ULONG:
+        case NPY_LONGLONG:
+        case NPY_ULONGLONG:
+        case NPY_HALF:
+        case NPY_FLOAT:
+        case NPY_DOUBLE:
+            return 1;
+    }
+    return 0;
+}
+
+/*
+ * Parses an integer with the semantics of the scanf formats used by the
+ * scanfunc of the type.
+ */
+static int
+text_scan_integer(char *s, void *dptr, PyArray_Descr *dtype, char **end)
+{
+    int n = -1;
+
+    switch (dtype->type_num) {
+#define TEXT_SCAN_CASE(NUM, type, ctype, fmt) \
+        case NUM: { \
+            ctype tmp; \
+            if (sscanf(s, "%" fmt "%n", &tmp, &n) < 1 || n < 0) { \
+                break; \
+            } \
+            *(type *)dptr = (type)tmp; \
+            *end = s + n; \
+            return 0; \
+        }
+        TEXT_SCAN_CASE(NPY_BYTE, npy_byte, npy_int, "d")
+        TEXT_SCAN_CASE(NPY_UBYTE, npy_ubyte, npy_uint, "u")
+        TEXT_SCAN_CASE(NPY_SHORT, npy_short, npy_short, "hd")
+        TEXT_SCAN_CASE(NPY_USHORT, npy_ushort, npy_ushort, "hu")
+        TEXT_SCAN_CASE(NPY_INT, npy_int, npy_int, "d")
+        TEXT_SCAN_CASE(NPY_UINT, npy_uint, npy_uint, "u")
+        TEXT_SCAN_CASE(NPY_LONG, npy_long, npy_long, "ld")
+        TEXT_SCAN_CASE(NPY_ULONG, npy_ulong, npy_ulong, "lu")
+        TEXT_SCAN_CASE(NPY_LONGLONG, npy_longlong, npy_longlong,
+                       NPY_LONGLONG_FMT)
+        TEXT_SCAN_CASE(NPY_ULONGLONG, npy_ulonglong, npy_ulonglong,
+                       NPY_ULONGLONG_FMT)
+#undef TEXT_SCAN_CASE
+    }
+    *end = s;
+    return -1;
+}
+
+/*
+ * The significant digits of a decimal number as read by the parsers below,
+ * which stand for mantissa * 10**exp10. Only the first 19 digits are kept,
+ * and truncated tells whether any of the dropped ones is nonzero.
+ */
+typedef struct {
+    npy_uint64 mantissa;
+    int ndigits;
+    int exp10;
+    int truncated;
+} text_decimal;
+
+#define TEXT_IS_DIGIT(c) ((c) >= '0' && (c) <= '9')
+/* NumPyOS_ascii_isspace, which is the same as isspace in the C locale */
+#define TEXT_IS_SPACE(c) ((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+
+/* Adds a digit of the integer part, or of the fraction if `fraction` */
+static NPY_INLINE void
+text_add_digit(text_decimal *d, int digit, int fraction)
+{
+    if (d->mantissa == 0 && digit == 0) {
+        d->exp10 -= fraction;
+    }
+    else if (d->ndigits == 19) {
+        d->exp10 += !fraction;
+        d->truncated |= (digit != 0);
+    }
+    else {
+        d->mantissa = d->mantissa * 10 + digit;
+        d->ndigits++;
+        d->exp10 -= fraction;
+    }
+}
+
+/*
+ * Reads the exponent at p into d, up to limit unless it is NULL, returning
+ * the end of it. Huge exponents are capped, which still overflows or
+ * underflows the result.
+ */
+static NPY_INLINE char *
+text_add_exponent(text_decimal *d, char *p, const char *limit)
+{
+    int exponent = 0, negative = 0;
+
+    if ((limit == NULL || p < limit) && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    while ((limit == NULL || p < limit) && TEXT_IS_DIGIT(*p)) {
+        if (exponent < 10000) {
+            exponent = exponent * 10 + (*p - '0');
+        }
+        p++;
+    }
+    d->exp10 += negative ? -exponent : exponent;
+    return p;
+}
+
+/*
+ * Parses a float like NumPyOS_ascii_ftolf, used by the scanfunc of the
+ * floating point types, which consumes the longest text of at most 120
+ * characters that could start a number even if only a part of it is a
+ * number, e.g. "1.5e".
+ */
+static int
+text_scan_double(char *s, double *value, char **end)
+{
+    char buffer[121];
+    const char *word = NULL;
+    char *p, *limit, *q;
+    text_decimal d = {0, 0, 0, 0};
+    int negative = 0, valid;
+
+#define TEXT_MATCH(cond) (p < limit && (cond))
+    while (TEXT_IS_SPACE(*s)) {
+        s++;
+    }
+    p = s;
+    limit = s + sizeof(buffer) - 1;
+    if (TEXT_MATCH(*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (TEXT_MATCH(*p == 'n' || *p == 'N')) {
+        word = "an";
+    }
+    else if (TEXT_MATCH(*p == 'i' || *p == 'I')) {
+        word = "nfinity";
+    }
+    if (word != NULL) {
+        for (p++; *word != '\0' &&
+                  TEXT_MATCH(*p == *word || *p + ('a' - 'A') == *word);
+                  word++) {
+            p++;
+        }
+        if (*word == '\0' && TEXT_MATCH(*p == '(')) {
+            /* nan(...) */
+            p++;
+            while (TEXT_MATCH(isalnum((unsigned char)*p) || *p == '_')) {
+                p++;
+            }
+            if (TEXT_MATCH(*p == ')')) {
+                p++;
+            }
+        }
+        valid = 0;
+    }
+    else {
+        q = p;
+        while (TEXT_MATCH(TEXT_IS_DIGIT(*p))) {
+            text_add_digit(&d, *p - '0', 0);
+            p++;
+        }
+        valid = (p != q);
+        q = p;
+        if (TEXT_MATCH(*p == '.')) {
+            p++;
+            while (TEXT_MATCH(TEXT_IS_DIGIT(*p))) {
+                text_add_digit(&d, *p - '0', 1);
+                p++;
+            }
+            valid |= (p != q + 1);
+        }
+        /* an exponent may only follow digits after a point */
+        if (p != q + 1 && TEXT_MATCH(*p == 'e' || *p == 'E')) {
+            q = p++;
+            if (TEXT_MATCH(*p == '+' || *p == '-')) {
+                p++;
+            }
+            if (TEXT_MATCH(TEXT_IS_DIGIT(*p))) {
+                p = text_add_exponent(&d, q + 1, limit);
+            }
+            else {
+                /* strtod reads the number before a bare "e" */
+                valid = 0;
+            }
+        }
+    }
+#undef TEXT_MATCH
+
+    *end = p;
+    if (p == s) {
+        return 0;
+    }
+    if (valid && npy_decimal_to_double(d.mantissa, d.exp10, d.truncated,
+                                       value)) {
+        if (negative) {
+            *value = -*value;
+        }
+        return 1;
+    }
+    memcpy(buffer, s, p - s);
+    buffer[p - s] = '\0';
+    *value = NumPyOS_ascii_strtod(buffer, &q);
+    return q != buffer;
+}
+
+/*
+ * Parses the element at s for a type accepted by text_native_type,
+ * setting *end past it, or to s if nothing is read. `scan` selects the
+ * semantics of fromfile (scanfunc) over those of fromstring (fromstr),
+ * which treat signs, overflow and incomplete numbers differently.
+ * Doesn't need the GIL.
+ */
+static int
+text_parse_element(char *s, void *dptr, PyArray_Descr *dtype, char **end,
+                   int scan)
+{
+    int type_num = dtype->type_num;
+    char *start = s, *p, *digits;
+    text_decimal d = {0, 0, 0, 0};
+    int sign = 0, negative = 0;
+    int is_float = (type_num == NPY_BOOL || type_num == NPY_HALF ||
+                    type_num == NPY_FLOAT || type_num == NPY_DOUBLE);
+    double value;
+
+    if (is_float && scan) {
+        if (!text_scan_double(s, &value, &p)) {
+            *end = s;
+            return -1;
+        }
+        goto store_float;
+    }
+    while (TEXT_IS_SPACE(*start)) {
+        start++;
+    }
+    p = start;
+    if (*p == '+' || *p == '-') {
+        sign = 1;
+        negative = (*p == '-');
+        p++;
+    }
+    digits = p;
+
+    if (is_float) {
+        int ndigits;
+
+        while (TEXT_IS_DIGIT(*p)) {
+            text_add_digit(&d, *p - '0', 0);
+            p++;
+        }
+        ndigits = p - digits;
+        if (*p == '.') {
+            p++;
+            digits = p;
+            while (TEXT_IS_DIGIT(*p)) {
+                text_add_digit(&d, *p - '0', 1);
+                p++;
+            }
+            ndigits += p - digits;
+        }
+        if (ndigits != 0 && (*p == 'e' || *p == 'E')) {
+            char *q = p + 1;
+
+            if (*q == '+' || *q == '-') {
+                q++;
+            }
+            if (TEXT_IS_DIGIT(*q)) {
+                p = text_add_exponent(&d, p + 1, NULL);
+            }
+        }
+        /* leave hexadecimal, inf, nan and the like to strtod */
+        if (ndigits == 0 || isalnum((unsigned char)*p) || *p == '.' ||
+                *p == '_' || !npy_decimal_to_double(d.mantissa, d.exp10,
+                                                    d.truncated, &value)) {
+            return dtype->f->fromstr(s, dptr, end, dtype);
+        }
+        if (negative) {
+            value = -value;
+        }
+ store_float:
+        switch (type_num) {
+            case NPY_BOOL:
+                *(npy_bool *)dptr = (value != 0.0);
+                break;
+            case NPY_HALF:
+                *(npy_half *)dptr = npy_double_to_half(value);
+                break;
+            case NPY_FLOAT:
+                *(npy_float *)dptr = (npy_float)value;
+                break;
+            default:
+                *(npy_double *)dptr = value;
+                break;
+        }
+        *end = p;
+        return 0;
+    }
+    else {
+        npy_ulonglong uvalue = 0;
+        npy_longlong ivalue;
+        char *nonzero;
+        int is_unsigned = (type_num == NPY_UBYTE || type_num == NPY_USHORT ||
+                           type_num == NPY_UINT || type_num == NPY_ULONG);
+
+        while (*p == '0') {
+            p++;
+        }
+        nonzero = p;
+        while (TEXT_IS_DIGIT(*p)) {
+            uvalue = uvalue * 10 + (*p - '0');
+            p++;
+        }
+
+        /*
+         * Values of up to 18 digits are stored with a C cast, which is what
+         * both parsers do for values that fit in the long they parse to,
+         * but fromstring doesn't accept signs for the unsigned types.
+         */
+        ivalue = negative ? -(npy_longlong)uvalue : (npy_longlong)uvalue;
+        if (p == digits || p - nonzero > 18 || isalnum((unsigned char)*p) ||
+                (sign && is_unsigned && !scan) ||
+                (type_num != NPY_LONGLONG && type_num != NPY_ULONGLONG &&
+                 (ivalue < NPY_MIN_LONG || ivalue > NPY_MAX_LONG))) {
+            if (scan) {
+                return text_scan_integer(s, dptr, dtype, end);
+            }
+            return dtype->f->fromstr(s, dptr, end, dtype);
+        }
+        switch (type_num) {
+#define TEXT_STORE_CASE(NUM, type) \
+            case NUM: \
+                *(type *)dptr = (type)ivalue; \
+                break;
+            TEXT_STORE_CASE(NPY_BYTE, npy_byte)
+            TEXT_STORE_CASE(NPY_UBYTE, npy_ubyte)
+            TEXT_STORE_CASE(NPY_SHORT, npy_short)
+            TEXT_STORE_CASE(NPY_USHORT, npy_ushort)
+            TEXT_STORE_CASE(NPY_INT, npy_int)
+            TEXT_STORE_CASE(NPY_UINT, npy_uint)
+            TEXT_STORE_CASE(NPY_LONG, npy_long)
+            TEXT_STORE_CASE(NPY_ULONG, npy_ulong)
+            TEXT_STORE_CASE(NPY_LONGLONG, npy_longlong)
+            TEXT_STORE_CASE(NPY_ULONGLONG, npy_ulonglong)
+#undef TEXT_STORE_CASE
+        }
+        *end = p;
+        return 0;
+    }
+}
+
+#undef TEXT_IS_DIGIT
+#undef TEXT_IS_SPACE
+
+static int
+fromstr_next_element_native(char **s, void *dptr, PyArray_Descr *dtype,
+                            const char *end)
+{
+    char *e = *s;
+    int r = text_parse_element(*s, dptr, dtype, &e, 0);
+
+    if (*s == e) {
+        /* Nothing read */
+        return -1;
+    }
+    *s = e;
+    if (end != NULL && *s > end) {
+        return -1;
+    }
+    return r;
+}
+
+/*
+ * Reading text from a file through a buffer, so that it is parsed in
+ * memory like for fromstring instead of a character at a time through
+ * stdio. The file is read ahead, and positioned after the parsed text by
+ * fromfile_buffer_close. Files which can't seek are read with the
+ * functions above instead.
+ */
+#define FROMFILE_BUFFER_SIZE (1 << 16)
+/*
+ * The text after an element or separator that is read before parsing it,
+ * so that parsers which look ahead see the same text as in the file.
+ * Longer elements are parsed again once more of the file is read.
+ */
+#define FROMFILE_LOOKAHEAD 128
+
+typedef struct {
+    FILE *fp;
+    /* NUL terminated text from the file */
+    char *buf;
+    char *pos;
+    char *end;
+    npy_intp alloc;
+    /* the position in the file of buf */
+    npy_off_t offset;
+    int eof;
+    int nomem;
+} fromfile_buffer;
+
+static fromfile_buffer *
+fromfile_buffer_new(FILE *fp)
+{
+    fromfile_buffer *fb;
+    npy_off_t offset = npy_ftell(fp);
+
+    if (offset < 0) {
+        /* not seekable */
+        return NULL;
+    }
+    fb = malloc(sizeof(fromfile_buffer));
+    if (fb == NULL) {
+        return NULL;
+    }
+    fb->buf = malloc(FROMFILE_BUFFER_SIZE);
+    if (fb->buf == NULL) {
+        free(fb);
+        return NULL;
+    }
+    fb->fp = fp;
+    fb->pos = fb->end = fb->buf;
+    *fb->end = '\0';
+    fb->alloc = FROMFILE_BUFFER_SIZE;
+    fb->offset = offset;
+    fb->eof = 0;
+    fb->nomem = 0;
+    return fb;
+}
+
+/*
+ * Positions the file after the parsed text and frees the buffer. Returns
+ * -1 if the file could not be positioned or the buffer could not grow,
+ * with errno set.
+ */
+static int
+fromfile_buffer_close(fromfile_buffer *fb)
+{
+    int ret = 0;
+
+    if (fb->nomem) {
+        errno = ENOMEM;
+        ret = -1;
+    }
+    else if (npy_fseek(fb->fp, fb->offset + (fb->pos - fb->buf),
+                       SEEK_SET) < 0) {
+        ret = -1;
+    }
+    free(fb->buf);
+    free(fb);
+    return ret;
+}
+
+/*
+ * Moves the unparsed text to the start of the buffer, growing it if that
+ * leaves less than half of it free, and reads more of the file after it.
+ */
+static int
+fromfile_buffer_fill(fromfile_buffer *fb)
+{
+    npy_intp keep = fb->end - fb->pos;
+    size_t n;
+
+    if (fb->eof) {
+        return 0;
+    }
+    if (keep >= fb->alloc / 2) {
+        npy_intp pos = fb->pos - fb->buf;
+        char *buf = realloc(fb->buf, 2 * fb->alloc);
+
+        if (buf == NULL) {
+            fb->nomem = 1;
+            return -1;
+        }
+        fb->buf = buf;
+        fb->pos = buf + pos;
+        fb->alloc *= 2;
+    }
+    memmove(fb->buf, fb->pos, keep);
+    fb->offset += fb->pos - fb->buf;
+    fb->pos = fb->buf;
+    n = fread(fb->buf + keep, 1, fb->alloc - keep - 1, fb->fp);
+    if (n == 0) {
+        fb->eof = 1;
+    }
+    fb->end = fb->buf + keep + n;
+    *fb->end = '\0';
+    return 0;
+}
+
+static int
+fromfile_buffered_next_element(fromfile_buffer **fbp, void *dptr,
+                               PyArray_Descr *dtype,
+                               void *NPY_UNUSED(stream_data))
+{
+    fromfile_buffer *fb = *fbp;
+    char *e;
+
+    while (1) {
+        /* The parsers skip whitespace, which may be longer than a buffer */
+        while (fb->pos < fb->end && NumPyOS_ascii_isspace(*fb->pos)) {
+            fb->pos++;
+        }
+        if (!fb->eof && fb->end - fb->pos < FROMFILE_LOOKAHEAD) {
+            if (fromfile_buffer_fill(fb) < 0) {
+                return -1;
+            }
+            continue;
+        }
+        text_parse_element(fb->pos, dptr, dtype, &e, 1);
+        if (e == fb->pos) {
+            return -1;
+        }
+        if (e == fb->end && !fb->eof) {
+            /* The element may continue after the buffer */
+            if (fromfile_buffer_fill(fb) < 0) {
+                return -1;
+            }
+            continue;
+        }
+        fb->pos = e;
+        return 0;
+    }
+}
+
+static int
+fromfile_buffered_skip_separator(fromfile_buffer **fbp, const char *sep,
+                                 void *NPY_UNUSED(stream_data))
+{
+    fromfile_buffer *fb = *fbp;
+    char *s;
+    int r;
+
+    while (1) {
+        if (!fb->eof && fb->end - fb->pos < FROMFILE_LOOKAHEAD) {
+            if (fromfile_buffer_fill(fb) < 0) {
+                return -1;
+            }
+        }
+        s = fb->pos;
+        r = fromstr_skip_separator(&s, sep, fb->end);
+        if (r == -1 && s == fb->end && !fb->eof) {
+            /* The separator may continue after the buffer */
+            if (fromfile_buffer_fill(fb) < 0) {
+                return -1;
+            }
+            continue;
+        }
+        fb->pos = s;
+        return r;
+    }
+}
+#undef FROMFILE_BUFFER_SIZE
+#undef FROMFILE_LOOKAHEAD
+
 /*
  * Change a sub-array field to the base descriptor
  * and update the dimensions and strides
@@ -333,6 +912,13 @@ _strided_byte_swap(void *p, npy_intp stride, npy_intp n, int size)
     char *a, *b, c = 0;
     int j, m;
 
+    if (stride == size) {
+        /* swap the bulk of contiguous data with SIMD, the loops get the rest */
+        npy_intp nswapped = npy_bswap_contig(p, p, n, size);
+        p = (char *)p + nswapped * size;
+        n -= nswapped;
+    }
+
     switch(size) {
     case 1: /* no byteswap necessary */
         break;
@@ -3367,6 +3953,7 @@ PyArray_FromFile(FILE *fp, PyArray_Descr *dtype, npy_intp num, char *sep)
 {
     PyArrayObject *ret;
     size_t nread = 0;
+    fromfile_buffer *fb;
 
     if (PyDataType_REFCHK(dtype)) {
         PyErr_SetString(PyExc_ValueError,
@@ -3390,9 +3977,28 @@ PyArray_FromFile(FILE *fp, PyArray_Descr *dtype, npy_intp num, char *sep)
             Py_DECREF(dtype);
             return NULL;
         }
-        ret = array_from_text(dtype, num, sep, &nread, fp,
-                (next_element) fromfile_next_element,
-                (skip_separator) fromfile_skip_separator, NULL);
+        fb = text_native_type(dtype) ? fromfile_buffer_new(fp) : NULL;
+        if (fb != NULL) {
+            ret = array_from_text(dtype, num, sep, &nread, fb,
+                    (next_element) fromfile_buffered_next_element,
+                    (skip_separator) fromfile_buffered_skip_separator, NULL);
+            if (fromfile_buffer_close(fb) < 0 && ret != NULL) {
+                if (errno == ENOMEM) {
+                    PyErr_NoMemory();
+                }
+                else {
+                    PyErr_SetFromErrno(PyExc_IOError);
+                }
+                /* ret owns the reference to dtype */
+                Py_DECREF(ret);
+                return NULL;
+            }
+        }
+        else {
+            ret = array_from_text(dtype, num, sep, &nread, fp,
+                    (next_element) fromfile_next_element,
+                    (skip_separator) fromfile_skip_separator, NULL);
+        }
     }
     if (ret == NULL) {
         Py_DECREF(dtype);
@@ -3627,7 +4233,9 @@ PyArray_FromString(char *data, npy_intp slen, PyArray_Descr *dtype,
         }
         ret = array_from_text(dtype, num, sep, &nread,
                               data,
-                              (next_element) fromstr_next_element,
+                              text_native_type(dtype) ?
+                                  (next_element) fromstr_next_element_native :
+                                  (next_element) fromstr_next_element,
                               (skip_separator) fromstr_skip_separator,
                               end);
     }
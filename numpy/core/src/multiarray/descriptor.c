@@ -16,6 +16,7 @@
 #include "_datetime.h"
 #include "common.h"
 #include "descriptor.h"
+#include "lowlevel_strided_loops.h"
 
 /*
  * offset:    A starting offset.
@@ -2038,8 +2039,9 @@ arraydescr_names_set(PyArray_Descr *self, PyObject *val)
             return -1;
         }
     }
-    /* Invalidate cached hash value */
+    /* Invalidate cached hash value and transfer functions */
     self->hash = -1;
+    PyArray_ClearDTypeTransferCache();
     /* Update dictionary keys in fields */
     new_names = PySequence_Tuple(val);
     new_fields = PyDict_New();
@@ -2488,8 +2490,9 @@ arraydescr_setstate(PyArray_Descr *self, PyObject *args)
                      version);
         return NULL;
     }
-    /* Invalidate cached hash value */
+    /* Invalidate cached hash value and transfer functions */
     self->hash = -1;
+    PyArray_ClearDTypeTransferCache();
 
     if (version == 1 || version == 0) {
         if (fields != Py_None) {
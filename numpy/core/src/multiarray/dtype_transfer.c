@@ -48,6 +48,13 @@
 #endif
 /**********************************************/
 
+/*
+ * Incremented whenever computing a transfer function emits a warning,
+ * results whose computation warned are not put in the transfer
+ * function cache so the warning is given again next time.
+ */
+static npy_intp _transfer_warning_count = 0;
+
 /*
  * Returns a transfer function which DECREFs any references in src_type.
  *
@@ -673,6 +680,7 @@ get_nbo_cast_numeric_transfer_function(int aligned,
                 "Casting complex values to real discards "
                 "the imaginary part", 1);
         Py_XDECREF(cls);
+        _transfer_warning_count++;
         if (ret < 0) {
             return NPY_FAIL;
         }
@@ -2706,6 +2714,8 @@ get_fields_transfer_function(int aligned,
     else {
         /* Keeps track of the names we already used */
         PyObject *used_names_dict = NULL;
+        /* Where the last entry ends if it is a plain copy, else -1 */
+        npy_intp copy_src_end = -1, copy_dst_end = -1;
 
         names = dst_dtype->names;
         names_size = PyTuple_GET_SIZE(dst_dtype->names);
@@ -2737,75 +2747,100 @@ get_fields_transfer_function(int aligned,
         data->base.clone = &_field_transfer_data_clone;
         fields = &data->fields;
 
+        /* Use field_count to track the transfer functions added */
+        field_count = 0;
         for (i = 0; i < names_size; ++i) {
             key = PyTuple_GET_ITEM(names, i);
             tup = PyDict_GetItem(dst_dtype->fields, key);
             if (!PyArg_ParseTuple(tup, "Oi|O", &dst_fld_dtype,
                                                     &dst_offset, &title)) {
-                for (i = i-1; i >= 0; --i) {
-                    NPY_AUXDATA_FREE(fields[i].data);
-                }
-                PyArray_free(data);
-                Py_XDECREF(used_names_dict);
-                return NPY_FAIL;
+                goto fail;
             }
             tup = PyDict_GetItem(src_dtype->fields, key);
             if (tup != NULL) {
                 if (!PyArg_ParseTuple(tup, "Oi|O", &src_fld_dtype,
                                                         &src_offset, &title)) {
-                    for (i = i-1; i >= 0; --i) {
-                        NPY_AUXDATA_FREE(fields[i].data);
+                    goto fail;
+                }
+                if (used_names_dict != NULL) {
+                    PyDict_SetItem(used_names_dict, key, Py_True);
+                }
+
+                /*
+                 * A field which is a plain copy is merged into the
+                 * previous one if it directly follows it in both src
+                 * and dst, so runs of fields with the same layout are
+                 * done as a single copy. The copy functions are
+                 * filled in once the sizes are known.
+                 */
+                if (!PyDataType_REFCHK(src_fld_dtype) &&
+                        !PyDataType_REFCHK(dst_fld_dtype) &&
+                        PyArray_EquivTypes(src_fld_dtype, dst_fld_dtype)) {
+                    if (src_offset == copy_src_end &&
+                            dst_offset == copy_dst_end) {
+                        fields[field_count-1].src_itemsize +=
+                                                src_fld_dtype->elsize;
                     }
-                    PyArray_free(data);
-                    Py_XDECREF(used_names_dict);
-                    return NPY_FAIL;
+                    else {
+                        fields[field_count].stransfer = NULL;
+                        fields[field_count].data = NULL;
+                        fields[field_count].src_offset = src_offset;
+                        fields[field_count].dst_offset = dst_offset;
+                        fields[field_count].src_itemsize =
+                                                src_fld_dtype->elsize;
+                        field_count++;
+                    }
+                    copy_src_end = src_offset + src_fld_dtype->elsize;
+                    copy_dst_end = dst_offset + src_fld_dtype->elsize;
+                    continue;
                 }
+
                 if (PyArray_GetDTypeTransferFunction(0,
                                         src_stride, dst_stride,
                                         src_fld_dtype, dst_fld_dtype,
                                         move_references,
-                                        &fields[i].stransfer,
-                                        &fields[i].data,
+                                        &fields[field_count].stransfer,
+                                        &fields[field_count].data,
                                         out_needs_api) != NPY_SUCCEED) {
-                    for (i = i-1; i >= 0; --i) {
-                        NPY_AUXDATA_FREE(fields[i].data);
-                    }
-                    PyArray_free(data);
-                    Py_XDECREF(used_names_dict);
-                    return NPY_FAIL;
-                }
-                fields[i].src_offset = src_offset;
-                fields[i].dst_offset = dst_offset;
-                fields[i].src_itemsize = src_fld_dtype->elsize;
-
-                if (used_names_dict != NULL) {
-                    PyDict_SetItem(used_names_dict, key, Py_True);
+                    goto fail;
                 }
+                fields[field_count].src_offset = src_offset;
+                fields[field_count].dst_offset = dst_offset;
+                fields[field_count].src_itemsize = src_fld_dtype->elsize;
             }
             else {
                 if (get_setdstzero_transfer_function(0,
                                             dst_stride,
                                             dst_fld_dtype,
-                                            &fields[i].stransfer,
-                                            &fields[i].data,
+                                            &fields[field_count].stransfer,
+                                            &fields[field_count].data,
                                             out_needs_api) != NPY_SUCCEED) {
-                    for (i = i-1; i >= 0; --i) {
-                        NPY_AUXDATA_FREE(fields[i].data);
-                    }
-                    PyArray_free(data);
-                    Py_XDECREF(used_names_dict);
-                    return NPY_FAIL;
+                    goto fail;
                 }
-                fields[i].src_offset = 0;
-                fields[i].dst_offset = dst_offset;
-                fields[i].src_itemsize = 0;
+                fields[field_count].src_offset = 0;
+                fields[field_count].dst_offset = dst_offset;
+                fields[field_count].src_itemsize = 0;
             }
+            field_count++;
+            copy_src_end = -1;
+            copy_dst_end = -1;
         }
 
-        if (move_references && PyDataType_REFCHK(src_dtype)) {
-            /* Use field_count to track additional functions added */
-            field_count = names_size;
+        /* Get the copy functions for the merged plain copies */
+        for (i = 0; i < field_count; ++i) {
+            if (fields[i].stransfer == NULL) {
+                fields[i].stransfer = PyArray_GetStridedCopyFn(0,
+                                            src_stride, dst_stride,
+                                            fields[i].src_itemsize);
+                if (fields[i].stransfer == NULL) {
+                    PyErr_SetString(PyExc_RuntimeError,
+                            "unexpected error in GetStridedCopyFn");
+                    goto fail;
+                }
+            }
+        }
 
+        if (move_references && PyDataType_REFCHK(src_dtype)) {
             names = src_dtype->names;
             names_size = PyTuple_GET_SIZE(src_dtype->names);
             for (i = 0; i < names_size; ++i) {
@@ -2814,12 +2849,7 @@ get_fields_transfer_function(int aligned,
                     tup = PyDict_GetItem(src_dtype->fields, key);
                     if (!PyArg_ParseTuple(tup, "Oi|O", &src_fld_dtype,
                                                     &src_offset, &title)) {
-                        for (i = field_count-1; i >= 0; --i) {
-                            NPY_AUXDATA_FREE(fields[i].data);
-                        }
-                        PyArray_free(data);
-                        Py_XDECREF(used_names_dict);
-                        return NPY_FAIL;
+                        goto fail;
                     }
                     if (PyDataType_REFCHK(src_fld_dtype)) {
                         if (get_decsrcref_transfer_function(0,
@@ -2828,11 +2858,7 @@ get_fields_transfer_function(int aligned,
                                     &fields[field_count].stransfer,
                                     &fields[field_count].data,
                                     out_needs_api) != NPY_SUCCEED) {
-                            for (i = field_count-1; i >= 0; --i) {
-                                NPY_AUXDATA_FREE(fields[i].data);
-                            }
-                            PyArray_free(data);
-                            return NPY_FAIL;
+                            goto fail;
                         }
                         fields[field_count].src_offset = src_offset;
                         fields[field_count].dst_offset = 0;
@@ -2846,12 +2872,34 @@ get_fields_transfer_function(int aligned,
 
         Py_XDECREF(used_names_dict);
 
+        /*
+         * If everything merged into one copy of the whole item, as for
+         * equally laid out dtypes, the wrapper isn't needed
+         */
+        if (field_count == 1 && fields[0].data == NULL &&
+                fields[0].src_offset == 0 && fields[0].dst_offset == 0 &&
+                fields[0].src_itemsize == src_dtype->elsize &&
+                fields[0].src_itemsize == dst_dtype->elsize) {
+            *out_stransfer = fields[0].stransfer;
+            *out_transferdata = NULL;
+            PyArray_free(data);
+            return NPY_SUCCEED;
+        }
+
         data->field_count = field_count;
 
         *out_stransfer = &_strided_to_strided_field_transfer;
         *out_transferdata = (NpyAuxData *)data;
 
         return NPY_SUCCEED;
+
+fail:
+        for (i = field_count-1; i >= 0; --i) {
+            NPY_AUXDATA_FREE(fields[i].data);
+        }
+        PyArray_free(data);
+        Py_XDECREF(used_names_dict);
+        return NPY_FAIL;
     }
 }
 
@@ -3502,8 +3550,8 @@ PyArray_GetDTypeCopySwapFn(int aligned,
 
 /********************* MAIN DTYPE TRANSFER FUNCTION ***********************/
 
-NPY_NO_EXPORT int
-PyArray_GetDTypeTransferFunction(int aligned,
+static int
+get_dtype_transfer_function(int aligned,
                             npy_intp src_stride, npy_intp dst_stride,
                             PyArray_Descr *src_dtype, PyArray_Descr *dst_dtype,
                             int move_references,
@@ -3724,6 +3772,183 @@ PyArray_GetDTypeTransferFunction(int aligned,
                     out_needs_api);
 }
 
+/******************** DTYPE TRANSFER FUNCTION CACHE *********************/
+
+/*
+ * Setting up the transfer function for structured, subarray and datetime
+ * dtypes allocates and fills in auxiliary data for every field, which
+ * dominates the cost of small copies. The most recently used of these are
+ * kept here and handed out as clones of the cached auxiliary data.
+ *
+ * The cache holds references to the dtypes of its keys so they can't be
+ * deallocated and their addresses reused while cached. It is protected by
+ * the GIL, which is held whenever transfer functions are computed.
+ */
+#define NPY_TRANSFER_CACHE_SIZE 32
+
+typedef struct {
+    /* NULL for an unused entry */
+    PyArray_Descr *src_dtype, *dst_dtype;
+    npy_intp src_stride, dst_stride;
+    int aligned, move_references, needs_api;
+    PyArray_StridedUnaryOp *stransfer;
+    NpyAuxData *transferdata;
+    /* for evicting the least recently used entry */
+    npy_uint64 last_use;
+} _transfer_cache_entry;
+
+static _transfer_cache_entry _transfer_cache[NPY_TRANSFER_CACHE_SIZE];
+static npy_uint64 _transfer_cache_clock = 0;
+
+static void
+_transfer_cache_entry_clear(_transfer_cache_entry *entry)
+{
+    PyArray_Descr *src_dtype = entry->src_dtype;
+    PyArray_Descr *dst_dtype = entry->dst_dtype;
+    NpyAuxData *transferdata = entry->transferdata;
+
+    /* Freeing may run arbitrary code, so unlink the entry first */
+    entry->src_dtype = NULL;
+    entry->dst_dtype = NULL;
+    entry->transferdata = NULL;
+    NPY_AUXDATA_FREE(transferdata);
+    Py_XDECREF(src_dtype);
+    Py_XDECREF(dst_dtype);
+}
+
+/*
+ * Empties the dtype transfer function cache. This must be called when
+ * a dtype is modified in place, since the cache is keyed by the dtype
+ * instances.
+ */
+NPY_NO_EXPORT void
+PyArray_ClearDTypeTransferCache(void)
+{
+    int i;
+
+    for (i = 0; i < NPY_TRANSFER_CACHE_SIZE; ++i) {
+        _transfer_cache_entry_clear(&_transfer_cache[i]);
+    }
+}
+
+/*
+ * Only the dtypes whose transfer functions are expensive to compute
+ * are cached, simple ones are faster to recompute than to look up.
+ */
+static int
+_transfer_is_cacheable(PyArray_Descr *src_dtype, PyArray_Descr *dst_dtype)
+{
+    return PyDataType_HASFIELDS(src_dtype) ||
+           PyDataType_HASFIELDS(dst_dtype) ||
+           PyDataType_HASSUBARRAY(src_dtype) ||
+           PyDataType_HASSUBARRAY(dst_dtype) ||
+           src_dtype->type_num == NPY_DATETIME ||
+           src_dtype->type_num == NPY_TIMEDELTA ||
+           dst_dtype->type_num == NPY_DATETIME ||
+           dst_dtype->type_num == NPY_TIMEDELTA;
+}
+
+NPY_NO_EXPORT int
+PyArray_GetDTypeTransferFunction(int aligned,
+                            npy_intp src_stride, npy_intp dst_stride,
+                            PyArray_Descr *src_dtype, PyArray_Descr *dst_dtype,
+                            int move_references,
+                            PyArray_StridedUnaryOp **out_stransfer,
+                            NpyAuxData **out_transferdata,
+                            int *out_needs_api)
+{
+    _transfer_cache_entry *entry, *oldest;
+    npy_intp warning_count;
+    int i, needs_api = 0;
+
+    if (src_dtype == NULL || dst_dtype == NULL ||
+            !_transfer_is_cacheable(src_dtype, dst_dtype)) {
+        return get_dtype_transfer_function(aligned,
+                                src_stride, dst_stride,
+                                src_dtype, dst_dtype,
+                                move_references,
+                                out_stransfer, out_transferdata,
+                                out_needs_api);
+    }
+
+    aligned = (aligned != 0);
+    move_references = (move_references != 0);
+    oldest = &_transfer_cache[0];
+    for (i = 0; i < NPY_TRANSFER_CACHE_SIZE; ++i) {
+        entry = &_transfer_cache[i];
+        if (entry->src_dtype == src_dtype &&
+                entry->dst_dtype == dst_dtype &&
+                entry->src_stride == src_stride &&
+                entry->dst_stride == dst_stride &&
+                entry->aligned == aligned &&
+                entry->move_references == move_references) {
+            if (entry->transferdata != NULL) {
+                *out_transferdata = NPY_AUXDATA_CLONE(entry->transferdata);
+                if (*out_transferdata == NULL) {
+                    PyErr_NoMemory();
+                    return NPY_FAIL;
+                }
+            }
+            else {
+                *out_transferdata = NULL;
+            }
+            *out_stransfer = entry->stransfer;
+            if (out_needs_api && entry->needs_api) {
+                *out_needs_api = 1;
+            }
+            entry->last_use = ++_transfer_cache_clock;
+            return NPY_SUCCEED;
+        }
+        if (entry->src_dtype == NULL ||
+                (oldest->src_dtype != NULL &&
+                 entry->last_use < oldest->last_use)) {
+            oldest = entry;
+        }
+    }
+
+    warning_count = _transfer_warning_count;
+    if (get_dtype_transfer_function(aligned,
+                            src_stride, dst_stride,
+                            src_dtype, dst_dtype,
+                            move_references,
+                            out_stransfer, out_transferdata,
+                            &needs_api) != NPY_SUCCEED) {
+        return NPY_FAIL;
+    }
+    if (out_needs_api && needs_api) {
+        *out_needs_api = 1;
+    }
+    if (warning_count != _transfer_warning_count) {
+        return NPY_SUCCEED;
+    }
+
+    /*
+     * Store a clone, the caller owns and may free the returned data.
+     * Failing to cache is not an error.
+     */
+    entry = oldest;
+    _transfer_cache_entry_clear(entry);
+    if (*out_transferdata != NULL) {
+        entry->transferdata = NPY_AUXDATA_CLONE(*out_transferdata);
+        if (entry->transferdata == NULL) {
+            return NPY_SUCCEED;
+        }
+    }
+    Py_INCREF(src_dtype);
+    entry->src_dtype = src_dtype;
+    Py_INCREF(dst_dtype);
+    entry->dst_dtype = dst_dtype;
+    entry->src_stride = src_stride;
+    entry->dst_stride = dst_stride;
+    entry->aligned = aligned;
+    entry->move_references = move_references;
+    entry->needs_api = needs_api;
+    entry->stransfer = *out_stransfer;
+    entry->last_use = ++_transfer_cache_clock;
+
+    return NPY_SUCCEED;
+}
+
 NPY_NO_EXPORT int
 PyArray_GetMaskedDTypeTransferFunction(int aligned,
                             npy_intp src_stride,
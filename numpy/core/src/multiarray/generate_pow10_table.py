@@ -0,0 +1,45 @@
+#!/usr/bin/env python
+"""
+Write pow10_table.h, the 128 bit approximations of the powers of ten used
+by the Eisel-Lemire conversion of decimal strings to doubles in
+arraytypes.c.src.
+
+The power 10**e, for POW10_MIN <= e <= POW10_MAX, is stored as the 128 bit
+integer m with its top bit set and m*2**k <= 10**e < (m + 1)*2**k for some
+k, i.e. rounded down, as the high and low 64 bit halves of m.
+"""
+from __future__ import division, absolute_import, print_function
+
+POW10_MIN = -348
+POW10_MAX = 347
+
+
+def pow10_128(e):
+    if e >= 0:
+        v = 10**e
+        n = v.bit_length()
+        return v >> (n - 128) if n >= 128 else v << (128 - n)
+    v = 10**-e
+    return (1 << (127 + v.bit_length())) // v
+
+
+if __name__ == '__main__':
+    with open('pow10_table.h', 'w') as f:
+        f.write('/*\n'
+                ' * Generated by generate_pow10_table.py, do not edit.\n'
+                ' *\n'
+                ' * 10^e rounded down to 128 bits with the top bit set, as '
+                'its high and\n'
+                ' * low halves, for %d <= e <= %d.\n'
+                ' */\n\n' % (POW10_MIN, POW10_MAX))
+        f.write('#define NPY_POW10_MIN (%d)\n' % POW10_MIN)
+        f.write('#define NPY_POW10_MAX %d\n\n' % POW10_MAX)
+        f.write('static const npy_uint64 _npy_pow10_128[%d][2] = {\n' %
+                (POW10_MAX - POW10_MIN + 1))
+        for e in range(POW10_MIN, POW10_MAX + 1):
+            m = pow10_128(e)
+            assert m.bit_length() == 128
+            f.write('    {0x%016xULL, 0x%016xULL}%s\n' %
+                    (m >> 64, m & (2**64 - 1),
+                     ',' if e < POW10_MAX else ''))
+        f.write('};\n')
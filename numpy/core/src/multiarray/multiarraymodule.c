@@ -61,6 +61,8 @@ NPY_NO_EXPORT int NPY_NUMUSERTYPES = 0;
 #include "templ_common.h" /* for npy_mul_with_overflow_intp */
 #include "compiled_base.h"
 #include "mem_overlap.h"
+#include "textreading.h"
+#include "textwriting.h"
 
 /* Only here for API compatibility */
 NPY_NO_EXPORT PyTypeObject PyBigArray_Type;
@@ -4294,6 +4296,16 @@ static struct PyMethodDef array_module_methods[] = {
         METH_VARARGS | METH_KEYWORDS, NULL},
     {"unpackbits", (PyCFunction)io_unpack,
         METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_loadtxt", (PyCFunction)arr_loadtxt,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_genfromtxt_split", (PyCFunction)arr_genfromtxt_split,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_genfromtxt_infer", (PyCFunction)arr_genfromtxt_infer,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_genfromtxt_convert", (PyCFunction)arr_genfromtxt_convert,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_format_rows", (PyCFunction)arr_format_rows,
+        METH_VARARGS, NULL},
     {NULL, NULL, 0, NULL}                /* sentinel */
 };
 
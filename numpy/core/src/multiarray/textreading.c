@@ -0,0 +1,1773 @@
+/*
+ * Tokenizer and parser used by numpy.loadtxt and numpy.genfromtxt.
+ *
+ * The input arrives as an iterator over blocks of bytes. Complete lines
+ * are split into fields and the fields parsed into a growing typed buffer
+ * with the GIL released. Fields which the native parsers don't accept are
+ * handed to the Python converter for their column, with the GIL taken back
+ * only for that field, so results and errors are those of the converters.
+ *
+ * genfromtxt splits its input into a table of tokens first, since the
+ * types of its columns may depend on all of their values, then infers the
+ * types and converts the table in separate passes.
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#define NPY_NO_DEPRECATED_API NPY_API_VERSION
+#define _MULTIARRAYMODULE
+#include "numpy/arrayobject.h"
+#include "numpy/halffloat.h"
+
+#include "npy_config.h"
+
+#include "npy_pycompat.h"
+
+#include "common.h"
+#include "arraytypes.h"
+
+#include "textreading.h"
+
+/* Initial size of the output buffer in bytes */
+#define LOADTXT_INITIAL_BUFSIZE (1 << 16)
+
+#define LOADTXT_IS_SPACE(c) ((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+
+/*
+ * How a field is parsed, following the converters returned by
+ * numpy.lib.npyio._getconv for its type.
+ */
+enum {
+    LOADTXT_BOOL = 'b',     /* bool(int(x)) */
+    LOADTXT_INT64 = 'i',    /* np.int64(x) and np.uint64(x) */
+    LOADTXT_INTEGER = 'I',  /* int(float(x)) */
+    LOADTXT_FLOAT = 'f',    /* float(x) */
+    /* only used by genfromtxt */
+    LOADTXT_STR2BOOL = 'B', /* numpy.lib._iotools.str2bool(x) */
+    LOADTXT_PYINT = 'l',    /* int(x) */
+    LOADTXT_BYTES = 'S',    /* bytes(x) */
+    LOADTXT_CONVERT = 'n'   /* only the converter */
+};
+
+typedef struct {
+    npy_intp offset;
+    /* borrowed references */
+    PyArray_Descr *descr;
+    PyObject *converter;
+    int kind;
+    /* for genfromtxt, the value of missing fields or NULL */
+    const char *fill;
+    /* a 0-d array for the setitem of types which need one, or NULL */
+    PyArrayObject *scratch;
+} loadtxt_field;
+
+typedef struct _loadtxt_state {
+    /* parses a line without its newline, see _parse_line */
+    int (*parse_line)(struct _loadtxt_state *st, const char *s,
+                      npy_intp len);
+
+    /* NULL for runs of whitespace */
+    const char *delimiter;
+    npy_intp delimiter_len;
+    const char **comments;
+    npy_intp *comment_lens;
+    npy_intp ncomments;
+    npy_intp *usecols;
+    npy_intp nusecols;
+    npy_intp skiprows;
+    npy_intp max_rows;
+
+    loadtxt_field *fields;
+    npy_intp nfields;
+    int structured;
+    npy_intp itemsize;
+
+    /* the fields of the current line */
+    const char **tokens;
+    npy_intp *token_lens;
+    npy_intp ntokens_alloc;
+
+    /* columns per row, found from the first line with data */
+    npy_intp ncols;
+    npy_intp rowsize;
+    npy_intp lineno;
+
+    char *data;
+    npy_intp nrows;
+    npy_intp nrows_alloc;
+    /* set if data belongs to an output array, which has out_ncols columns */
+    int fixed;
+    npy_intp out_ncols;
+} loadtxt_state;
+
+
+/* Returns the first occurrence of needle in s[0:len], or NULL */
+static const char *
+_find_bytes(const char *s, npy_intp len, const char *needle, npy_intp nlen)
+{
+    const char *end = s + len - nlen;
+
+    if (nlen == 0) {
+        return s;
+    }
+    while (s <= end) {
+        s = memchr(s, needle[0], end - s + 1);
+        if (s == NULL) {
+            return NULL;
+        }
+        if (memcmp(s, needle, nlen) == 0) {
+            return s;
+        }
+        s++;
+    }
+    return NULL;
+}
+
+/* Returns 0 on success, -1 on error with the GIL released */
+static int
+_add_token(loadtxt_state *st, npy_intp ntokens, const char *tok,
+           npy_intp len)
+{
+    if (ntokens == st->ntokens_alloc) {
+        npy_intp n = st->ntokens_alloc ? 2*st->ntokens_alloc : 16;
+        const char **tokens = realloc((void *)st->tokens,
+                                      n * sizeof(const char *));
+        npy_intp *lens;
+
+        if (tokens == NULL) {
+            return -1;
+        }
+        st->tokens = tokens;
+        lens = realloc(st->token_lens, n * sizeof(npy_intp));
+        if (lens == NULL) {
+            return -1;
+        }
+        st->token_lens = lens;
+        st->ntokens_alloc = n;
+    }
+    st->tokens[ntokens] = tok;
+    st->token_lens[ntokens] = len;
+    return 0;
+}
+
+/*
+ * Splits a line like bytes.split(delimiter), returning the number of
+ * fields, or -1 if out of memory.
+ */
+static npy_intp
+_split_line(loadtxt_state *st, const char *s, const char *end)
+{
+    npy_intp ntokens = 0;
+
+    if (st->delimiter == NULL) {
+        while (1) {
+            const char *tok;
+
+            while (s < end && LOADTXT_IS_SPACE(*s)) {
+                s++;
+            }
+            if (s == end) {
+                break;
+            }
+            tok = s;
+            while (s < end && !LOADTXT_IS_SPACE(*s)) {
+                s++;
+            }
+            if (_add_token(st, ntokens++, tok, s - tok) < 0) {
+                return -1;
+            }
+        }
+    }
+    else {
+        while (1) {
+            const char *next = _find_bytes(s, end - s, st->delimiter,
+                                           st->delimiter_len);
+
+            if (next == NULL) {
+                next = end;
+            }
+            if (_add_token(st, ntokens++, s, next - s) < 0) {
+                return -1;
+            }
+            if (next == end) {
+                break;
+            }
+            s = next + st->delimiter_len;
+        }
+    }
+    return ntokens;
+}
+
+#define LOADTXT_STORE(type, value) do { \
+        type _tmp = (type)(value); \
+        memcpy(dst, &_tmp, sizeof(type)); \
+    } while (0)
+
+/*
+ * Stores int(float(x)) as setitem does, returning 0 if setitem would
+ * raise for the value.
+ */
+static int
+_store_integer(int type_num, npy_longlong value, char *dst)
+{
+    switch (type_num) {
+#define LOADTXT_CASE(NUM, type, type1, lo, hi) \
+        case NUM: \
+            if (value < (lo) || \
+                    (value > 0 && (npy_ulonglong)value > (npy_ulonglong)(hi))) { \
+                return 0; \
+            } \
+            LOADTXT_STORE(type, (type1)value); \
+            return 1;
+        LOADTXT_CASE(NPY_BYTE, npy_byte, long, NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_UBYTE, npy_ubyte, long, NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_SHORT, npy_short, long, NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_USHORT, npy_ushort, long,
+                     NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_INT, npy_int, long, NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_UINT, npy_uint, npy_ulong,
+                     NPY_MIN_LONG, NPY_MAX_ULONG)
+        LOADTXT_CASE(NPY_LONG, npy_long, long, NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_ULONG, npy_ulong, npy_ulong,
+                     NPY_MIN_LONG, NPY_MAX_ULONG)
+        LOADTXT_CASE(NPY_LONGLONG, npy_longlong, npy_longlong,
+                     NPY_MIN_LONGLONG, NPY_MAX_LONGLONG)
+        LOADTXT_CASE(NPY_ULONGLONG, npy_ulonglong, npy_ulonglong,
+                     NPY_MIN_LONGLONG, NPY_MAX_LONGLONG)
+#undef LOADTXT_CASE
+    }
+    return 0;
+}
+
+/* Returns whether value is in the range of the integer type */
+static int
+_integer_fits(int type_num, npy_longlong value)
+{
+    switch (type_num) {
+#define LOADTXT_CASE(NUM, lo, hi) \
+        case NUM: \
+            return value >= (lo) && \
+                   (value <= 0 || (npy_ulonglong)value <= (npy_ulonglong)(hi));
+        LOADTXT_CASE(NPY_BYTE, NPY_MIN_BYTE, NPY_MAX_BYTE)
+        LOADTXT_CASE(NPY_UBYTE, 0, NPY_MAX_UBYTE)
+        LOADTXT_CASE(NPY_SHORT, NPY_MIN_SHORT, NPY_MAX_SHORT)
+        LOADTXT_CASE(NPY_USHORT, 0, NPY_MAX_USHORT)
+        LOADTXT_CASE(NPY_INT, NPY_MIN_INT, NPY_MAX_INT)
+        LOADTXT_CASE(NPY_UINT, 0, NPY_MAX_UINT)
+        LOADTXT_CASE(NPY_LONG, NPY_MIN_LONG, NPY_MAX_LONG)
+        LOADTXT_CASE(NPY_ULONG, 0, NPY_MAX_ULONG)
+        LOADTXT_CASE(NPY_LONGLONG, NPY_MIN_LONGLONG, NPY_MAX_LONGLONG)
+        LOADTXT_CASE(NPY_ULONGLONG, 0, NPY_MAX_ULONGLONG)
+#undef LOADTXT_CASE
+    }
+    return 0;
+}
+
+/* Returns 1 for TRUE and 0 for FALSE in any case, like str2bool, else -1 */
+static int
+_str2bool(const char *s, npy_intp len)
+{
+    static const char *words[2] = {"FALSE", "TRUE"};
+    int value;
+
+    for (value = 0; value < 2; value++) {
+        const char *w = words[value];
+        npy_intp i;
+
+        if (len != (npy_intp)strlen(w)) {
+            continue;
+        }
+        for (i = 0; i < len; i++) {
+            char c = s[i];
+
+            if (c >= 'a' && c <= 'z') {
+                c += 'A' - 'a';
+            }
+            if (c != w[i]) {
+                break;
+            }
+        }
+        if (i == len) {
+            return value;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Parses a field natively, returning 0 if it has to go through the
+ * Python converter instead.
+ */
+static int
+_parse_field(const loadtxt_field *field, const char *tok, npy_intp len,
+             char *dst)
+{
+    const npy_uint8 *s = (const npy_uint8 *)tok;
+    npy_longlong ivalue;
+    double dvalue;
+
+    switch (field->kind) {
+        case LOADTXT_BOOL:
+            if (!STRING_parse_longlong(s, len, &ivalue)) {
+                return 0;
+            }
+            LOADTXT_STORE(npy_bool, ivalue != 0);
+            return 1;
+        case LOADTXT_INT64:
+            /* np.uint64 wraps negative values around like a C cast */
+            if (!STRING_parse_longlong(s, len, &ivalue)) {
+                return 0;
+            }
+            LOADTXT_STORE(npy_int64, ivalue);
+            return 1;
+        case LOADTXT_INTEGER:
+            if (!STRING_parse_double(s, len, &dvalue) ||
+                    !(dvalue > -9223372036854775808.0 &&
+                      dvalue < 9223372036854775808.0)) {
+                return 0;
+            }
+            return _store_integer(field->descr->type_num,
+                                  (npy_longlong)dvalue, dst);
+        case LOADTXT_FLOAT:
+            if (!STRING_parse_double(s, len, &dvalue)) {
+                return 0;
+            }
+            switch (field->descr->type_num) {
+                case NPY_HALF:
+                    LOADTXT_STORE(npy_half, npy_double_to_half(dvalue));
+                    return 1;
+                case NPY_FLOAT:
+                    LOADTXT_STORE(npy_float, dvalue);
+                    return 1;
+                case NPY_DOUBLE:
+                    LOADTXT_STORE(npy_double, dvalue);
+                    return 1;
+            }
+            return 0;
+        case LOADTXT_STR2BOOL: {
+            int value = _str2bool(tok, len);
+
+            if (value < 0) {
+                return 0;
+            }
+            LOADTXT_STORE(npy_bool, value);
+            return 1;
+        }
+        case LOADTXT_PYINT:
+            /* the converter rejects values out of the range of the type */
+            if (!STRING_parse_longlong(s, len, &ivalue) ||
+                    !_integer_fits(field->descr->type_num, ivalue)) {
+                return 0;
+            }
+            return _store_integer(field->descr->type_num, ivalue, dst);
+        case LOADTXT_BYTES: {
+            npy_intp n = len < field->descr->elsize ? len
+                                                    : field->descr->elsize;
+
+            memcpy(dst, tok, n);
+            memset(dst + n, 0, field->descr->elsize - n);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#undef LOADTXT_STORE
+
+/*
+ * Converts a field with its Python converter and stores the result with
+ * setitem. Called with the GIL released, returns -1 on error.
+ */
+static int
+_convert_field(const loadtxt_field *field, const char *tok, npy_intp len,
+               char *dst)
+{
+    /* setitem needs aligned memory when not given an array */
+    union {
+        npy_longlong l;
+        npy_longdouble g;
+        char c[16];
+    } tmp;
+    PyObject *token, *value;
+    int ret = -1;
+    char *buf = tmp.c;
+    NPY_ALLOW_C_API_DEF;
+
+    if (field->scratch != NULL) {
+        buf = PyArray_DATA(field->scratch);
+    }
+    NPY_ALLOW_C_API;
+    token = PyBytes_FromStringAndSize(tok, len);
+    if (token != NULL) {
+        value = PyObject_CallFunctionObjArgs(field->converter, token, NULL);
+        Py_DECREF(token);
+        if (value != NULL) {
+            ret = field->descr->f->setitem(value, buf, field->scratch);
+            Py_DECREF(value);
+        }
+    }
+    NPY_DISABLE_C_API;
+    if (ret < 0) {
+        return -1;
+    }
+    memcpy(dst, buf, field->descr->elsize);
+    return 0;
+}
+
+/* Sets an exception from code running with the GIL released */
+static void
+_set_error(PyObject *type, const char *format, npy_intp lineno)
+{
+    NPY_ALLOW_C_API_DEF;
+
+    NPY_ALLOW_C_API;
+    if (type == NULL) {
+        PyErr_NoMemory();
+    }
+    else {
+        PyErr_Format(type, format, (long)lineno);
+    }
+    NPY_DISABLE_C_API;
+}
+
+/*
+ * Parses the complete line s[0:len] without its newline. Returns 1 if a
+ * row was added, 0 if the line holds no data and -1 on error. Doesn't
+ * need the GIL.
+ */
+static int
+_parse_line(loadtxt_state *st, const char *s, npy_intp len)
+{
+    const char *end = s + len;
+    npy_intp i, ntokens, nvalues;
+    char *row;
+
+    st->lineno++;
+    if (st->lineno <= st->skiprows) {
+        return 0;
+    }
+    for (i = 0; i < st->ncomments; i++) {
+        const char *comment = _find_bytes(s, end - s, st->comments[i],
+                                          st->comment_lens[i]);
+        if (comment != NULL) {
+            end = comment;
+        }
+    }
+    while (s < end && (*s == '\r' || *s == '\n')) {
+        s++;
+    }
+    while (end > s && (end[-1] == '\r' || end[-1] == '\n')) {
+        end--;
+    }
+    if (s == end) {
+        return 0;
+    }
+    ntokens = _split_line(st, s, end);
+    if (ntokens < 0) {
+        _set_error(NULL, NULL, 0);
+        return -1;
+    }
+    if (ntokens == 0) {
+        return 0;
+    }
+
+    if (st->ncols < 0) {
+        st->ncols = st->usecols != NULL ? st->nusecols : ntokens;
+        st->rowsize = st->structured ? st->itemsize
+                                     : st->ncols * st->itemsize;
+        if (st->out_ncols >= 0 && st->ncols != st->out_ncols) {
+            _set_error(PyExc_ValueError,
+                       "output array has the wrong number of columns "
+                       "for line %ld", st->lineno);
+            return -1;
+        }
+    }
+    if (st->usecols == NULL && ntokens != st->ncols) {
+        _set_error(PyExc_ValueError,
+                   "Wrong number of columns at line %ld", st->lineno);
+        return -1;
+    }
+    nvalues = st->structured ? st->nfields : st->ncols;
+    if (nvalues > st->ncols) {
+        _set_error(PyExc_ValueError,
+                   "Wrong number of columns at line %ld", st->lineno);
+        return -1;
+    }
+
+    if (st->nrows == st->nrows_alloc) {
+        npy_intp n;
+        char *data;
+
+        if (st->fixed) {
+            /* max_rows doesn't let this happen */
+            _set_error(PyExc_RuntimeError,
+                       "output array is full at line %ld", st->lineno);
+            return -1;
+        }
+        if (st->nrows_alloc == 0) {
+            n = LOADTXT_INITIAL_BUFSIZE / (st->rowsize > 0 ? st->rowsize : 1);
+            n = n > 0 ? n : 1;
+            if (st->max_rows >= 0 && n > st->max_rows) {
+                n = st->max_rows;
+            }
+        }
+        else {
+            n = 2 * st->nrows_alloc;
+        }
+        if (st->rowsize > 0 && n > NPY_MAX_INTP / st->rowsize) {
+            _set_error(NULL, NULL, 0);
+            return -1;
+        }
+        data = PyDataMem_RENEW(st->data, n * st->rowsize > 0 ?
+                                         n * st->rowsize : 1);
+        if (data == NULL) {
+            _set_error(NULL, NULL, 0);
+            return -1;
+        }
+        st->data = data;
+        st->nrows_alloc = n;
+    }
+    row = st->data + st->nrows * st->rowsize;
+    if (st->structured) {
+        memset(row, 0, st->rowsize);
+    }
+
+    for (i = 0; i < nvalues; i++) {
+        const loadtxt_field *field;
+        npy_intp col = i;
+        char *dst;
+
+        if (st->usecols != NULL) {
+            col = st->usecols[i];
+            if (col < 0) {
+                col += ntokens;
+            }
+            if (col < 0 || col >= ntokens) {
+                _set_error(PyExc_IndexError,
+                           "usecols index out of range at line %ld",
+                           st->lineno);
+                return -1;
+            }
+        }
+        if (st->structured) {
+            field = &st->fields[i];
+            dst = row + field->offset;
+        }
+        else {
+            field = &st->fields[0];
+            dst = row + i * st->itemsize;
+        }
+        if (!_parse_field(field, st->tokens[col], st->token_lens[col], dst) &&
+                _convert_field(field, st->tokens[col],
+                               st->token_lens[col], dst) < 0) {
+            return -1;
+        }
+    }
+    st->nrows++;
+    return 1;
+}
+
+/*
+ * Parses the lines in buf[0:len], the last one without a newline only if
+ * final is set. Sets *used to the number of bytes consumed. Returns 1 if
+ * max_rows rows have been read, 0 if more are wanted and -1 on error.
+ */
+static int
+_parse_block(loadtxt_state *st, const char *buf, npy_intp len, int final,
+             npy_intp *used)
+{
+    const char *s = buf, *end = buf + len;
+
+    while (st->max_rows < 0 || st->nrows < st->max_rows) {
+        const char *newline = memchr(s, '\n', end - s);
+
+        if (newline == NULL) {
+            if (!final || s == end) {
+                break;
+            }
+            newline = end;
+        }
+        if (st->parse_line(st, s, newline - s) < 0) {
+            *used = s - buf;
+            return -1;
+        }
+        s = (newline < end) ? newline + 1 : end;
+    }
+    *used = s - buf;
+    return (st->max_rows >= 0 && st->nrows >= st->max_rows);
+}
+
+/*
+ * Feeds the lines in the blocks of bytes from the iterable chunks to
+ * st->parse_line, until the blocks run out or max_rows rows have been
+ * read. Returns the unused input as bytes, or NULL on error.
+ */
+static PyObject *
+_read_blocks(loadtxt_state *st, PyObject *chunks)
+{
+    PyObject *iter, *rest = NULL;
+    char *buf = NULL;
+    npy_intp buflen = 0, bufalloc = 0;
+    int done = 0;
+    NPY_BEGIN_THREADS_DEF;
+
+    iter = PyObject_GetIter(chunks);
+    if (iter == NULL) {
+        return NULL;
+    }
+
+    while (!done) {
+        PyObject *chunk = PyIter_Next(iter);
+        npy_intp used;
+        int final = (chunk == NULL);
+
+        if (chunk == NULL) {
+            if (PyErr_Occurred()) {
+                goto finish;
+            }
+        }
+        else {
+            npy_intp len;
+
+            if (!PyBytes_Check(chunk)) {
+                PyErr_SetString(PyExc_TypeError,
+                        "text reader input must be bytes");
+                Py_DECREF(chunk);
+                goto finish;
+            }
+            len = PyBytes_GET_SIZE(chunk);
+            if (buflen + len > bufalloc) {
+                char *tmp;
+
+                bufalloc = 2 * (buflen + len);
+                tmp = PyArray_realloc(buf, bufalloc);
+                if (tmp == NULL) {
+                    Py_DECREF(chunk);
+                    PyErr_NoMemory();
+                    goto finish;
+                }
+                buf = tmp;
+            }
+            memcpy(buf + buflen, PyBytes_AS_STRING(chunk), len);
+            buflen += len;
+            Py_DECREF(chunk);
+        }
+
+        NPY_BEGIN_THREADS;
+        done = _parse_block(st, buf, buflen, final, &used);
+        NPY_END_THREADS;
+        if (done < 0) {
+            goto finish;
+        }
+        buflen -= used;
+        memmove(buf, buf + used, buflen);
+        done = done || final;
+    }
+
+    rest = PyBytes_FromStringAndSize(buf, buflen);
+
+finish:
+    PyArray_free(buf);
+    Py_DECREF(iter);
+    return rest;
+}
+
+/* Sets the delimiter of st from None or non-empty bytes */
+static int
+_set_delimiter(loadtxt_state *st, PyObject *obj)
+{
+    if (obj == Py_None) {
+        return 0;
+    }
+    if (!PyBytes_Check(obj) || PyBytes_GET_SIZE(obj) == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                "delimiter must be None or non-empty bytes");
+        return -1;
+    }
+    st->delimiter = PyBytes_AS_STRING(obj);
+    st->delimiter_len = PyBytes_GET_SIZE(obj);
+    return 0;
+}
+
+/*
+ * Sets the comments of st from None or a sequence of bytes. The comments
+ * point into *seq, which the caller has to release.
+ */
+static int
+_set_comments(loadtxt_state *st, PyObject *obj, PyObject **seq)
+{
+    npy_intp i;
+
+    if (obj == Py_None) {
+        return 0;
+    }
+    *seq = PySequence_Fast(obj, "comments must be a sequence");
+    if (*seq == NULL) {
+        return -1;
+    }
+    st->ncomments = PySequence_Fast_GET_SIZE(*seq);
+    st->comments = PyArray_malloc((st->ncomments + 1) * sizeof(const char *));
+    st->comment_lens = PyArray_malloc((st->ncomments + 1) * sizeof(npy_intp));
+    if (st->comments == NULL || st->comment_lens == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < st->ncomments; i++) {
+        PyObject *comment = PySequence_Fast_GET_ITEM(*seq, i);
+
+        if (!PyBytes_Check(comment)) {
+            PyErr_SetString(PyExc_TypeError, "comments must be bytes");
+            return -1;
+        }
+        st->comments[i] = PyBytes_AS_STRING(comment);
+        st->comment_lens[i] = PyBytes_GET_SIZE(comment);
+    }
+    return 0;
+}
+
+/* Sets the columns of st to read from None or a sequence of integers */
+static int
+_set_usecols(loadtxt_state *st, PyObject *obj)
+{
+    PyObject *seq;
+    npy_intp i;
+
+    if (obj == Py_None) {
+        return 0;
+    }
+    seq = PySequence_Fast(obj, "usecols must be a sequence");
+    if (seq == NULL) {
+        return -1;
+    }
+    st->nusecols = PySequence_Fast_GET_SIZE(seq);
+    st->usecols = PyArray_malloc((st->nusecols + 1) * sizeof(npy_intp));
+    if (st->usecols == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < st->nusecols; i++) {
+        st->usecols[i] = PyArray_PyIntAsIntp(PySequence_Fast_GET_ITEM(seq, i));
+        if (error_converting(st->usecols[i])) {
+            Py_DECREF(seq);
+            return -1;
+        }
+    }
+    Py_DECREF(seq);
+    return 0;
+}
+
+/*
+ * Reads the data of numpy.loadtxt from an iterator over blocks of bytes.
+ *
+ * fields is a sequence of (offset, dtype, kind, converter) tuples, with
+ * one entry per leaf of a structured dtype in the order of its columns,
+ * or a single entry used for every column of a plain dtype. The rows are
+ * a 1-d array for a structured dtype and a 2-d array otherwise.
+ *
+ * Reading stops after max_rows rows if it isn't negative. It can be
+ * continued by passing the returned number of columns, line number and
+ * unused input on to the next call, with the input chained in front of
+ * the remaining blocks. If out is given, the rows are stored in it
+ * instead of a new array and at most len(out) rows are read.
+ *
+ * Returns a tuple (rows, ncols, lineno, rest).
+ */
+NPY_NO_EXPORT PyObject *
+arr_loadtxt(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"chunks", "dtype", "fields", "delimiter",
+                             "comments", "skiprows", "usecols", "max_rows",
+                             "ncols", "lineno", "out", NULL};
+    PyObject *chunks, *fields_obj, *delimiter_obj, *comments_obj;
+    PyObject *usecols_obj, *out_obj = Py_None;
+    PyArray_Descr *dtype = NULL;
+    npy_intp skiprows = 0, max_rows = -1, ncols = -1, lineno = 0;
+
+    PyObject *fields_seq = NULL, *comments_seq = NULL;
+    PyObject *ret = NULL, *rest = NULL;
+    PyArrayObject *out = NULL, *rows = NULL;
+    loadtxt_state st;
+    npy_intp i, dims[2];
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO&OOOnOn|nnO:_loadtxt",
+                kwlist, &chunks, PyArray_DescrConverter, &dtype,
+                &fields_obj, &delimiter_obj, &comments_obj, &skiprows,
+                &usecols_obj, &max_rows, &ncols, &lineno, &out_obj)) {
+        return NULL;
+    }
+
+    memset(&st, 0, sizeof(st));
+    st.parse_line = _parse_line;
+    st.skiprows = skiprows;
+    st.max_rows = max_rows;
+    st.lineno = lineno;
+    st.structured = PyDataType_HASFIELDS(dtype);
+    st.itemsize = dtype->elsize;
+    st.ncols = -1;
+    if (ncols >= 0) {
+        st.ncols = ncols;
+        st.rowsize = st.structured ? st.itemsize : ncols * st.itemsize;
+    }
+    st.out_ncols = -1;
+
+    if (out_obj != Py_None) {
+        if (!PyArray_Check(out_obj)) {
+            PyErr_SetString(PyExc_TypeError, "out must be an array");
+            goto finish;
+        }
+        out = (PyArrayObject *)out_obj;
+        if (!PyArray_ISCARRAY(out) ||
+                PyArray_NDIM(out) != (st.structured ? 1 : 2) ||
+                !PyArray_EquivTypes(PyArray_DESCR(out), dtype)) {
+            PyErr_SetString(PyExc_ValueError,
+                    "out must be a writeable C-contiguous array of the "
+                    "dtype, with 1 dimension for a structured dtype "
+                    "and 2 otherwise");
+            goto finish;
+        }
+        if (!st.structured) {
+            st.out_ncols = PyArray_DIM(out, 1);
+            if (st.ncols >= 0 && st.ncols != st.out_ncols) {
+                PyErr_SetString(PyExc_ValueError,
+                        "output array has the wrong number of columns");
+                goto finish;
+            }
+        }
+        st.data = PyArray_DATA(out);
+        st.nrows_alloc = PyArray_DIM(out, 0);
+        st.fixed = 1;
+        if (st.max_rows < 0 || st.max_rows > st.nrows_alloc) {
+            st.max_rows = st.nrows_alloc;
+        }
+    }
+
+    if (_set_delimiter(&st, delimiter_obj) < 0 ||
+            _set_comments(&st, comments_obj, &comments_seq) < 0 ||
+            _set_usecols(&st, usecols_obj) < 0) {
+        goto finish;
+    }
+
+    fields_seq = PySequence_Fast(fields_obj, "fields must be a sequence");
+    if (fields_seq == NULL) {
+        goto finish;
+    }
+    st.nfields = PySequence_Fast_GET_SIZE(fields_seq);
+    if (st.nfields == 0 || (!st.structured && st.nfields != 1)) {
+        PyErr_SetString(PyExc_ValueError,
+                "fields must match the leaves of the dtype");
+        goto finish;
+    }
+    st.fields = PyArray_malloc(st.nfields * sizeof(loadtxt_field));
+    if (st.fields == NULL) {
+        PyErr_NoMemory();
+        goto finish;
+    }
+    for (i = 0; i < st.nfields; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(fields_seq, i);
+        loadtxt_field *field = &st.fields[i];
+        char kind;
+
+        if (!PyArg_ParseTuple(item, "nO!cO", &field->offset,
+                              &PyArrayDescr_Type, &field->descr,
+                              &kind, &field->converter)) {
+            goto finish;
+        }
+        field->kind = kind;
+        field->fill = NULL;
+        field->scratch = NULL;
+        if (field->offset < 0 ||
+                field->offset + field->descr->elsize > st.itemsize ||
+                field->descr->elsize > 16 ||
+                (field->kind == LOADTXT_INT64 &&
+                 field->descr->elsize != sizeof(npy_int64)) ||
+                (field->kind != LOADTXT_BOOL &&
+                 field->kind != LOADTXT_INT64 &&
+                 field->kind != LOADTXT_INTEGER &&
+                 field->kind != LOADTXT_FLOAT)) {
+            PyErr_SetString(PyExc_ValueError,
+                    "invalid field for the text reader");
+            goto finish;
+        }
+    }
+
+    rest = _read_blocks(&st, chunks);
+    if (rest == NULL) {
+        goto finish;
+    }
+
+    dims[0] = st.nrows;
+    dims[1] = st.ncols > 0 ? st.ncols : 0;
+    if (out != NULL) {
+        if (st.nrows == PyArray_DIM(out, 0)) {
+            Py_INCREF(out);
+            rows = out;
+        }
+        else {
+            dims[1] = st.structured ? 0 : PyArray_DIM(out, 1);
+            Py_INCREF(dtype);
+            rows = (PyArrayObject *)PyArray_NewFromDescr(&PyArray_Type,
+                                dtype, PyArray_NDIM(out), dims, NULL,
+                                st.data, NPY_ARRAY_CARRAY, NULL);
+            if (rows == NULL) {
+                goto finish;
+            }
+            Py_INCREF(out);
+            if (PyArray_SetBaseObject(rows, (PyObject *)out) < 0) {
+                goto finish;
+            }
+        }
+    }
+    else {
+        /* give back what the doubling of the buffer didn't use */
+        char *data = PyDataMem_RENEW(st.data, st.nrows * st.rowsize > 0 ?
+                                              st.nrows * st.rowsize : 1);
+        if (data == NULL) {
+            PyErr_NoMemory();
+            goto finish;
+        }
+        st.data = data;
+        Py_INCREF(dtype);
+        rows = (PyArrayObject *)PyArray_NewFromDescr(&PyArray_Type, dtype,
+                                st.structured ? 1 : 2, dims, NULL,
+                                st.data, NPY_ARRAY_CARRAY, NULL);
+        if (rows == NULL) {
+            goto finish;
+        }
+        PyArray_ENABLEFLAGS(rows, NPY_ARRAY_OWNDATA);
+        st.data = NULL;
+    }
+    ret = Py_BuildValue("OnnO", rows, st.ncols, st.lineno, rest);
+
+finish:
+    if (!st.fixed) {
+        PyDataMem_FREE(st.data);
+    }
+    Py_XDECREF(rows);
+    free((void *)st.tokens);
+    free(st.token_lens);
+    PyArray_free((void *)st.comments);
+    PyArray_free(st.comment_lens);
+    PyArray_free(st.usecols);
+    PyArray_free(st.fields);
+    Py_XDECREF(rest);
+    Py_XDECREF(fields_seq);
+    Py_XDECREF(comments_seq);
+    Py_XDECREF(dtype);
+    return ret;
+}
+
+
+typedef struct {
+    /* first member, so that the line parser can be handed the base */
+    loadtxt_state base;
+    int autostrip;
+
+    /* the missing values of column i are missing[missing_start[i]:...] */
+    const char **missing;
+    npy_intp *missing_lens;
+    npy_intp *missing_start;
+
+    /* the table of tokens, token k is text[offsets[k]:offsets[k + 1]] */
+    char *text;
+    npy_intp textlen;
+    npy_intp textalloc;
+    npy_intp *offsets;
+    npy_bool *mask;
+    npy_intp ncells_alloc;
+
+    /* pairs of line number and number of values of the invalid lines */
+    npy_intp *invalid;
+    npy_intp ninvalid;
+    npy_intp ninvalid_alloc;
+} genfromtxt_state;
+
+/* A table of tokens from _genfromtxt_split, as passed back from Python */
+typedef struct {
+    const char *text;
+    const npy_intp *offsets;
+    const npy_bool *mask;
+    npy_intp nrows;
+    npy_intp ncols;
+} genfromtxt_table;
+
+/* Strips ASCII whitespace from s[0:*len] like bytes.strip() */
+static const char *
+_strip_token(const char *s, npy_intp *len)
+{
+    const char *end = s + *len;
+
+    while (s < end && LOADTXT_IS_SPACE(*s)) {
+        s++;
+    }
+    while (end > s && LOADTXT_IS_SPACE(end[-1])) {
+        end--;
+    }
+    *len = end - s;
+    return s;
+}
+
+/* Returns whether s[0:len] is only ASCII whitespace */
+static int
+_is_blank(const char *s, npy_intp len)
+{
+    npy_intp i;
+
+    for (i = 0; i < len; i++) {
+        if (!LOADTXT_IS_SPACE(s[i])) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Returns whether the stripped token is a missing value of the column */
+static int
+_is_missing(const genfromtxt_state *st, npy_intp col, const char *tok,
+            npy_intp len)
+{
+    npy_intp i;
+
+    tok = _strip_token(tok, &len);
+    for (i = st->missing_start[col]; i < st->missing_start[col + 1]; i++) {
+        if (st->missing_lens[i] == len &&
+                memcmp(st->missing[i], tok, len) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Records the current line as invalid, returns -1 if out of memory */
+static int
+_add_invalid(genfromtxt_state *st, npy_intp nvalues)
+{
+    if (st->ninvalid == st->ninvalid_alloc) {
+        npy_intp n = st->ninvalid_alloc ? 2*st->ninvalid_alloc : 16;
+        npy_intp *invalid = realloc(st->invalid, 2 * n * sizeof(npy_intp));
+
+        if (invalid == NULL) {
+            return -1;
+        }
+        st->invalid = invalid;
+        st->ninvalid_alloc = n;
+    }
+    st->invalid[2*st->ninvalid] = st->base.lineno;
+    st->invalid[2*st->ninvalid + 1] = nvalues;
+    st->ninvalid++;
+    return 0;
+}
+
+/*
+ * Splits the line s[0:len] without its newline like the LineSplitter of
+ * genfromtxt and appends its tokens to the table, or records it as
+ * invalid if it has the wrong number of values. Returns 1 if a row was
+ * added, 0 if not and -1 on error. Doesn't need the GIL.
+ */
+static int
+_genfromtxt_parse_line(loadtxt_state *base, const char *s, npy_intp len)
+{
+    genfromtxt_state *st = (genfromtxt_state *)base;
+    const char *end = s + len;
+    npy_intp i, ntokens, ncells, size = 0;
+
+    base->lineno++;
+    for (i = 0; i < base->ncomments; i++) {
+        const char *comment = _find_bytes(s, end - s, base->comments[i],
+                                          base->comment_lens[i]);
+        if (comment != NULL) {
+            end = comment;
+        }
+    }
+    while (s < end && (*s == ' ' || *s == '\r' || *s == '\n')) {
+        s++;
+    }
+    while (end > s && (end[-1] == ' ' || end[-1] == '\r' ||
+                       end[-1] == '\n')) {
+        end--;
+    }
+    if (s == end) {
+        return 0;
+    }
+    ntokens = _split_line(base, s, end);
+    if (ntokens < 0) {
+        goto fail;
+    }
+    if (ntokens == 0) {
+        return 0;
+    }
+    if (st->autostrip) {
+        for (i = 0; i < ntokens; i++) {
+            base->tokens[i] = _strip_token(base->tokens[i],
+                                           &base->token_lens[i]);
+        }
+    }
+
+    /* negative columns count from the end, like list indices */
+    for (i = 0; i < base->ncols; i++) {
+        npy_intp col = i;
+
+        if (base->usecols != NULL) {
+            col = base->usecols[i];
+            if (col < 0) {
+                col += ntokens;
+            }
+            if (col < 0 || col >= ntokens) {
+                break;
+            }
+        }
+        size += base->token_lens[col];
+    }
+    if (i < base->ncols ||
+            (base->usecols == NULL && ntokens != base->ncols)) {
+        if (_add_invalid(st, ntokens) < 0) {
+            goto fail;
+        }
+        return 0;
+    }
+
+    ncells = (base->nrows + 1) * base->ncols;
+    if (ncells > st->ncells_alloc) {
+        npy_intp n = ncells > 512 ? 2 * ncells : 1024;
+        npy_intp *offsets;
+        npy_bool *mask;
+
+        offsets = PyDataMem_RENEW(st->offsets, (n + 1) * sizeof(npy_intp));
+        if (offsets == NULL) {
+            goto fail;
+        }
+        st->offsets = offsets;
+        mask = PyDataMem_RENEW(st->mask, n);
+        if (mask == NULL) {
+            goto fail;
+        }
+        st->mask = mask;
+        st->ncells_alloc = n;
+        st->offsets[0] = 0;
+    }
+    if (st->textlen + size > st->textalloc) {
+        npy_intp n = 2 * (st->textlen + size) + LOADTXT_INITIAL_BUFSIZE;
+        char *text = PyDataMem_RENEW(st->text, n);
+
+        if (text == NULL) {
+            goto fail;
+        }
+        st->text = text;
+        st->textalloc = n;
+    }
+
+    ncells = base->nrows * base->ncols;
+    for (i = 0; i < base->ncols; i++) {
+        npy_intp col = i;
+        const char *tok;
+        npy_intp toklen;
+
+        if (base->usecols != NULL) {
+            col = base->usecols[i];
+            if (col < 0) {
+                col += ntokens;
+            }
+        }
+        tok = base->tokens[col];
+        toklen = base->token_lens[col];
+        memcpy(st->text + st->textlen, tok, toklen);
+        st->textlen += toklen;
+        st->offsets[ncells + i + 1] = st->textlen;
+        st->mask[ncells + i] = _is_missing(st, i, tok, toklen);
+    }
+    base->nrows++;
+    return 1;
+
+fail:
+    _set_error(NULL, NULL, 0);
+    return -1;
+}
+
+/*
+ * Splits the lines in the blocks of bytes from the iterable chunks for
+ * numpy.genfromtxt into a table of ncols tokens per row.
+ *
+ * The lines are split like its LineSplitter, with comments and delimiter
+ * given as for _loadtxt, then the columns in usecols are
+ * selected. missing_values holds the sequence of missing values for each
+ * selected column, which are matched against the tokens without
+ * surrounding whitespace. Reading stops after max_rows rows if it isn't
+ * negative, lineno is the number of the line before the first one.
+ *
+ * Returns a tuple (text, offsets, mask, invalid). text holds the tokens,
+ * token i of row j is text[offsets[k]:offsets[k + 1]] with k = j*ncols + i
+ * and mask[j, i] tells whether it is missing. invalid is a list of
+ * (line number, number of values) for the lines with the wrong number of
+ * values, which are skipped.
+ */
+NPY_NO_EXPORT PyObject *
+arr_genfromtxt_split(PyObject *NPY_UNUSED(self), PyObject *args,
+                     PyObject *kwds)
+{
+    static char *kwlist[] = {"chunks", "ncols", "delimiter", "comments",
+                             "autostrip", "usecols", "missing_values",
+                             "max_rows", "lineno", NULL};
+    PyObject *chunks, *delimiter_obj, *comments_obj, *usecols_obj;
+    PyObject *missing_obj;
+    npy_intp ncols, max_rows = -1, lineno = 0;
+    int autostrip;
+
+    PyObject *comments_seq = NULL, *missing_seq = NULL, *missing = NULL;
+    PyObject *rest = NULL, *invalid = NULL, *ret = NULL;
+    PyArrayObject *text = NULL, *offsets = NULL, *mask = NULL;
+    genfromtxt_state st;
+    npy_intp i, j, nmissing, dims[2];
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                "OnOOiOO|nn:_genfromtxt_split", kwlist,
+                &chunks, &ncols, &delimiter_obj, &comments_obj, &autostrip,
+                &usecols_obj, &missing_obj, &max_rows, &lineno)) {
+        return NULL;
+    }
+
+    memset(&st, 0, sizeof(st));
+    st.base.parse_line = _genfromtxt_parse_line;
+    st.base.max_rows = max_rows;
+    st.base.lineno = lineno;
+    st.base.ncols = ncols;
+    st.autostrip = autostrip;
+
+    if (_set_delimiter(&st.base, delimiter_obj) < 0 ||
+            _set_comments(&st.base, comments_obj, &comments_seq) < 0 ||
+            _set_usecols(&st.base, usecols_obj) < 0) {
+        goto finish;
+    }
+    if (ncols < 0 ||
+            (st.base.usecols != NULL && st.base.nusecols != ncols)) {
+        PyErr_SetString(PyExc_ValueError,
+                "ncols must be the number of columns to read");
+        goto finish;
+    }
+
+    /* keep the missing values in one list, so that they stay alive */
+    missing_seq = PySequence_Fast(missing_obj,
+                                  "missing_values must be a sequence");
+    if (missing_seq == NULL) {
+        goto finish;
+    }
+    if (PySequence_Fast_GET_SIZE(missing_seq) != ncols) {
+        PyErr_SetString(PyExc_ValueError,
+                "missing_values must have ncols entries");
+        goto finish;
+    }
+    missing = PyList_New(0);
+    if (missing == NULL) {
+        goto finish;
+    }
+    st.missing_start = PyArray_malloc((ncols + 1) * sizeof(npy_intp));
+    if (st.missing_start == NULL) {
+        PyErr_NoMemory();
+        goto finish;
+    }
+    for (i = 0; i < ncols; i++) {
+        PyObject *values = PySequence_Fast(
+                                PySequence_Fast_GET_ITEM(missing_seq, i),
+                                "missing_values must hold sequences");
+        npy_intp n;
+        int err;
+
+        if (values == NULL) {
+            goto finish;
+        }
+        n = PyList_GET_SIZE(missing);
+        st.missing_start[i] = n;
+        err = PyList_SetSlice(missing, n, n, values);
+        Py_DECREF(values);
+        if (err < 0) {
+            goto finish;
+        }
+    }
+    nmissing = PyList_GET_SIZE(missing);
+    st.missing_start[ncols] = nmissing;
+    st.missing = PyArray_malloc((nmissing + 1) * sizeof(const char *));
+    st.missing_lens = PyArray_malloc((nmissing + 1) * sizeof(npy_intp));
+    if (st.missing == NULL || st.missing_lens == NULL) {
+        PyErr_NoMemory();
+        goto finish;
+    }
+    for (i = 0; i < nmissing; i++) {
+        PyObject *value = PyList_GET_ITEM(missing, i);
+
+        if (!PyBytes_Check(value)) {
+            PyErr_SetString(PyExc_TypeError,
+                    "missing values must be bytes");
+            goto finish;
+        }
+        st.missing[i] = PyBytes_AS_STRING(value);
+        st.missing_lens[i] = PyBytes_GET_SIZE(value);
+    }
+
+    rest = _read_blocks(&st.base, chunks);
+    if (rest == NULL) {
+        goto finish;
+    }
+
+    invalid = PyList_New(st.ninvalid);
+    if (invalid == NULL) {
+        goto finish;
+    }
+    for (i = 0; i < st.ninvalid; i++) {
+        PyObject *item = Py_BuildValue("nn", st.invalid[2*i],
+                                       st.invalid[2*i + 1]);
+        if (item == NULL) {
+            goto finish;
+        }
+        PyList_SET_ITEM(invalid, i, item);
+    }
+
+    /* the arrays take over the buffers, which have to exist */
+    dims[0] = st.base.nrows;
+    dims[1] = ncols;
+    j = dims[0] * dims[1];
+    if (st.offsets == NULL) {
+        st.offsets = PyDataMem_NEW(sizeof(npy_intp));
+        st.mask = PyDataMem_NEW(1);
+        if (st.offsets == NULL || st.mask == NULL) {
+            PyErr_NoMemory();
+            goto finish;
+        }
+        st.offsets[0] = 0;
+    }
+    if (st.text == NULL) {
+        st.text = PyDataMem_NEW(1);
+        if (st.text == NULL) {
+            PyErr_NoMemory();
+            goto finish;
+        }
+    }
+    text = (PyArrayObject *)PyArray_New(&PyArray_Type, 1, &st.textlen,
+                                        NPY_UINT8, NULL, st.text, 0,
+                                        NPY_ARRAY_CARRAY, NULL);
+    if (text == NULL) {
+        goto finish;
+    }
+    PyArray_ENABLEFLAGS(text, NPY_ARRAY_OWNDATA);
+    st.text = NULL;
+    i = j + 1;
+    offsets = (PyArrayObject *)PyArray_New(&PyArray_Type, 1, &i, NPY_INTP,
+                                           NULL, st.offsets, 0,
+                                           NPY_ARRAY_CARRAY, NULL);
+    if (offsets == NULL) {
+        goto finish;
+    }
+    PyArray_ENABLEFLAGS(offsets, NPY_ARRAY_OWNDATA);
+    st.offsets = NULL;
+    mask = (PyArrayObject *)PyArray_New(&PyArray_Type, 2, dims, NPY_BOOL,
+                                        NULL, st.mask, 0, NPY_ARRAY_CARRAY,
+                                        NULL);
+    if (mask == NULL) {
+        goto finish;
+    }
+    PyArray_ENABLEFLAGS(mask, NPY_ARRAY_OWNDATA);
+    st.mask = NULL;
+
+    ret = Py_BuildValue("OOOO", text, offsets, mask, invalid);
+
+finish:
+    PyDataMem_FREE(st.text);
+    PyDataMem_FREE(st.offsets);
+    PyDataMem_FREE(st.mask);
+    free(st.invalid);
+    free((void *)st.base.tokens);
+    free(st.base.token_lens);
+    PyArray_free((void *)st.base.comments);
+    PyArray_free(st.base.comment_lens);
+    PyArray_free(st.base.usecols);
+    PyArray_free((void *)st.missing);
+    PyArray_free(st.missing_lens);
+    PyArray_free(st.missing_start);
+    Py_XDECREF(text);
+    Py_XDECREF(offsets);
+    Py_XDECREF(mask);
+    Py_XDECREF(invalid);
+    Py_XDECREF(rest);
+    Py_XDECREF(missing);
+    Py_XDECREF(missing_seq);
+    Py_XDECREF(comments_seq);
+    return ret;
+}
+
+/* Gets a table of tokens from the arrays returned by _genfromtxt_split */
+static int
+_get_table(genfromtxt_table *table, PyArrayObject *text,
+           PyArrayObject *offsets, PyArrayObject *mask)
+{
+    const npy_intp *off;
+    npy_intp i, ncells;
+
+    if (PyArray_NDIM(text) != 1 || PyArray_TYPE(text) != NPY_UINT8 ||
+            !PyArray_ISCARRAY_RO(text) ||
+            PyArray_NDIM(offsets) != 1 || PyArray_TYPE(offsets) != NPY_INTP ||
+            !PyArray_ISCARRAY_RO(offsets) ||
+            PyArray_NDIM(mask) != 2 || PyArray_TYPE(mask) != NPY_BOOL ||
+            !PyArray_ISCARRAY_RO(mask) ||
+            PyArray_DIM(offsets, 0) != PyArray_SIZE(mask) + 1) {
+        goto fail;
+    }
+    ncells = PyArray_SIZE(mask);
+    off = PyArray_DATA(offsets);
+    if (off[0] < 0 || off[ncells] > PyArray_DIM(text, 0)) {
+        goto fail;
+    }
+    for (i = 0; i < ncells; i++) {
+        if (off[i + 1] < off[i]) {
+            goto fail;
+        }
+    }
+    table->text = PyArray_DATA(text);
+    table->offsets = off;
+    table->mask = PyArray_DATA(mask);
+    table->nrows = PyArray_DIM(mask, 0);
+    table->ncols = PyArray_DIM(mask, 1);
+    return 0;
+
+fail:
+    PyErr_SetString(PyExc_ValueError,
+            "text, offsets and mask must be as returned by "
+            "_genfromtxt_split");
+    return -1;
+}
+
+/* The classes of tokens which _genfromtxt_infer recognizes natively */
+enum {
+    GENFROMTXT_BOOL,
+    GENFROMTXT_INT,
+    GENFROMTXT_FLOAT,
+    GENFROMTXT_NCLASSES
+};
+
+/* Returns the class of a token, or -1 if it has to be classified in Python */
+static int
+_token_class(const char *tok, npy_intp len)
+{
+    const npy_uint8 *s = (const npy_uint8 *)tok;
+    npy_longlong ivalue;
+    double dvalue;
+    npy_intp i;
+
+    /* the parsers ignore these, the conversions may not */
+    if (len == 0 || LOADTXT_IS_SPACE(tok[0]) ||
+            LOADTXT_IS_SPACE(tok[len - 1]) || tok[len - 1] == '\0') {
+        return -1;
+    }
+    if (_str2bool(tok, len) >= 0) {
+        return GENFROMTXT_BOOL;
+    }
+    i = (tok[0] == '+' || tok[0] == '-');
+    while (i < len && tok[i] >= '0' && tok[i] <= '9') {
+        i++;
+    }
+    if (i == len) {
+        if (STRING_parse_longlong(s, len, &ivalue) &&
+                ivalue >= NPY_MIN_LONG && ivalue <= NPY_MAX_LONG) {
+            return GENFROMTXT_INT;
+        }
+        return -1;
+    }
+    if (STRING_parse_double(s, len, &dvalue)) {
+        return GENFROMTXT_FLOAT;
+    }
+    return -1;
+}
+
+/*
+ * Calls accepts(token, status) with the GIL released, returns whether the
+ * conversion accepts the token or -1 on error.
+ */
+static int
+_accepts_token(PyObject *accepts, const char *tok, npy_intp len,
+               npy_intp status)
+{
+    PyObject *token, *value = NULL;
+    int ret = -1;
+    NPY_ALLOW_C_API_DEF;
+
+    NPY_ALLOW_C_API;
+    token = PyBytes_FromStringAndSize(tok, len);
+    if (token != NULL) {
+        value = PyObject_CallFunction(accepts, "On", token, status);
+        Py_DECREF(token);
+    }
+    if (value != NULL) {
+        ret = PyObject_IsTrue(value);
+        Py_DECREF(value);
+    }
+    NPY_DISABLE_C_API;
+    return ret;
+}
+
+/*
+ * Upgrades the converters of numpy.genfromtxt with dtype=None for the
+ * columns of a table from _genfromtxt_split, like iterupgrade does.
+ *
+ * The conversions of numpy.lib._iotools.StringConverter are numbered by
+ * their status, the last one accepting anything. statuses holds the
+ * status of each converter, which goes up until the conversion accepts
+ * every token of the column, starting over with each upgrade. Missing
+ * tokens are accepted by all. classes holds bit masks of the statuses
+ * accepting TRUE or FALSE in any case, an integer in the range of a C
+ * long and another number of the form float() accepts, for other tokens
+ * accepts(token, status) is called.
+ *
+ * Returns a list with a tuple (status, bool_missing) for each column,
+ * bool_missing telling whether a missing token isn't TRUE or FALSE.
+ */
+NPY_NO_EXPORT PyObject *
+arr_genfromtxt_infer(PyObject *NPY_UNUSED(self), PyObject *args,
+                     PyObject *kwds)
+{
+    static char *kwlist[] = {"text", "offsets", "mask", "statuses",
+                             "nstatus", "classes", "accepts", NULL};
+    PyArrayObject *text, *offsets, *mask;
+    PyObject *statuses_obj, *statuses = NULL, *accepts, *ret = NULL;
+    npy_intp nstatus;
+    unsigned long classes[GENFROMTXT_NCLASSES];
+    genfromtxt_table table;
+    npy_intp row, col;
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                "O!O!O!On(kkk)O:_genfromtxt_infer", kwlist,
+                &PyArray_Type, &text, &PyArray_Type, &offsets,
+                &PyArray_Type, &mask, &statuses_obj, &nstatus,
+                &classes[GENFROMTXT_BOOL], &classes[GENFROMTXT_INT],
+                &classes[GENFROMTXT_FLOAT], &accepts)) {
+        return NULL;
+    }
+    if (_get_table(&table, text, offsets, mask) < 0) {
+        return NULL;
+    }
+    statuses = PySequence_Fast(statuses_obj, "statuses must be a sequence");
+    if (statuses == NULL) {
+        return NULL;
+    }
+    if (PySequence_Fast_GET_SIZE(statuses) != table.ncols ||
+            nstatus < 1 || nstatus > (npy_intp)(8 * sizeof(unsigned long))) {
+        PyErr_SetString(PyExc_ValueError,
+                "statuses must have an entry for each column");
+        goto finish;
+    }
+
+    ret = PyList_New(table.ncols);
+    if (ret == NULL) {
+        goto finish;
+    }
+    for (col = 0; col < table.ncols; col++) {
+        npy_intp status = PyArray_PyIntAsIntp(
+                                PySequence_Fast_GET_ITEM(statuses, col));
+        int bool_missing = 0, err = 0;
+        PyObject *item;
+
+        if (error_converting(status)) {
+            goto fail;
+        }
+        NPY_BEGIN_THREADS;
+        for (row = 0; row < table.nrows && status < nstatus - 1; row++) {
+            npy_intp k = row * table.ncols + col;
+            const char *tok = table.text + table.offsets[k];
+            npy_intp len = table.offsets[k + 1] - table.offsets[k];
+            int cls, ok;
+
+            if (table.mask[k]) {
+                bool_missing |= (_str2bool(tok, len) < 0);
+                continue;
+            }
+            cls = _token_class(tok, len);
+            if (cls >= 0) {
+                ok = (classes[cls] >> status) & 1;
+            }
+            else {
+                ok = _accepts_token(accepts, tok, len, status);
+                if (ok < 0) {
+                    err = 1;
+                    break;
+                }
+            }
+            if (!ok) {
+                /* the statuses this token fails for can be skipped */
+                do {
+                    status++;
+                } while (cls >= 0 && status < nstatus - 1 &&
+                         !((classes[cls] >> status) & 1));
+                row = -1;
+            }
+        }
+        NPY_END_THREADS;
+        if (err) {
+            goto fail;
+        }
+        item = Py_BuildValue("nO", status, bool_missing ? Py_True : Py_False);
+        if (item == NULL) {
+            goto fail;
+        }
+        PyList_SET_ITEM(ret, col, item);
+    }
+    goto finish;
+
+fail:
+    Py_CLEAR(ret);
+finish:
+    Py_DECREF(statuses);
+    return ret;
+}
+
+/*
+ * Converts the first nrows rows of a table from _genfromtxt_split into a
+ * new 1-d array of dtype, for numpy.genfromtxt.
+ *
+ * fields holds an (offset, dtype, kind, converter, fill) tuple for each
+ * column, with the converter being that of genfromtxt. Tokens which
+ * aren't parsed natively are passed to the converter, except for blank
+ * missing ones, which the conversions don't accept. These are set to the
+ * fill bytes, the default of the converter, unless fill is None.
+ */
+NPY_NO_EXPORT PyObject *
+arr_genfromtxt_convert(PyObject *NPY_UNUSED(self), PyObject *args,
+                       PyObject *kwds)
+{
+    static char *kwlist[] = {"text", "offsets", "mask", "nrows", "dtype",
+                             "fields", NULL};
+    static const char kinds[] = {LOADTXT_BOOL, LOADTXT_INT64,
+                                 LOADTXT_INTEGER, LOADTXT_FLOAT,
+                                 LOADTXT_STR2BOOL, LOADTXT_PYINT,
+                                 LOADTXT_BYTES, LOADTXT_CONVERT, 0};
+    PyArrayObject *text, *offsets, *mask, *ret = NULL;
+    PyObject *fields_obj, *fields_seq = NULL;
+    PyArray_Descr *dtype = NULL;
+    loadtxt_field *fields = NULL;
+    genfromtxt_table table;
+    npy_intp i, nfields = 0, nrows, row, rowsize;
+    char *data;
+    int err = 0;
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                "O!O!O!nO&O:_genfromtxt_convert", kwlist,
+                &PyArray_Type, &text, &PyArray_Type, &offsets,
+                &PyArray_Type, &mask, &nrows,
+                PyArray_DescrConverter, &dtype, &fields_obj)) {
+        return NULL;
+    }
+    if (_get_table(&table, text, offsets, mask) < 0) {
+        goto finish;
+    }
+    if (nrows < 0 || nrows > table.nrows || PyDataType_REFCHK(dtype)) {
+        PyErr_SetString(PyExc_ValueError,
+                "invalid number of rows or dtype for the text reader");
+        goto finish;
+    }
+    rowsize = dtype->elsize;
+
+    fields_seq = PySequence_Fast(fields_obj, "fields must be a sequence");
+    if (fields_seq == NULL) {
+        goto finish;
+    }
+    if (PySequence_Fast_GET_SIZE(fields_seq) != table.ncols) {
+        PyErr_SetString(PyExc_ValueError,
+                "fields must have an entry for each column");
+        goto finish;
+    }
+    fields = PyArray_malloc((table.ncols + 1) * sizeof(loadtxt_field));
+    if (fields == NULL) {
+        PyErr_NoMemory();
+        goto finish;
+    }
+    for (i = 0; i < table.ncols; i++) {
+        fields[i].scratch = NULL;
+    }
+    nfields = table.ncols;
+    for (i = 0; i < table.ncols; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(fields_seq, i);
+        loadtxt_field *field = &fields[i];
+        PyObject *fill;
+        npy_intp elsize;
+        char kind;
+
+        if (!PyArg_ParseTuple(item, "nO!cOO", &field->offset,
+                              &PyArrayDescr_Type, &field->descr,
+                              &kind, &field->converter, &fill)) {
+            goto finish;
+        }
+        field->kind = kind;
+        field->fill = NULL;
+        field->scratch = NULL;
+        elsize = field->descr->elsize;
+        if (fill != Py_None && PyBytes_Check(fill) &&
+                PyBytes_GET_SIZE(fill) == elsize) {
+            field->fill = PyBytes_AS_STRING(fill);
+        }
+        if (field->offset < 0 || field->offset + elsize > rowsize ||
+                kind == 0 || strchr(kinds, kind) == NULL ||
+                (fill != Py_None && field->fill == NULL) ||
+                (kind == LOADTXT_BYTES &&
+                 field->descr->type_num != NPY_STRING) ||
+                (kind == LOADTXT_STR2BOOL &&
+                 field->descr->type_num != NPY_BOOL) ||
+                (kind == LOADTXT_INT64 && elsize != sizeof(npy_int64))) {
+            PyErr_SetString(PyExc_ValueError,
+                    "invalid field for the text reader");
+            goto finish;
+        }
+        /* setitem of complex and other types needs an array */
+        if (kind != LOADTXT_BYTES) {
+            Py_INCREF(field->descr);
+            field->scratch = (PyArrayObject *)PyArray_NewFromDescr(
+                                &PyArray_Type, field->descr, 0, NULL,
+                                NULL, NULL, 0, NULL);
+            if (field->scratch == NULL) {
+                goto finish;
+            }
+        }
+    }
+
+    Py_INCREF(dtype);
+    ret = (PyArrayObject *)PyArray_NewFromDescr(&PyArray_Type, dtype, 1,
+                                                &nrows, NULL, NULL, 0, NULL);
+    if (ret == NULL) {
+        goto finish;
+    }
+    data = PyArray_DATA(ret);
+    memset(data, 0, PyArray_NBYTES(ret));
+
+    /* by columns, calling the converters in the order genfromtxt did */
+    NPY_BEGIN_THREADS;
+    for (i = 0; i < table.ncols && !err; i++) {
+        for (row = 0; row < nrows; row++) {
+            const loadtxt_field *field = &fields[i];
+            npy_intp k = row * table.ncols + i;
+            const char *tok = table.text + table.offsets[k];
+            npy_intp len = table.offsets[k + 1] - table.offsets[k];
+            char *dst = data + row * rowsize + field->offset;
+
+            if (_parse_field(field, tok, len, dst)) {
+                continue;
+            }
+            if (table.mask[k] && field->fill != NULL &&
+                    _is_blank(tok, len)) {
+                memcpy(dst, field->fill, field->descr->elsize);
+            }
+            else if (_convert_field(field, tok, len, dst) < 0) {
+                err = 1;
+                break;
+            }
+        }
+    }
+    NPY_END_THREADS;
+    if (err) {
+        Py_CLEAR(ret);
+    }
+
+finish:
+    for (i = 0; fields != NULL && i < nfields; i++) {
+        Py_XDECREF(fields[i].scratch);
+    }
+    PyArray_free(fields);
+    Py_XDECREF(fields_seq);
+    Py_XDECREF(dtype);
+    return (PyObject *)ret;
+}
@@ -0,0 +1,19 @@
+#ifndef _NPY_TEXTREADING_H_
+#define _NPY_TEXTREADING_H_
+
+NPY_NO_EXPORT PyObject *
+arr_loadtxt(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds);
+
+NPY_NO_EXPORT PyObject *
+arr_genfromtxt_split(PyObject *NPY_UNUSED(self), PyObject *args,
+                     PyObject *kwds);
+
+NPY_NO_EXPORT PyObject *
+arr_genfromtxt_infer(PyObject *NPY_UNUSED(self), PyObject *args,
+                     PyObject *kwds);
+
+NPY_NO_EXPORT PyObject *
+arr_genfromtxt_convert(PyObject *NPY_UNUSED(self), PyObject *args,
+                       PyObject *kwds);
+
+#endif
@@ -0,0 +1,1179 @@
+/*
+ * Formatting of numbers as text for numpy.savetxt and ndarray.tofile.
+ *
+ * The output is the same as that of Python's %-formatting and repr, but
+ * produced with the C library's printf and an integer shortest-digits
+ * generator, so that it needs no Python objects and can run with the GIL
+ * released. Values for which the two might differ (non-finite values,
+ * negative numbers in hexadecimal, ...) are reported to the caller, which
+ * formats them with Python.
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <locale.h>
+
+#define NPY_NO_DEPRECATED_API NPY_API_VERSION
+#define _MULTIARRAYMODULE
+#include "numpy/arrayobject.h"
+#include "numpy/halffloat.h"
+#include "numpy/npy_math.h"
+
+#include "npy_config.h"
+
+#include "npy_pycompat.h"
+
+#include "textwriting.h"
+
+#ifdef _MSC_VER
+#define TEXTFMT_LL "I64"
+#else
+#define TEXTFMT_LL "ll"
+#endif
+
+/* Largest width and precision accepted in a conversion */
+#define TEXTFMT_MAXDIGITS 3
+/* Room for any single formatted value */
+#define TEXTFMT_MAXFIELD 2048
+/* Rows per block of savetxt are bounded by the number of bytes */
+#define TEXTFMT_MAXBLOCK (1 << 22)
+
+/* Returns 0 on success, -1 if out of memory. Doesn't need the GIL. */
+static int
+_textbuf_reserve(npy_textbuf *buf, npy_intp n)
+{
+    if (buf->len + n > buf->alloc) {
+        npy_intp alloc = buf->alloc ? buf->alloc : 4096;
+        char *data;
+
+        while (alloc < buf->len + n) {
+            alloc *= 2;
+        }
+        data = realloc(buf->data, alloc);
+        if (data == NULL) {
+            return -1;
+        }
+        buf->data = data;
+        buf->alloc = alloc;
+    }
+    return 0;
+}
+
+/* Returns 0 on success, -1 if out of memory. Doesn't need the GIL. */
+NPY_NO_EXPORT int
+npy_textbuf_write(npy_textbuf *buf, const char *s, npy_intp len)
+{
+    if (_textbuf_reserve(buf, len) < 0) {
+        return -1;
+    }
+    memcpy(buf->data + buf->len, s, len);
+    buf->len += len;
+    return 0;
+}
+
+NPY_NO_EXPORT void
+npy_textbuf_clear(npy_textbuf *buf)
+{
+    free(buf->data);
+    buf->data = NULL;
+    buf->len = 0;
+    buf->alloc = 0;
+}
+
+/*
+ * Whether printf and strtod use the conventions of Python's formatting in
+ * the current locale.
+ */
+static int
+_locale_usable(void)
+{
+#if defined(_MSC_VER) && _MSC_VER < 1900
+    /* older runtimes print at least three exponent digits */
+    return 0;
+#else
+    struct lconv *lc = localeconv();
+
+    return lc->decimal_point[0] == '.' && lc->decimal_point[1] == '\0';
+#endif
+}
+
+/* Reads at most TEXTFMT_MAXDIGITS digits, returns -1 if there are more */
+static int
+_parse_digits(const char **s, const char *end)
+{
+    int n = 0, ndigits = 0;
+
+    while (*s < end && **s >= '0' && **s <= '9') {
+        if (++ndigits > TEXTFMT_MAXDIGITS) {
+            return -1;
+        }
+        n = 10*n + (**s - '0');
+        (*s)++;
+    }
+    return n;
+}
+
+/*
+ * Parses a Python %-format. Returns 0 on success, 1 if the format uses
+ * something which isn't supported here (mapping keys, '*', conversions
+ * of strings, ...), and -1 with an exception set on error.
+ */
+NPY_NO_EXPORT int
+npy_textformat_parse(npy_textformat *fmt, const char *s, npy_intp len)
+{
+    const char *end = s + len;
+    const char *seg;
+    char *t;
+    npy_intp maxconvs = len/2 + 1;
+
+    memset(fmt, 0, sizeof(*fmt));
+    fmt->text = PyArray_malloc(len + 1);
+    fmt->convs = PyArray_malloc(maxconvs * sizeof(npy_textconv));
+    if (fmt->text == NULL || fmt->convs == NULL) {
+        npy_textformat_clear(fmt);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    t = fmt->text;
+    seg = t;
+    while (s < end) {
+        npy_textconv *conv;
+        char flags[6], *f = flags;
+        int width = -1, prec = -1, isfloat;
+        const char *lenmod;
+
+        if (*s != '%') {
+            *t++ = *s++;
+            continue;
+        }
+        s++;
+        if (s < end && *s == '%') {
+            *t++ = *s++;
+            continue;
+        }
+        for (; s < end; s++) {
+            if (*s != '-' && *s != '+' && *s != ' ' && *s != '#' &&
+                    *s != '0') {
+                break;
+            }
+            if (memchr(flags, *s, f - flags) == NULL) {
+                *f++ = *s;
+            }
+        }
+        *f = '\0';
+        if (s < end && *s >= '0' && *s <= '9') {
+            width = _parse_digits(&s, end);
+            if (width < 0) {
+                goto unsupported;
+            }
+        }
+        if (s < end && *s == '.') {
+            s++;
+            prec = _parse_digits(&s, end);
+            if (prec < 0) {
+                goto unsupported;
+            }
+        }
+        while (s < end && (*s == 'h' || *s == 'l' || *s == 'L')) {
+            s++;
+        }
+        if (s == end) {
+            goto unsupported;
+        }
+
+        conv = &fmt->convs[fmt->nconvs++];
+        conv->text = seg;
+        conv->text_len = t - seg;
+        conv->prec = prec;
+        switch (*s) {
+            case 'd':
+            case 'i':
+            case 'u':
+                conv->conv = 'd';
+                break;
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+                conv->conv = *s;
+                break;
+            default:
+                goto unsupported;
+        }
+        s++;
+        isfloat = strchr("eEfFgG", conv->conv) != NULL;
+        /*
+         * the alternate forms of integers differ from C, which also
+         * ignores signs for its unsigned conversions, and glibc drops
+         * the zeros of the alternate %g when rounding carries, as in
+         * "%#.3g" % 999.5
+         */
+        if (!isfloat && (strchr(flags, '#') != NULL ||
+                (conv->conv != 'd' && strpbrk(flags, "+ ") != NULL))) {
+            goto unsupported;
+        }
+        if ((conv->conv == 'g' || conv->conv == 'G') &&
+                strchr(flags, '#') != NULL) {
+            goto unsupported;
+        }
+        lenmod = isfloat ? "" : TEXTFMT_LL;
+        PyOS_snprintf(conv->cfmt, sizeof(conv->cfmt), "%%%s", flags);
+        if (width >= 0) {
+            PyOS_snprintf(conv->cfmt + strlen(conv->cfmt), 8, "%d", width);
+        }
+        if (prec >= 0) {
+            PyOS_snprintf(conv->cfmt + strlen(conv->cfmt), 8, ".%d", prec);
+        }
+        strcpy(conv->ucfmt, conv->cfmt);
+        strcat(conv->cfmt, lenmod);
+        strcat(conv->ucfmt, lenmod);
+        if (conv->conv == 'd') {
+            strcat(conv->cfmt, "d");
+            strcat(conv->ucfmt, "u");
+            /* C ignores the sign flags for %u */
+            if (strpbrk(flags, "+ ") != NULL) {
+                conv->ucfmt[0] = '\0';
+            }
+        }
+        else {
+            PyOS_snprintf(conv->cfmt + strlen(conv->cfmt), 2, "%c",
+                          conv->conv);
+            strcpy(conv->ucfmt, conv->cfmt);
+        }
+        seg = t;
+    }
+    fmt->tail = seg;
+    fmt->tail_len = t - seg;
+    return 0;
+
+unsupported:
+    npy_textformat_clear(fmt);
+    return 1;
+}
+
+NPY_NO_EXPORT void
+npy_textformat_clear(npy_textformat *fmt)
+{
+    PyArray_free(fmt->text);
+    PyArray_free(fmt->convs);
+    fmt->text = NULL;
+    fmt->convs = NULL;
+    fmt->nconvs = 0;
+}
+
+/* The kinds of values read by _get_value */
+enum {
+    TEXTFMT_SIGNED,
+    TEXTFMT_UNSIGNED,
+    TEXTFMT_FLOAT,
+    TEXTFMT_NONE
+};
+
+static int
+_value_kind(int type_num)
+{
+    switch (type_num) {
+        case NPY_BOOL:
+        case NPY_BYTE:
+        case NPY_SHORT:
+        case NPY_INT:
+        case NPY_LONG:
+        case NPY_LONGLONG:
+            return TEXTFMT_SIGNED;
+        case NPY_UBYTE:
+        case NPY_USHORT:
+        case NPY_UINT:
+        case NPY_ULONG:
+        case NPY_ULONGLONG:
+            return TEXTFMT_UNSIGNED;
+        case NPY_HALF:
+        case NPY_FLOAT:
+        case NPY_DOUBLE:
+        case NPY_LONGDOUBLE:
+            return TEXTFMT_FLOAT;
+        default:
+            return TEXTFMT_NONE;
+    }
+}
+
+/* Reads an aligned element in native byte order */
+static int
+_get_value(int type_num, const char *data,
+           npy_longlong *ll, npy_ulonglong *ull, double *d)
+{
+    switch (type_num) {
+#define TEXTFMT_CASE(type, ctype, var) \
+        case type: \
+            *var = *(const ctype *)data; \
+            break
+        TEXTFMT_CASE(NPY_BOOL, npy_bool, ll);
+        TEXTFMT_CASE(NPY_BYTE, npy_byte, ll);
+        TEXTFMT_CASE(NPY_SHORT, npy_short, ll);
+        TEXTFMT_CASE(NPY_INT, npy_int, ll);
+        TEXTFMT_CASE(NPY_LONG, npy_long, ll);
+        TEXTFMT_CASE(NPY_LONGLONG, npy_longlong, ll);
+        TEXTFMT_CASE(NPY_UBYTE, npy_ubyte, ull);
+        TEXTFMT_CASE(NPY_USHORT, npy_ushort, ull);
+        TEXTFMT_CASE(NPY_UINT, npy_uint, ull);
+        TEXTFMT_CASE(NPY_ULONG, npy_ulong, ull);
+        TEXTFMT_CASE(NPY_ULONGLONG, npy_ulonglong, ull);
+        TEXTFMT_CASE(NPY_FLOAT, npy_float, d);
+        TEXTFMT_CASE(NPY_DOUBLE, npy_double, d);
+        TEXTFMT_CASE(NPY_LONGDOUBLE, npy_longdouble, d);
+#undef TEXTFMT_CASE
+        case NPY_HALF:
+            *d = npy_half_to_double(*(const npy_half *)data);
+            break;
+    }
+    return _value_kind(type_num);
+}
+
+/*
+ * Whether elements of type_num can be formatted by fmt. Python raises
+ * TypeError for the conversions which aren't supported, so callers should
+ * let Python format the whole array.
+ */
+NPY_NO_EXPORT int
+npy_textformat_usable(const npy_textformat *fmt, int type_num)
+{
+    npy_intp i;
+    int kind = _value_kind(type_num);
+
+    if (kind == TEXTFMT_NONE || !_locale_usable()) {
+        return 0;
+    }
+    for (i = 0; i < fmt->nconvs; i++) {
+        char c = fmt->convs[i].conv;
+
+        if ((c == 'x' || c == 'X' || c == 'o') &&
+                (kind == TEXTFMT_FLOAT || type_num == NPY_BOOL)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#if PY_VERSION_HEX < 0x03080000
+/* The number of significant digits %g prints without stripping zeros */
+static int
+_g_precision(const npy_textconv *conv)
+{
+    if (conv->prec < 0) {
+        return 6;
+    }
+    return conv->prec == 0 ? 1 : conv->prec;
+}
+
+/* The number of significant digits in the n characters of %g output s */
+static int
+_count_significant(const char *s, int n)
+{
+    int i, count = 0;
+
+    for (i = 0; i < n && s[i] != 'e' && s[i] != 'E'; i++) {
+        if ((s[i] >= '1' && s[i] <= '9') || (s[i] == '0' && count > 0)) {
+            count++;
+        }
+    }
+    return count;
+}
+#endif
+
+/*
+ * Formats one value. Returns 1 on success, 0 if the value should be
+ * formatted by Python and -1 if out of memory.
+ */
+static int
+_format_value(npy_textbuf *buf, const npy_textconv *conv,
+              int type_num, const char *data)
+{
+    npy_longlong ll = 0;
+    npy_ulonglong ull = 0;
+    double d = 0;
+    int kind = _get_value(type_num, data, &ll, &ull, &d);
+    char *out;
+    int n;
+
+    if (_textbuf_reserve(buf, TEXTFMT_MAXFIELD) < 0) {
+        return -1;
+    }
+    out = buf->data + buf->len;
+
+    if (conv->conv == 'd' || conv->conv == 'x' || conv->conv == 'X' ||
+            conv->conv == 'o') {
+        if (kind == TEXTFMT_FLOAT) {
+            /* int(d), if it fits */
+            if (!(d > -9223372036854775808.0 && d < 9223372036854775808.0)) {
+                return 0;
+            }
+            ll = (npy_longlong)d;
+        }
+        if (kind != TEXTFMT_UNSIGNED) {
+            if (conv->conv != 'd' && ll < 0) {
+                return 0;
+            }
+            ull = (npy_ulonglong)ll;
+        }
+        /* C prints no digits for a zero with zero precision */
+        if (conv->prec == 0 && ull == 0) {
+            return 0;
+        }
+        if (conv->conv == 'd' && kind == TEXTFMT_UNSIGNED &&
+                ull <= NPY_MAX_LONGLONG) {
+            ll = (npy_longlong)ull;
+            kind = TEXTFMT_SIGNED;
+        }
+        if (kind != TEXTFMT_UNSIGNED && conv->conv == 'd') {
+            n = PyOS_snprintf(out, TEXTFMT_MAXFIELD, conv->cfmt, ll);
+        }
+        else if (conv->ucfmt[0] != '\0') {
+            n = PyOS_snprintf(out, TEXTFMT_MAXFIELD, conv->ucfmt, ull);
+        }
+        else {
+            return 0;
+        }
+    }
+    else {
+        if (kind == TEXTFMT_SIGNED) {
+            d = (double)ll;
+        }
+        else if (kind == TEXTFMT_UNSIGNED) {
+            d = (double)ull;
+        }
+        if (!npy_isfinite(d)) {
+            return 0;
+        }
+#if !defined(NPY_PY3K)
+        /* Python 2 switches to %g for large values */
+        if ((conv->conv == 'f' || conv->conv == 'F') && fabs(d) >= 1e50) {
+            return 0;
+        }
+#endif
+        n = PyOS_snprintf(out, TEXTFMT_MAXFIELD, conv->cfmt, d);
+#if PY_VERSION_HEX < 0x03080000
+        /*
+         * Before 3.8 Python's %g keeps the trailing zeros of decimal ties
+         * rounded down, "%.2g" % 105.0 is "1.0e+02" where C gives "1e+02",
+         * so let Python format anything C may have stripped zeros from.
+         */
+        if ((conv->conv == 'g' || conv->conv == 'G') && d != 0 &&
+                n > 0 && n < TEXTFMT_MAXFIELD &&
+                _count_significant(out, n) < _g_precision(conv)) {
+            return 0;
+        }
+#endif
+    }
+    if (n < 0 || n >= TEXTFMT_MAXFIELD) {
+        return 0;
+    }
+    buf->len += n;
+    return 1;
+}
+
+/*
+ * Formats fmt->nconvs elements, data + i*stride, like fmt % values.
+ * Returns 1 on success, 0 if Python should format them, in which case
+ * nothing is written, and -1 if out of memory. Doesn't need the GIL.
+ */
+NPY_NO_EXPORT int
+npy_textformat_write(npy_textbuf *buf, const npy_textformat *fmt,
+                     int type_num, const char *data, npy_intp stride)
+{
+    npy_intp start = buf->len;
+    npy_intp i;
+
+    for (i = 0; i < fmt->nconvs; i++) {
+        const npy_textconv *conv = &fmt->convs[i];
+        int ret;
+
+        if (npy_textbuf_write(buf, conv->text, conv->text_len) < 0) {
+            return -1;
+        }
+        ret = _format_value(buf, conv, type_num, data + i*stride);
+        if (ret <= 0) {
+            buf->len = start;
+            return ret;
+        }
+    }
+    if (npy_textbuf_write(buf, fmt->tail, fmt->tail_len) < 0) {
+        return -1;
+    }
+    return 1;
+}
+
+/*
+ * Parses the digits of "%e" output into digits, returning their number
+ * and setting decpt to the position of the decimal point.
+ */
+static int
+_parse_exp_digits(const char *s, char *digits, int *decpt)
+{
+    int n = 0;
+
+    for (; *s != 'e'; s++) {
+        if (*s >= '0' && *s <= '9') {
+            digits[n++] = *s;
+        }
+    }
+    *decpt = atoi(s + 1) + 1;
+    return n;
+}
+
+/*
+ * Rounds the 17 digits d17 of x to p digits. Exact ties in d17 may not be
+ * ties in x, so those are rounded by printf from x itself.
+ */
+static int
+_round_digits(double x, const char *d17, int decpt17, int p,
+              char *digits, int *decpt)
+{
+    int i;
+
+    if (p >= 17) {
+        memcpy(digits, d17, 17);
+        *decpt = decpt17;
+        return 17;
+    }
+    if (d17[p] == '5') {
+        for (i = p + 1; i < 17 && d17[i] == '0'; i++) {
+        }
+        if (i == 17) {
+            char buf[40];
+
+            PyOS_snprintf(buf, sizeof(buf), "%.*e", p - 1, x);
+            return _parse_exp_digits(buf, digits, decpt);
+        }
+    }
+    memcpy(digits, d17, p);
+    *decpt = decpt17;
+    if (d17[p] >= '5') {
+        for (i = p - 1; i >= 0 && digits[i] == '9'; i--) {
+            digits[i] = '0';
+        }
+        if (i < 0) {
+            digits[0] = '1';
+            (*decpt)++;
+        }
+        else {
+            digits[i]++;
+        }
+    }
+    return p;
+}
+
+/* Whether the decimal digits[:n] * 10**(decpt - n) reads back as x */
+static int
+_roundtrips(double x, const char *digits, int n, int decpt)
+{
+    char buf[40];
+
+    memcpy(buf, digits, n);
+    PyOS_snprintf(buf + n, sizeof(buf) - n, "e%d", decpt - n);
+    return strtod(buf, NULL) == x;
+}
+
+/*
+ * Finds the shortest digits which read back as the finite x > 0 by
+ * bisection. The closest decimal with p digits reads back as x whenever
+ * any decimal with p digits does, except for powers of two with 16 or 17
+ * digits, whose interval of rounding is lopsided.
+ */
+static int
+_search_digits(double x, char *digits, int *decpt)
+{
+    char buf[40], d17[17];
+    int decpt17, lo, hi, n;
+
+    PyOS_snprintf(buf, sizeof(buf), "%.16e", x);
+    _parse_exp_digits(buf, d17, &decpt17);
+
+    /* most doubles need 16 or 17 digits, so try those first */
+    n = _round_digits(x, d17, decpt17, 16, digits, decpt);
+    if (!_roundtrips(x, digits, n, *decpt)) {
+        hi = 17;
+    }
+    else {
+        n = _round_digits(x, d17, decpt17, 15, digits, decpt);
+        if (!_roundtrips(x, digits, n, *decpt)) {
+            hi = 16;
+        }
+        else {
+            lo = 1;
+            hi = 15;
+            while (lo < hi) {
+                int mid = (lo + hi) / 2;
+
+                n = _round_digits(x, d17, decpt17, mid, digits, decpt);
+                if (_roundtrips(x, digits, n, *decpt)) {
+                    hi = mid;
+                }
+                else {
+                    lo = mid + 1;
+                }
+            }
+        }
+    }
+    n = _round_digits(x, d17, decpt17, hi, digits, decpt);
+    while (n > 1 && digits[n - 1] == '0') {
+        n--;
+    }
+    return n;
+}
+
+/*
+ * Grisu3 (Loitsch, "Printing Floating-Point Numbers Quickly and
+ * Accurately with Integers", PLDI 2010), which finds the shortest and
+ * closest digits for most doubles using 64-bit integers, and reports the
+ * others.
+ */
+typedef struct {
+    npy_uint64 f;
+    int e;
+} grisu_fp;
+
+/* Normalized 10**k for k = -348, -340, ..., 340 */
+static const struct {
+    npy_uint64 f;
+    short e;
+    short k;
+} grisu_powers[] = {
+    {NPY_ULONGLONG_SUFFIX(0xfa8fd5a0081c0288), -1220, -348},
+    {NPY_ULONGLONG_SUFFIX(0xbaaee17fa23ebf76), -1193, -340},
+    {NPY_ULONGLONG_SUFFIX(0x8b16fb203055ac76), -1166, -332},
+    {NPY_ULONGLONG_SUFFIX(0xcf42894a5dce35ea), -1140, -324},
+    {NPY_ULONGLONG_SUFFIX(0x9a6bb0aa55653b2d), -1113, -316},
+    {NPY_ULONGLONG_SUFFIX(0xe61acf033d1a45df), -1087, -308},
+    {NPY_ULONGLONG_SUFFIX(0xab70fe17c79ac6ca), -1060, -300},
+    {NPY_ULONGLONG_SUFFIX(0xff77b1fcbebcdc4f), -1034, -292},
+    {NPY_ULONGLONG_SUFFIX(0xbe5691ef416bd60c), -1007, -284},
+    {NPY_ULONGLONG_SUFFIX(0x8dd01fad907ffc3c), -980, -276},
+    {NPY_ULONGLONG_SUFFIX(0xd3515c2831559a83), -954, -268},
+    {NPY_ULONGLONG_SUFFIX(0x9d71ac8fada6c9b5), -927, -260},
+    {NPY_ULONGLONG_SUFFIX(0xea9c227723ee8bcb), -901, -252},
+    {NPY_ULONGLONG_SUFFIX(0xaecc49914078536d), -874, -244},
+    {NPY_ULONGLONG_SUFFIX(0x823c12795db6ce57), -847, -236},
+    {NPY_ULONGLONG_SUFFIX(0xc21094364dfb5637), -821, -228},
+    {NPY_ULONGLONG_SUFFIX(0x9096ea6f3848984f), -794, -220},
+    {NPY_ULONGLONG_SUFFIX(0xd77485cb25823ac7), -768, -212},
+    {NPY_ULONGLONG_SUFFIX(0xa086cfcd97bf97f4), -741, -204},
+    {NPY_ULONGLONG_SUFFIX(0xef340a98172aace5), -715, -196},
+    {NPY_ULONGLONG_SUFFIX(0xb23867fb2a35b28e), -688, -188},
+    {NPY_ULONGLONG_SUFFIX(0x84c8d4dfd2c63f3b), -661, -180},
+    {NPY_ULONGLONG_SUFFIX(0xc5dd44271ad3cdba), -635, -172},
+    {NPY_ULONGLONG_SUFFIX(0x936b9fcebb25c996), -608, -164},
+    {NPY_ULONGLONG_SUFFIX(0xdbac6c247d62a584), -582, -156},
+    {NPY_ULONGLONG_SUFFIX(0xa3ab66580d5fdaf6), -555, -148},
+    {NPY_ULONGLONG_SUFFIX(0xf3e2f893dec3f126), -529, -140},
+    {NPY_ULONGLONG_SUFFIX(0xb5b5ada8aaff80b8), -502, -132},
+    {NPY_ULONGLONG_SUFFIX(0x87625f056c7c4a8b), -475, -124},
+    {NPY_ULONGLONG_SUFFIX(0xc9bcff6034c13053), -449, -116},
+    {NPY_ULONGLONG_SUFFIX(0x964e858c91ba2655), -422, -108},
+    {NPY_ULONGLONG_SUFFIX(0xdff9772470297ebd), -396, -100},
+    {NPY_ULONGLONG_SUFFIX(0xa6dfbd9fb8e5b88f), -369, -92},
+    {NPY_ULONGLONG_SUFFIX(0xf8a95fcf88747d94), -343, -84},
+    {NPY_ULONGLONG_SUFFIX(0xb94470938fa89bcf), -316, -76},
+    {NPY_ULONGLONG_SUFFIX(0x8a08f0f8bf0f156b), -289, -68},
+    {NPY_ULONGLONG_SUFFIX(0xcdb02555653131b6), -263, -60},
+    {NPY_ULONGLONG_SUFFIX(0x993fe2c6d07b7fac), -236, -52},
+    {NPY_ULONGLONG_SUFFIX(0xe45c10c42a2b3b06), -210, -44},
+    {NPY_ULONGLONG_SUFFIX(0xaa242499697392d3), -183, -36},
+    {NPY_ULONGLONG_SUFFIX(0xfd87b5f28300ca0e), -157, -28},
+    {NPY_ULONGLONG_SUFFIX(0xbce5086492111aeb), -130, -20},
+    {NPY_ULONGLONG_SUFFIX(0x8cbccc096f5088cc), -103, -12},
+    {NPY_ULONGLONG_SUFFIX(0xd1b71758e219652c), -77, -4},
+    {NPY_ULONGLONG_SUFFIX(0x9c40000000000000), -50, 4},
+    {NPY_ULONGLONG_SUFFIX(0xe8d4a51000000000), -24, 12},
+    {NPY_ULONGLONG_SUFFIX(0xad78ebc5ac620000), 3, 20},
+    {NPY_ULONGLONG_SUFFIX(0x813f3978f8940984), 30, 28},
+    {NPY_ULONGLONG_SUFFIX(0xc097ce7bc90715b3), 56, 36},
+    {NPY_ULONGLONG_SUFFIX(0x8f7e32ce7bea5c70), 83, 44},
+    {NPY_ULONGLONG_SUFFIX(0xd5d238a4abe98068), 109, 52},
+    {NPY_ULONGLONG_SUFFIX(0x9f4f2726179a2245), 136, 60},
+    {NPY_ULONGLONG_SUFFIX(0xed63a231d4c4fb27), 162, 68},
+    {NPY_ULONGLONG_SUFFIX(0xb0de65388cc8ada8), 189, 76},
+    {NPY_ULONGLONG_SUFFIX(0x83c7088e1aab65db), 216, 84},
+    {NPY_ULONGLONG_SUFFIX(0xc45d1df942711d9a), 242, 92},
+    {NPY_ULONGLONG_SUFFIX(0x924d692ca61be758), 269, 100},
+    {NPY_ULONGLONG_SUFFIX(0xda01ee641a708dea), 295, 108},
+    {NPY_ULONGLONG_SUFFIX(0xa26da3999aef774a), 322, 116},
+    {NPY_ULONGLONG_SUFFIX(0xf209787bb47d6b85), 348, 124},
+    {NPY_ULONGLONG_SUFFIX(0xb454e4a179dd1877), 375, 132},
+    {NPY_ULONGLONG_SUFFIX(0x865b86925b9bc5c2), 402, 140},
+    {NPY_ULONGLONG_SUFFIX(0xc83553c5c8965d3d), 428, 148},
+    {NPY_ULONGLONG_SUFFIX(0x952ab45cfa97a0b3), 455, 156},
+    {NPY_ULONGLONG_SUFFIX(0xde469fbd99a05fe3), 481, 164},
+    {NPY_ULONGLONG_SUFFIX(0xa59bc234db398c25), 508, 172},
+    {NPY_ULONGLONG_SUFFIX(0xf6c69a72a3989f5c), 534, 180},
+    {NPY_ULONGLONG_SUFFIX(0xb7dcbf5354e9bece), 561, 188},
+    {NPY_ULONGLONG_SUFFIX(0x88fcf317f22241e2), 588, 196},
+    {NPY_ULONGLONG_SUFFIX(0xcc20ce9bd35c78a5), 614, 204},
+    {NPY_ULONGLONG_SUFFIX(0x98165af37b2153df), 641, 212},
+    {NPY_ULONGLONG_SUFFIX(0xe2a0b5dc971f303a), 667, 220},
+    {NPY_ULONGLONG_SUFFIX(0xa8d9d1535ce3b396), 694, 228},
+    {NPY_ULONGLONG_SUFFIX(0xfb9b7cd9a4a7443c), 720, 236},
+    {NPY_ULONGLONG_SUFFIX(0xbb764c4ca7a44410), 747, 244},
+    {NPY_ULONGLONG_SUFFIX(0x8bab8eefb6409c1a), 774, 252},
+    {NPY_ULONGLONG_SUFFIX(0xd01fef10a657842c), 800, 260},
+    {NPY_ULONGLONG_SUFFIX(0x9b10a4e5e9913129), 827, 268},
+    {NPY_ULONGLONG_SUFFIX(0xe7109bfba19c0c9d), 853, 276},
+    {NPY_ULONGLONG_SUFFIX(0xac2820d9623bf429), 880, 284},
+    {NPY_ULONGLONG_SUFFIX(0x80444b5e7aa7cf85), 907, 292},
+    {NPY_ULONGLONG_SUFFIX(0xbf21e44003acdd2d), 933, 300},
+    {NPY_ULONGLONG_SUFFIX(0x8e679c2f5e44ff8f), 960, 308},
+    {NPY_ULONGLONG_SUFFIX(0xd433179d9c8cb841), 986, 316},
+    {NPY_ULONGLONG_SUFFIX(0x9e19db92b4e31ba9), 1013, 324},
+    {NPY_ULONGLONG_SUFFIX(0xeb96bf6ebadf77d9), 1039, 332},
+    {NPY_ULONGLONG_SUFFIX(0xaf87023b9bf0ee6b), 1066, 340}
+};
+
+static grisu_fp
+_grisu_normalize(grisu_fp x)
+{
+    while (!(x.f & (NPY_ULONGLONG_SUFFIX(1) << 63))) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+/* The upper 64 bits of the product, rounded */
+static grisu_fp
+_grisu_multiply(grisu_fp x, grisu_fp y)
+{
+    const npy_uint64 m32 = 0xffffffffu;
+    npy_uint64 a = x.f >> 32, b = x.f & m32;
+    npy_uint64 c = y.f >> 32, d = y.f & m32;
+    npy_uint64 ac = a*c, bc = b*c, ad = a*d, bd = b*d;
+    npy_uint64 tmp = (bd >> 32) + (ad & m32) + (bc & m32) + (1u << 31);
+    grisu_fp r;
+
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+/*
+ * Moves the last digit towards w while that stays within the interval,
+ * and checks that the result is certainly the closest.
+ */
+static int
+_grisu_round_weed(char *digits, int n, npy_uint64 dist_high_w,
+                  npy_uint64 unsafe, npy_uint64 rest, npy_uint64 ten_kappa,
+                  npy_uint64 unit)
+{
+    npy_uint64 small_dist = dist_high_w - unit;
+    npy_uint64 big_dist = dist_high_w + unit;
+
+    while (rest < small_dist && unsafe - rest >= ten_kappa &&
+            (rest + ten_kappa < small_dist ||
+             small_dist - rest >= rest + ten_kappa - small_dist)) {
+        digits[n - 1]--;
+        rest += ten_kappa;
+    }
+    if (rest < big_dist && unsafe - rest >= ten_kappa &&
+            (rest + ten_kappa < big_dist ||
+             big_dist - rest > rest + ten_kappa - big_dist)) {
+        return 0;
+    }
+    return 2*unit <= rest && rest <= unsafe - 4*unit;
+}
+
+/* Returns the number of digits, or 0 if the result isn't certain */
+static int
+_grisu3(double x, char *digits, int *decpt)
+{
+    union {
+        double d;
+        npy_uint64 u;
+    } bits;
+    npy_uint64 frac, one, unit = 1, unsafe, fractionals, rest;
+    npy_uint32 integrals, divisor = 1;
+    int biased, kappa = 1, n = 0, idx, mk;
+    grisu_fp w, lo, hi, ten_mk;
+
+    bits.d = x;
+    frac = bits.u & NPY_ULONGLONG_SUFFIX(0xfffffffffffff);
+    biased = (int)(bits.u >> 52);
+    if (biased == 0) {
+        w.f = frac;
+        w.e = -1074;
+    }
+    else {
+        w.f = frac + (NPY_ULONGLONG_SUFFIX(1) << 52);
+        w.e = biased - 1075;
+    }
+
+    /* the boundaries halfway to the neighbouring doubles */
+    hi.f = (w.f << 1) + 1;
+    hi.e = w.e - 1;
+    hi = _grisu_normalize(hi);
+    if (frac == 0 && biased > 1) {
+        lo.f = (w.f << 2) - 1;
+        lo.e = w.e - 2;
+    }
+    else {
+        lo.f = (w.f << 1) - 1;
+        lo.e = w.e - 1;
+    }
+    lo.f <<= lo.e - hi.e;
+    lo.e = hi.e;
+    w = _grisu_normalize(w);
+
+    /* scale by a cached 10**mk, so that the exponent is in [-60, -32] */
+    idx = ((int)ceil((-60 - (w.e + 64) + 63) * 0.30102999566398114) +
+           347) / 8 + 1;
+    ten_mk.f = grisu_powers[idx].f;
+    ten_mk.e = grisu_powers[idx].e;
+    mk = grisu_powers[idx].k;
+    w = _grisu_multiply(w, ten_mk);
+    lo = _grisu_multiply(lo, ten_mk);
+    hi = _grisu_multiply(hi, ten_mk);
+
+    /* generate digits of the upper bound until within the interval */
+    lo.f -= unit;
+    hi.f += unit;
+    unsafe = hi.f - lo.f;
+    one = NPY_ULONGLONG_SUFFIX(1) << -w.e;
+    integrals = (npy_uint32)(hi.f >> -w.e);
+    fractionals = hi.f & (one - 1);
+    while (divisor <= integrals / 10) {
+        divisor *= 10;
+        kappa++;
+    }
+    while (kappa > 0) {
+        digits[n++] = '0' + integrals / divisor;
+        integrals %= divisor;
+        kappa--;
+        rest = ((npy_uint64)integrals << -w.e) + fractionals;
+        if (rest < unsafe) {
+            if (!_grisu_round_weed(digits, n, hi.f - w.f, unsafe, rest,
+                                   (npy_uint64)divisor << -w.e, unit)) {
+                return 0;
+            }
+            *decpt = n + kappa - mk;
+            return n;
+        }
+        divisor /= 10;
+    }
+    for (;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe *= 10;
+        digits[n++] = '0' + (int)(fractionals >> -w.e);
+        fractionals &= one - 1;
+        kappa--;
+        if (fractionals < unsafe) {
+            if (!_grisu_round_weed(digits, n, (hi.f - w.f) * unit, unsafe,
+                                   fractionals, one, unit)) {
+                return 0;
+            }
+            *decpt = n + kappa - mk;
+            return n;
+        }
+        if (n == 17) {
+            return 0;
+        }
+    }
+}
+
+/*
+ * Finds the shortest digits which read back as the finite x > 0 and the
+ * closest of those, as Python's repr does. Returns the number of digits,
+ * or 0 if that might not be Python's choice.
+ */
+static int
+_shortest_digits(double x, char *digits, int *decpt)
+{
+    union {
+        double d;
+        npy_uint64 u;
+    } bits;
+    int n = _grisu3(x, digits, decpt);
+
+    if (n == 0) {
+        n = _search_digits(x, digits, decpt);
+    }
+    bits.d = x;
+    if (n >= 16 && (bits.u & NPY_ULONGLONG_SUFFIX(0xfffffffffffff)) == 0) {
+        return 0;
+    }
+    return n;
+}
+
+/*
+ * Writes repr(float(x)), or the parts of repr(complex) if add_dot_0 is
+ * false. Returns 1 on success, 0 if Python should format x and -1 if out
+ * of memory.
+ */
+static int
+_write_float_repr(npy_textbuf *buf, double x, int add_dot_0, int sign)
+{
+    char digits[17];
+    char *out;
+    int n, decpt, exp = 0, use_exp, i;
+
+    if (_textbuf_reserve(buf, 32) < 0) {
+        return -1;
+    }
+    out = buf->data + buf->len;
+
+    if (npy_isnan(x)) {
+        if (!add_dot_0) {
+            return 0;
+        }
+        memcpy(out, "nan", 3);
+        buf->len += 3;
+        return 1;
+    }
+    if (npy_signbit(x)) {
+        *out++ = '-';
+        x = -x;
+    }
+    else if (sign) {
+        *out++ = '+';
+    }
+    if (npy_isinf(x)) {
+        if (!add_dot_0) {
+            return 0;
+        }
+        memcpy(out, "inf", 3);
+        buf->len = out + 3 - buf->data;
+        return 1;
+    }
+    if (x == 0) {
+        digits[0] = '0';
+        n = 1;
+        decpt = 1;
+    }
+    else {
+        n = _shortest_digits(x, digits, &decpt);
+        if (n == 0) {
+            return 0;
+        }
+    }
+
+    use_exp = decpt <= -4 || decpt > 16;
+    if (use_exp) {
+        exp = decpt - 1;
+        decpt = 1;
+    }
+    if (decpt <= 0) {
+        *out++ = '0';
+        *out++ = '.';
+        for (i = decpt; i < 0; i++) {
+            *out++ = '0';
+        }
+        memcpy(out, digits, n);
+        out += n;
+    }
+    else if (decpt >= n) {
+        memcpy(out, digits, n);
+        out += n;
+        for (i = n; i < decpt; i++) {
+            *out++ = '0';
+        }
+        if (add_dot_0 && !use_exp) {
+            *out++ = '.';
+            *out++ = '0';
+        }
+    }
+    else {
+        memcpy(out, digits, decpt);
+        out += decpt;
+        *out++ = '.';
+        memcpy(out, digits + decpt, n - decpt);
+        out += n - decpt;
+    }
+    if (use_exp) {
+        out += PyOS_snprintf(out, 8, "e%+.02d", exp);
+    }
+    buf->len = out - buf->data;
+    return 1;
+}
+
+/*
+ * Whether elements of type_num can be written like the repr of the
+ * Python objects returned by their getitem.
+ */
+NPY_NO_EXPORT int
+npy_textrepr_usable(int type_num)
+{
+    if (!_locale_usable()) {
+        return 0;
+    }
+    switch (type_num) {
+        case NPY_BOOL:
+        case NPY_BYTE:
+        case NPY_UBYTE:
+        case NPY_SHORT:
+        case NPY_USHORT:
+        case NPY_INT:
+        case NPY_LONG:
+#if defined(NPY_PY3K)
+        /* Python 2 returns longs for these, whose repr ends with 'L' */
+        case NPY_UINT:
+        case NPY_ULONG:
+        case NPY_LONGLONG:
+        case NPY_ULONGLONG:
+#endif
+        case NPY_HALF:
+        case NPY_FLOAT:
+        case NPY_DOUBLE:
+        case NPY_CFLOAT:
+        case NPY_CDOUBLE:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/*
+ * Writes the repr of the Python object for an aligned element in native
+ * byte order. Returns 1 on success, 0 if Python should format it, in
+ * which case nothing is written, and -1 if out of memory. Doesn't need
+ * the GIL.
+ */
+NPY_NO_EXPORT int
+npy_textrepr_write(npy_textbuf *buf, int type_num, const char *data)
+{
+    npy_longlong ll = 0;
+    npy_ulonglong ull = 0;
+    double d = 0, re, im;
+    npy_intp start = buf->len;
+    int ret;
+
+    switch (type_num) {
+        case NPY_BOOL:
+            if (*(const npy_bool *)data) {
+                return npy_textbuf_write(buf, "True", 4) < 0 ? -1 : 1;
+            }
+            return npy_textbuf_write(buf, "False", 5) < 0 ? -1 : 1;
+        case NPY_CFLOAT:
+            re = ((const npy_float *)data)[0];
+            im = ((const npy_float *)data)[1];
+            break;
+        case NPY_CDOUBLE:
+            re = ((const npy_double *)data)[0];
+            im = ((const npy_double *)data)[1];
+            break;
+        default:
+            if (_textbuf_reserve(buf, 32) < 0) {
+                return -1;
+            }
+            switch (_get_value(type_num, data, &ll, &ull, &d)) {
+                case TEXTFMT_SIGNED:
+                    buf->len += PyOS_snprintf(buf->data + buf->len, 32,
+                                    "%" NPY_LONGLONG_FMT, ll);
+                    return 1;
+                case TEXTFMT_UNSIGNED:
+                    buf->len += PyOS_snprintf(buf->data + buf->len, 32,
+                                    "%" NPY_ULONGLONG_FMT, ull);
+                    return 1;
+                default:
+                    return _write_float_repr(buf, d, 1, 0);
+            }
+    }
+
+    /* repr(complex), which omits a real part of +0 */
+    if (re == 0 && !npy_signbit(re)) {
+        ret = _write_float_repr(buf, im, 0, 0);
+        if (ret > 0) {
+            ret = npy_textbuf_write(buf, "j", 1) < 0 ? -1 : 1;
+        }
+    }
+    else {
+        ret = npy_textbuf_write(buf, "(", 1) < 0 ? -1 : 1;
+        if (ret > 0) {
+            ret = _write_float_repr(buf, re, 0, 0);
+        }
+        if (ret > 0) {
+            ret = _write_float_repr(buf, im, 0, 1);
+        }
+        if (ret > 0) {
+            ret = npy_textbuf_write(buf, "j)", 2) < 0 ? -1 : 1;
+        }
+    }
+    if (ret == 0) {
+        buf->len = start;
+    }
+    return ret;
+}
+
+/*
+ * Formats rows of a 2-d numeric array like format % tuple(row) + newline
+ * for numpy.savetxt, with the GIL released. Returns the text and the
+ * number of rows formatted, which stops short at a row Python should
+ * format, or None if format or the array can't be handled here.
+ */
+NPY_NO_EXPORT PyObject *
+arr_format_rows(PyObject *NPY_UNUSED(self), PyObject *args)
+{
+    PyArrayObject *arr;
+    const char *format, *newline;
+    Py_ssize_t format_len, newline_len;
+    npy_textformat fmt;
+    npy_textbuf buf = {NULL, 0, 0};
+    npy_intp nrows, i;
+    int type_num, ret = 1;
+    PyObject *text;
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!PyArg_ParseTuple(args, "O!s#s#:_format_rows", &PyArray_Type, &arr,
+                          &format, &format_len, &newline, &newline_len)) {
+        return NULL;
+    }
+    type_num = PyArray_DESCR(arr)->type_num;
+    if (PyArray_NDIM(arr) != 2 || !PyArray_ISALIGNED(arr) ||
+            !PyArray_ISNOTSWAPPED(arr)) {
+        Py_RETURN_NONE;
+    }
+    ret = npy_textformat_parse(&fmt, format, format_len);
+    if (ret < 0) {
+        return NULL;
+    }
+    if (ret > 0) {
+        Py_RETURN_NONE;
+    }
+    if (fmt.nconvs != PyArray_DIM(arr, 1) ||
+            !npy_textformat_usable(&fmt, type_num)) {
+        npy_textformat_clear(&fmt);
+        Py_RETURN_NONE;
+    }
+
+    nrows = PyArray_DIM(arr, 0);
+    NPY_BEGIN_THREADS;
+    for (i = 0; i < nrows; i++) {
+        ret = npy_textformat_write(&buf, &fmt, type_num,
+                                   PyArray_BYTES(arr) +
+                                   i*PyArray_STRIDE(arr, 0),
+                                   PyArray_STRIDE(arr, 1));
+        if (ret > 0) {
+            ret = npy_textbuf_write(&buf, newline, newline_len) < 0 ? -1 : 1;
+        }
+        if (ret <= 0 || buf.len >= TEXTFMT_MAXBLOCK) {
+            break;
+        }
+    }
+    NPY_END_THREADS;
+    npy_textformat_clear(&fmt);
+
+    if (ret < 0) {
+        npy_textbuf_clear(&buf);
+        return PyErr_NoMemory();
+    }
+    if (ret > 0 && i < nrows) {
+        /* the row which filled the buffer */
+        i++;
+    }
+    text = PyBytes_FromStringAndSize(buf.data, buf.len);
+    npy_textbuf_clear(&buf);
+    if (text == NULL) {
+        return NULL;
+    }
+    return Py_BuildValue("Nn", text, i);
+}
@@ -0,0 +1,64 @@
+#ifndef _NPY_TEXTWRITING_H_
+#define _NPY_TEXTWRITING_H_
+
+/* A growing buffer of text, which may be used without the GIL */
+typedef struct {
+    char *data;
+    npy_intp len;
+    npy_intp alloc;
+} npy_textbuf;
+
+/* A conversion of a Python %-format and the literal text before it */
+typedef struct {
+    const char *text;
+    npy_intp text_len;
+    /* one of 'd', 'x', 'X', 'o', 'e', 'E', 'f', 'F', 'g', 'G' */
+    char conv;
+    /*
+     * printf formats for signed and unsigned values, e.g. "%-10.3lld", the
+     * unsigned one empty if C can't format them like Python
+     */
+    char cfmt[32];
+    char ucfmt[32];
+    /* -1 if not given */
+    int prec;
+} npy_textconv;
+
+typedef struct {
+    /* the literal text, with %% replaced by % */
+    char *text;
+    npy_textconv *convs;
+    npy_intp nconvs;
+    const char *tail;
+    npy_intp tail_len;
+} npy_textformat;
+
+NPY_NO_EXPORT int
+npy_textbuf_write(npy_textbuf *buf, const char *s, npy_intp len);
+
+NPY_NO_EXPORT void
+npy_textbuf_clear(npy_textbuf *buf);
+
+NPY_NO_EXPORT int
+npy_textformat_parse(npy_textformat *fmt, const char *s, npy_intp len);
+
+NPY_NO_EXPORT void
+npy_textformat_clear(npy_textformat *fmt);
+
+NPY_NO_EXPORT int
+npy_textformat_usable(const npy_textformat *fmt, int type_num);
+
+NPY_NO_EXPORT int
+npy_textformat_write(npy_textbuf *buf, const npy_textformat *fmt,
+                     int type_num, const char *data, npy_intp stride);
+
+NPY_NO_EXPORT int
+npy_textrepr_usable(int type_num);
+
+NPY_NO_EXPORT int
+npy_textrepr_write(npy_textbuf *buf, int type_num, const char *data);
+
+NPY_NO_EXPORT PyObject *
+arr_format_rows(PyObject *NPY_UNUSED(self), PyObject *args);
+
+#endif
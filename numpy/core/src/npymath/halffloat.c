@@ -13,6 +13,20 @@
 #define NPY_HALF_GENERATE_UNDERFLOW 1
 #define NPY_HALF_GENERATE_INVALID 1
 
+/*
+ * The bulk conversions can use the F16C and AVX512F instructions, they are
+ * compiled with gcc target attributes and selected at runtime.
+ */
+#if defined HAVE_IMMINTRIN_H && defined HAVE___BUILTIN_CPU_SUPPORTS
+#include <immintrin.h>
+#  ifdef HAVE_ATTRIBUTE_TARGET_F16C
+#    define HALF_F16C_DISPATCH 1
+#  endif
+#  ifdef HAVE_ATTRIBUTE_TARGET_AVX512F
+#    define HALF_AVX512F_DISPATCH 1
+#  endif
+#endif
+
 /*
  ********************************************************************
  *                   HALF-PRECISION ROUTINES                        *
@@ -527,3 +541,220 @@ npy_uint64 npy_halfbits_to_doublebits(npy_uint16 h)
             return d_sgn + (((npy_uint64)(h&0x7fffu) + 0xfc000u) << 42);
     }
 }
+
+/*
+ ********************************************************************
+ *                       BULK CONVERSIONS                           *
+ ********************************************************************
+ */
+
+/*
+ * The hardware conversions are only used for blocks where they give the
+ * same results and floating point flags as the bit-level routines above.
+ * Blocks containing NaNs (whose payload would be quieted) or values which
+ * overflow or underflow are converted with the generic code instead.
+ */
+
+#ifdef HALF_F16C_DISPATCH
+
+static NPY_GCC_TARGET_F16C void
+half_to_float_f16c(float *dst, const npy_half *src, npy_intp n)
+{
+    const __m128i absmask = _mm_set1_epi16(0x7fff);
+    const __m128i expmask = _mm_set1_epi16(0x7c00);
+    npy_intp i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i isnan = _mm_cmpgt_epi16(_mm_and_si128(h, absmask), expmask);
+
+        if (_mm_movemask_epi8(isnan) == 0) {
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+        }
+        else {
+            npy_intp j;
+            for (j = i; j < i + 8; j++) {
+                dst[j] = npy_half_to_float(src[j]);
+            }
+        }
+    }
+    for (; i < n; i++) {
+        dst[i] = npy_half_to_float(src[i]);
+    }
+}
+
+static NPY_GCC_TARGET_F16C void
+float_to_half_f16c(npy_half *dst, const float *src, npy_intp n)
+{
+    const __m256 absmask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 inf = _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000));
+    /* smallest normal half and first value rounding to half infinity */
+    const __m256 lo = _mm256_set1_ps(6.103515625e-05f);
+    const __m256 hi = _mm256_set1_ps(65520.f);
+    npy_intp i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256 f = _mm256_loadu_ps(src + i);
+        __m256 a = _mm256_and_ps(f, absmask);
+        __m256 exact = _mm256_or_ps(_mm256_cmp_ps(a, zero, _CMP_EQ_OQ),
+                                    _mm256_cmp_ps(a, inf, _CMP_EQ_OQ));
+        __m256 normal = _mm256_and_ps(_mm256_cmp_ps(a, lo, _CMP_GE_OQ),
+                                      _mm256_cmp_ps(a, hi, _CMP_LT_OQ));
+
+        if (_mm256_movemask_ps(_mm256_or_ps(exact, normal)) == 0xff) {
+            _mm_storeu_si128((__m128i *)(dst + i),
+                             _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+        }
+        else {
+            npy_intp j;
+            for (j = i; j < i + 8; j++) {
+                dst[j] = npy_float_to_half(src[j]);
+            }
+        }
+    }
+    for (; i < n; i++) {
+        dst[i] = npy_float_to_half(src[i]);
+    }
+}
+
+#endif /* HALF_F16C_DISPATCH */
+
+#ifdef HALF_AVX512F_DISPATCH
+
+static NPY_GCC_TARGET_AVX512F void
+half_to_float_avx512f(float *dst, const npy_half *src, npy_intp n)
+{
+    const __m256i absmask = _mm256_set1_epi16(0x7fff);
+    const __m256i expmask = _mm256_set1_epi16(0x7c00);
+    npy_intp i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        __m256i h = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i isnan = _mm256_cmpgt_epi16(_mm256_and_si256(h, absmask),
+                                           expmask);
+
+        if (_mm256_movemask_epi8(isnan) == 0) {
+            _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+        }
+        else {
+            npy_intp j;
+            for (j = i; j < i + 16; j++) {
+                dst[j] = npy_half_to_float(src[j]);
+            }
+        }
+    }
+    for (; i < n; i++) {
+        dst[i] = npy_half_to_float(src[i]);
+    }
+}
+
+static NPY_GCC_TARGET_AVX512F void
+float_to_half_avx512f(npy_half *dst, const float *src, npy_intp n)
+{
+    const __m512i absmask = _mm512_set1_epi32(0x7fffffff);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 inf = _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000));
+    /* smallest normal half and first value rounding to half infinity */
+    const __m512 lo = _mm512_set1_ps(6.103515625e-05f);
+    const __m512 hi = _mm512_set1_ps(65520.f);
+    npy_intp i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        __m512 f = _mm512_loadu_ps(src + i);
+        __m512 a = _mm512_castsi512_ps(
+                        _mm512_and_epi32(_mm512_castps_si512(f), absmask));
+        __mmask16 exact = _mm512_cmp_ps_mask(a, zero, _CMP_EQ_OQ) |
+                          _mm512_cmp_ps_mask(a, inf, _CMP_EQ_OQ);
+        __mmask16 normal = _mm512_cmp_ps_mask(a, lo, _CMP_GE_OQ) &
+                           _mm512_cmp_ps_mask(a, hi, _CMP_LT_OQ);
+
+        if ((npy_uint16)(exact | normal) == 0xffffu) {
+            _mm256_storeu_si256((__m256i *)(dst + i),
+                                _mm512_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+        }
+        else {
+            npy_intp j;
+            for (j = i; j < i + 16; j++) {
+                dst[j] = npy_float_to_half(src[j]);
+            }
+        }
+    }
+    for (; i < n; i++) {
+        dst[i] = npy_float_to_half(src[i]);
+    }
+}
+
+#endif /* HALF_AVX512F_DISPATCH */
+
+typedef void (half_to_float_contig_fn)(float *, const npy_half *, npy_intp);
+typedef void (float_to_half_contig_fn)(npy_half *, const float *, npy_intp);
+
+static void
+half_to_float_generic(float *dst, const npy_half *src, npy_intp n)
+{
+    npy_intp i;
+    for (i = 0; i < n; i++) {
+        dst[i] = npy_half_to_float(src[i]);
+    }
+}
+
+static void
+float_to_half_generic(npy_half *dst, const float *src, npy_intp n)
+{
+    npy_intp i;
+    for (i = 0; i < n; i++) {
+        dst[i] = npy_float_to_half(src[i]);
+    }
+}
+
+static half_to_float_contig_fn *
+get_half_to_float_contig(void)
+{
+#ifdef HALF_AVX512F_DISPATCH
+    if (__builtin_cpu_supports("avx512f")) {
+        return &half_to_float_avx512f;
+    }
+#endif
+#ifdef HALF_F16C_DISPATCH
+    if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) {
+        return &half_to_float_f16c;
+    }
+#endif
+    return &half_to_float_generic;
+}
+
+static float_to_half_contig_fn *
+get_float_to_half_contig(void)
+{
+#ifdef HALF_AVX512F_DISPATCH
+    if (__builtin_cpu_supports("avx512f")) {
+        return &float_to_half_avx512f;
+    }
+#endif
+#ifdef HALF_F16C_DISPATCH
+    if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) {
+        return &float_to_half_f16c;
+    }
+#endif
+    return &float_to_half_generic;
+}
+
+void npy_half_to_float_contig(float *dst, const npy_half *src, npy_intp n)
+{
+    /* racing initializations store the same pointer */
+    static half_to_float_contig_fn *fn = NULL;
+    if (fn == NULL) {
+        fn = get_half_to_float_contig();
+    }
+    fn(dst, src, n);
+}
+
+void npy_float_to_half_contig(npy_half *dst, const float *src, npy_intp n)
+{
+    static float_to_half_contig_fn *fn = NULL;
+    if (fn == NULL) {
+        fn = get_float_to_half_contig();
+    }
+    fn(dst, src, n);
+}
@@ -199,6 +199,10 @@ PyArray_GetDTypeCopySwapFn(int aligned,
  *          first destination reference will get the value and all the rest
  *          will get NULL.
  *
+ * The transfer functions for structured, subarray and datetime dtypes
+ * are cached by dtype instance, strides and flags, a cache hit returns
+ * a clone of the cached auxiliary data.
+ *
  * Returns NPY_SUCCEED or NPY_FAIL.
  */
 NPY_NO_EXPORT int
@@ -210,6 +214,13 @@ PyArray_GetDTypeTransferFunction(int aligned,
                             NpyAuxData **out_transferdata,
                             int *out_needs_api);
 
+/*
+ * Empties the cache of PyArray_GetDTypeTransferFunction, this must be
+ * called whenever a dtype is modified in place.
+ */
+NPY_NO_EXPORT void
+PyArray_ClearDTypeTransferCache(void);
+
 /*
  * This is identical to PyArray_GetDTypeTransferFunction, but returns a
  * transfer function which also takes a mask as a parameter.  The mask is used
@@ -524,6 +535,18 @@ npy_bswap8_unaligned(char * x)
     a = x[3]; x[3] = x[4]; x[4] = a;
 }
 
+/*
+ * Byte swaps the leading part of n contiguous items of the given size
+ * (2, 4, 8 or 16) from src into dst using SIMD instructions when the
+ * cpu supports them. src and dst may be the same buffer but must not
+ * otherwise overlap. Alignment is not required.
+ *
+ * Returns the number of items which have been swapped, the caller must
+ * handle the remaining tail itself.
+ */
+NPY_NO_EXPORT npy_intp
+npy_bswap_contig(char *dst, char *src, npy_intp n, int size);
+
 
 /* Start raw iteration */
 #define NPY_RAW_ITER_START(idim, ndim, coord, shape) \
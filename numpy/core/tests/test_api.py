@@ -285,6 +285,37 @@ def test_array_astype():
     a = np.array(1000, dtype='i4')
     assert_raises(TypeError, a.astype, 'U1', casting='safe')
 
+def test_string_to_number_astype():
+    # Plain decimal strings are parsed natively, everything else goes
+    # through int() and float(), both must give the same results
+    floats = ['1', '-12', ' 7\t', '007', '1.5', '-0', '.5', '5.', '+.5e+2',
+              '1E-3', '0.1', '2.5e-10', '1e22', '1e23', '1e400',
+              '9007199254740993', '3.14159265358979323846', '1_0',
+              'nan', '-Infinity']
+    ints = ['1', '-12', ' 7\t', '007', '+0', '300', '-129', '4294967296',
+            '999999999999999999', '-9223372036854775808']
+    if sys.version_info[:2] < (3, 6):
+        floats.remove('1_0')
+    for kind in 'SU':
+        # long enough that the conversion releases the GIL
+        a = np.array(floats * 50, dtype=kind + '30')
+        for dt in [np.float16, np.float32, np.float64, np.longdouble]:
+            expected = np.array([float(x) for x in floats * 50]).astype(dt)
+            assert_array_equal(a.astype(dt), expected)
+        a = np.array(ints * 50, dtype=kind + '30')
+        for dt in [np.bool_, np.int8, np.uint8, np.int32, np.uint32,
+                   np.int64]:
+            expected = np.array([int(x) for x in ints * 50],
+                                dtype=np.int64).astype(dt)
+            assert_array_equal(a.astype(dt), expected)
+
+        for bad in ['', ' ', '1e', '1.5.', '- 1', '0x10', '1 2']:
+            a = np.array(['1'] * 600 + [bad], dtype=kind + '5')
+            assert_raises(ValueError, a.astype, np.float64)
+            assert_raises(ValueError, a.astype, np.int64)
+        a = np.array(['1.5'], dtype=kind + '5')
+        assert_raises(ValueError, a.astype, np.int64)
+
 def test_copyto_fromscalar():
     a = np.arange(6, dtype='f4').reshape(2, 3)
 
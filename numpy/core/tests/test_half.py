@@ -328,6 +328,62 @@ class TestHalf(TestCase):
         assert_equal(np.frexp(b), ([-0.5, 0.625, 0.5, 0.5, 0.75], [2, 3, 1, 3, 2]))
         assert_equal(np.ldexp(b, [0, 1, 2, 4, 2]), [-2, 10, 4, 64, 12])
 
+    def test_half_contiguous_blocks(self):
+        """Check the vectorized contiguous paths against strided ones"""
+        # Contiguous casts and ufuncs convert blocks of data, blocks
+        # containing NaNs, subnormals or overflows must give the same bits
+        # and floating point errors as the element-wise conversions.
+        a16 = self.all_f16
+        s16 = np.zeros(2 * a16.size, dtype=float16)[::2]
+        s16[...] = a16
+        assert_equal(np.array(a16, dtype=float32).view(uint16),
+                     np.array(s16, dtype=float32).view(uint16))
+
+        f32 = np.linspace(-70000, 70000, 10001).astype(float32)
+        f32 = np.concatenate((f32, f32 * 2.**-20, f32 * 2.**-30,
+                              self.all_f32))
+        s32 = np.zeros(2 * f32.size, dtype=float32)[::2]
+        s32[...] = f32
+        with np.errstate(all='ignore'):
+            assert_equal(np.array(f32, dtype=float16).view(uint16),
+                         np.array(s32, dtype=float16).view(uint16))
+
+        i32 = np.arange(-70000, 70000, 7, dtype=np.int32)
+        with np.errstate(all='ignore'):
+            assert_equal(np.array(i32, dtype=float16),
+                         np.array(i32[::-1], dtype=float16)[::-1])
+        assert_equal(np.array(self.finite_f16, dtype=np.int64),
+                     np.array(self.finite_f16[::-1], dtype=np.int64)[::-1])
+
+        a16 = self.finite_f16
+        s16 = np.zeros(2 * a16.size, dtype=float16)[::2]
+        s16[...] = a16
+        b16 = a16[::-1].copy()
+        with np.errstate(all='ignore'):
+            for func in (np.add, np.subtract, np.multiply, np.divide,
+                         np.arctan2):
+                assert_equal(func(a16, b16), func(s16, b16))
+                assert_equal(func(a16, float16(3)), func(s16, float16(3)))
+                assert_equal(func(float16(-0.5), b16),
+                             func(float16(-0.5), b16[::-1])[::-1])
+            for func in (np.square, np.reciprocal, np.sin):
+                assert_equal(func(a16), func(s16))
+        assert_equal(a16[:1000].sum(), s16[:1000].sum())
+
+        # in-place operations on the blocks
+        c = a16.copy()
+        c *= float16(0.5)
+        assert_equal(c, s16 * float16(0.5))
+
+        # the floating point errors are still detected inside of blocks
+        with np.errstate(all='raise'):
+            big = np.ones(300, dtype=float16)
+            big[200] = 1e4
+            assert_raises_fpe('overflow', np.multiply, big, big)
+            small = np.ones(300, dtype=float16)
+            small[200] = 1e-4
+            assert_raises_fpe('underflow', np.multiply, small, small)
+
     def test_half_coercion(self):
         """Test that half gets coerced properly with the other types"""
         a16 = np.array((1,), dtype=float16)
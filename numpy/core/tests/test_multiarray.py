@@ -839,6 +839,73 @@ class TestStructured(TestCase):
             t = [('a', '>i4'), ('b', '<f8'), ('c', 'i4')]
             assert_(not np.can_cast(a.dtype, t, casting=casting))
 
+    def test_casting_repeated(self):
+        # Structured transfer functions are cached by dtype, check that
+        # repeated casts give the same results and that the cache notices
+        # in place changes of the dtypes
+        src = np.dtype([('a', '>i4'), ('b', '<f8'), ('c', 'O')])
+        dst = np.dtype([('b', 'i8'), ('a', '>f4'), ('c', 'O')])
+        a = np.array([(1, 2.5, 'x'), (3, 4.5, None)], dtype=src)
+        for i in range(3):
+            for x in [a, a[::-1], a[:1]]:
+                b = x.astype(dst)
+                assert_equal(b['a'], x['a'])
+                assert_equal(b['b'], x['b'].astype('i8'))
+                assert_equal(b['c'], x['c'])
+
+        src.names = ['b', 'a', 'c']
+        b = a.astype(dst)
+        assert_equal(b['a'], [2.5, 4.5])
+        assert_equal(b['b'], [1, 3])
+
+        # the complex warning must be given for every cast
+        src = np.dtype([('a', '>c16')])
+        dst = np.dtype([('a', 'f8')])
+        a = np.ones(3, dtype=src)
+        with warnings.catch_warnings(record=True) as w:
+            warnings.simplefilter('always', np.ComplexWarning)
+            for i in range(3):
+                a.astype(dst)
+            assert_equal(len(w), 3)
+
+    def test_casting_field_layouts(self):
+        # Fields which are plain copies get merged into larger copies,
+        # check reordered, subset, offset and mixed layouts
+        src = np.dtype({'names': ['a', 'b', 'c', 'd', 'e'],
+                        'formats': ['i4', 'i4', 'f8', 'i2', 'O'],
+                        'offsets': [0, 4, 8, 20, 24]})
+        a = np.zeros(7, dtype=src)
+        for i, name in enumerate(src.names):
+            a[name] = np.arange(7) * (i + 1)
+
+        dsts = [
+            # same fields, packed
+            [('a', 'i4'), ('b', 'i4'), ('c', 'f8'), ('d', 'i2'), ('e', 'O')],
+            # reordered
+            [('d', 'i2'), ('c', 'f8'), ('a', 'i4'), ('b', 'i4')],
+            # subsets, the first one is a single contiguous run
+            [('a', 'i4'), ('b', 'i4'), ('c', 'f8')],
+            [('b', 'i4'), ('d', 'i2')],
+            # a cast in the middle of a run and a new field
+            [('a', 'i4'), ('b', 'i8'), ('c', 'f8'), ('x', 'i4')],
+            # same names at other offsets
+            {'names': ['a', 'b', 'c'], 'formats': ['i4', 'i4', 'f8'],
+             'offsets': [16, 20, 0], 'itemsize': 32},
+            ]
+        for dst in dsts:
+            dst = np.dtype(dst)
+            for x in [a, a[::2], a[::-1]]:
+                b = x.astype(dst)
+                for name in dst.names:
+                    if name in src.names:
+                        assert_equal(b[name], x[name])
+                    else:
+                        assert_equal(b[name], 0)
+                # also assign into a structured array with other data
+                c = np.ones(len(x), dtype=dst)
+                c[...] = x
+                assert_equal(c, b)
+
     def test_objview(self):
         # https://github.com/numpy/numpy/issues/3286
         a = np.array([], dtype=[('a', 'f'), ('b', 'f'), ('c', 'O')])
@@ -2183,6 +2250,25 @@ class TestMethods(TestCase):
                     if k == 1:
                         b = c
 
+    def test_byteswap_contiguous(self):
+        # contiguous swaps are done in SIMD sized blocks, check all lengths
+        # around the block sizes and unaligned data against a bytewise swap
+        for dt in ['i2', 'u4', 'f8', 'g', 'c8', 'c16']:
+            dt = np.dtype(dt)
+            part = dt.itemsize // 2 if dt.kind == 'c' else dt.itemsize
+            for n in range(40):
+                for offset in [0, 1]:
+                    buf = np.arange(n * dt.itemsize + offset, dtype=np.uint8)
+                    a = buf[offset:].view(dt)
+                    expected = a.view(np.uint8).reshape(-1, part)[:, ::-1]
+                    expected = expected.ravel()
+                    assert_equal(a.byteswap().view(np.uint8), expected)
+                    # converting to the other byte order swaps as well
+                    b = a.astype(dt.newbyteorder())
+                    assert_equal(b.view(np.uint8), expected)
+                    a.byteswap(True)
+                    assert_equal(a.view(np.uint8), expected)
+
     def test_conjugate(self):
         a = np.array([1-1j, 1+1j, 23+23.0j])
         ac = a.conj()
@@ -3535,6 +3621,82 @@ class TestIO(object):
         assert_(y.dtype == '?')
         assert_array_equal(y, v)
 
+    def test_integer_types(self):
+        for t in np.typecodes['AllInteger']:
+            if t in np.typecodes['UnsignedInteger']:
+                s = '3, 7, 0012, 255'
+                v = np.array([3, 7, 12, 255], dtype=t)
+            else:
+                s = '-3, +7, 0012, 127'
+                v = np.array([-3, 7, 12, 127], dtype=t)
+            self._check_from(s, v, dtype=t, sep=',')
+
+    def test_large_integers(self):
+        s = '9223372036854775807 -9223372036854775808 1234567890123456789'
+        v = np.array([9223372036854775807, -9223372036854775808,
+                      1234567890123456789], dtype=np.int64)
+        self._check_from(s, v, dtype=np.int64, sep=' ')
+
+    def test_float_types(self):
+        s = '1.5, -2.25e3, .125, 1e-10, 3.4028235e38'
+        for t in 'efd':
+            v = np.array([1.5, -2.25e3, .125, 1e-10, 3.4028235e38], dtype=t)
+            self._check_from(s, v, dtype=t, sep=',')
+
+    def test_long_mantissas(self):
+        # values whose rounding depends on digits past the 15th
+        x = np.random.RandomState(0).standard_normal(10000)
+        x *= 10.0 ** np.arange(-300, 300, 0.06)
+        for fmt in ['%r', '%.17e', '%.30e']:
+            s = ' '.join(fmt % v for v in x)
+            v = np.array([float(fmt % v) for v in x])
+            self._check_from(s, v, sep=' ')
+        s = ('9007199254740993 9007199254740993.0000000000000000001 '
+             '1.00000000000000011102230246251565404236316680908203125 '
+             '1.00000000000000011102230246251565404236316680908203126 '
+             '2.2250738585072011e-308 4.9406564584124654e-324 '
+             '1797693134862315807937289714053034150799341327710e259 '
+             '0.000000000000000000001234567890123456789012345e21')
+        v = np.array([float(t) for t in s.split()])
+        self._check_from(s, v, sep=' ')
+
+    def test_exponent_without_digits(self):
+        f = open(self.filename, 'wb')
+        f.write(b'1.5e,3')
+        f.close()
+        y = np.fromfile(self.filename, sep=',')
+        assert_array_equal(y, [1.5, 3.])
+
+    def test_many_blocks(self):
+        # the text readers parse files in blocks, check elements
+        # that straddle the block boundaries
+        x = np.arange(0.25, 50000, 0.5)
+        s = '  \n'.join(map(repr, x))
+        self._check_from(s, x, sep=' ')
+        self._check_from(' ' * 100000 + '1 2', [1., 2.], sep=' ')
+        self._check_from('1' + '0' * 100 + ' ' * 70000 + ',2', [1e100, 2.],
+                         sep=',')
+        x = np.arange(100000) - 50000
+        self._check_from(','.join(map(str, x)), x, dtype=int, sep=',')
+
+    def test_file_position_after_text(self):
+        f = open(self.filename, 'wb')
+        f.write(b'HDR 1,2,3,4 end')
+        f.close()
+        f = open(self.filename, 'rb')
+        assert_equal(f.read(4), b'HDR ')
+        y = np.fromfile(f, dtype=int, sep=',', count=2)
+        assert_array_equal(y, [1, 2])
+        # the separator after the last element is consumed
+        assert_equal(f.read(), b'3,4 end')
+        f.close()
+        f = open(self.filename, 'rb')
+        f.read(4)
+        y = np.fromfile(f, dtype=int, sep=',')
+        assert_array_equal(y, [1, 2, 3, 4])
+        assert_equal(f.read(), b'end')
+        f.close()
+
     def test_tofile_sep(self):
         x = np.array([1.51, 2, 3.51, 4], dtype=float)
         f = open(self.filename, 'w')
@@ -3557,6 +3719,53 @@ class TestIO(object):
         f.close()
         assert_equal(s, '1.51,2.00,3.51,4.00')
 
+    def _check_tofile_text(self, x, fmt, expected):
+        x.tofile(self.filename, sep=',', format=fmt)
+        with open(self.filename, 'r') as f:
+            s = f.read()
+        assert_equal(s, ','.join(expected))
+
+    def test_tofile_repr(self):
+        # the text is the repr of the elements' Python objects
+        floats = [0.1, 1/3., -0.0, 0.0, 2.0, 1e16, 1.5e16, 1e-5, 1e-4,
+                  123.456, 5e-324, 2.0**-1074, 2.0**1023, 2.0**60,
+                  1.7976931348623157e308, 562949953421312.25,
+                  np.nan, np.inf, -np.inf]
+        x = np.array(floats + list(np.random.standard_normal(100) *
+                                   10.0**np.arange(-50, 50)))
+        for dt in [np.float64, np.float32, np.float16]:
+            y = x.astype(dt)
+            self._check_tofile_text(y, '', [repr(v) for v in y.tolist()])
+        z = x[:60] + 1j*x[-60:]
+        z[:3] = [1j, complex(-0.0, 2), complex(1, np.nan)]
+        for dt in [np.complex128, np.complex64]:
+            y = z.astype(dt)
+            self._check_tofile_text(y, '', [repr(v) for v in y.tolist()])
+        for dt in np.typecodes['AllInteger'] + '?':
+            y = np.array([0, 1, 5, 127, 100], dtype=dt)
+            if dt in np.typecodes['Integer']:
+                y[1:3] *= -1
+            self._check_tofile_text(y, '', [repr(v) for v in y.tolist()])
+        y = x.astype('>f8')
+        self._check_tofile_text(y, '', [repr(v) for v in y.tolist()])
+
+    def test_tofile_format_like_python(self):
+        x = np.array([0.1, -2.5, 1e300, 7, -0.0, 1e-10, np.nan, -np.inf])
+        i = np.array([0, 1, -1, 255, 2**31 - 1])
+        u = np.array([0, 1, 2**64 - 1], dtype=np.uint64)
+        for y in [x, x.astype(np.float32), x.astype(np.longdouble), i, u]:
+            for fmt in ['%.18e', '%g', '%10.3f', '%-+8.2E|', '%#.0f']:
+                self._check_tofile_text(y, fmt,
+                                        [fmt % v for v in y.tolist()])
+        for y in [x[:6], x[:2].astype(np.float32), i, u]:
+            for fmt in ['%05d', '%.0d', '%i']:
+                self._check_tofile_text(y, fmt,
+                                        [fmt % v for v in y.tolist()])
+        for y in [i, u, i.astype(np.int8)]:
+            for fmt in ['%x', '%08X', '%o', '%+x', '%#x']:
+                self._check_tofile_text(y, fmt,
+                                        [fmt % v for v in y.tolist()])
+
     def test_locale(self):
         in_foreign_locale(self.test_numbers)()
         in_foreign_locale(self.test_nan)()
@@ -3566,6 +3775,7 @@ class TestIO(object):
         in_foreign_locale(self.test_malformed)()
         in_foreign_locale(self.test_tofile_sep)()
         in_foreign_locale(self.test_tofile_format)()
+        in_foreign_locale(self.test_tofile_repr)()
 
 
 class TestFromBuffer(object):
@@ -7,21 +7,40 @@
 extern "C" {
 #endif
 
-#define DOUBLE
+extern NPY_VISIBILITY_HIDDEN void npy_cfftf(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftb(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cffti(int N, double wrk[]);
 
-#ifdef DOUBLE
-#define Treal double
-#else
-#define Treal float
-#endif
+extern NPY_VISIBILITY_HIDDEN void npy_rfftf(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftb(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rffti(int N, double wrk[]);
+
+extern NPY_VISIBILITY_HIDDEN void npy_cfftff(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftbf(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftif(int N, float wrk[]);
+
+extern NPY_VISIBILITY_HIDDEN void npy_rfftff(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftbf(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftif(int N, float wrk[]);
 
-extern NPY_VISIBILITY_HIDDEN void npy_cfftf(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_cfftb(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_cffti(int N, Treal wrk[]);
+extern NPY_VISIBILITY_HIDDEN int npy_bluestein_length(int N, int real);
+extern NPY_VISIBILITY_HIDDEN void npy_bluesteini(int N, int M, double wrk[]);
+extern NPY_VISIBILITY_HIDDEN void npy_bluestein(int N, int M, double data[], const double wrk[],
+                                                double scratch[], int isign);
+extern NPY_VISIBILITY_HIDDEN void npy_bluesteinif(int N, int M, float wrk[]);
+extern NPY_VISIBILITY_HIDDEN void npy_bluesteinf(int N, int M, float data[], const float wrk[],
+                                                 float scratch[], int isign);
 
-extern NPY_VISIBILITY_HIDDEN void npy_rfftf(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_rfftb(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_rffti(int N, Treal wrk[]);
+extern NPY_VISIBILITY_HIDDEN int npy_fft_lanes(void);
+extern NPY_VISIBILITY_HIDDEN int npy_fft_lanesf(void);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftf_lanes(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftb_lanes(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftf_lanes(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftb_lanes(int N, double data[], const double wrk[], double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftf_lanesf(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftb_lanesf(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftf_lanesf(int N, float data[], const float wrk[], float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftb_lanesf(int N, float data[], const float wrk[], float scratch[]);
 
 #ifdef __cplusplus
 }
@@ -35,16 +35,110 @@ from __future__ import division, absolute_import, print_function
 __all__ = ['fft', 'ifft', 'rfft', 'irfft', 'hfft', 'ihfft', 'rfftn',
            'irfftn', 'rfft2', 'irfft2', 'fft2', 'ifft2', 'fftn', 'ifftn']
 
-from numpy.core import (array, asarray, zeros, swapaxes, shape, conjugate,
-                        take, sqrt)
+import operator
+import threading
+
+from numpy.core import (array, asarray, zeros, empty, shape, conjugate,
+                        take, sqrt, single, double, csingle, cdouble)
 from . import fftpack_lite as fftpack
+from .helper import _plan_cache
+
+
+def _fft_types(precision):
+    """
+    Return the complex and real types to compute FFTs in for `precision`.
+    """
+    if precision is None:
+        return cdouble, double
+    if precision == "single":
+        return csingle, single
+    raise ValueError("Invalid precision value %s, should be None or "
+                     "\"single\"." % precision)
+
+
+def _get_wsave(n, dtype, init_function):
+    # The work array of a single precision transform is float32, and the
+    # work functions pick the precision from it.  They only read it, so
+    # all threads share the one in the plan cache.
+    return _plan_cache.get((init_function.__name__, n, dtype),
+                           lambda: init_function(n, dtype))
+
 
-_fft_cache = {}
-_real_fft_cache = {}
+# Smallest number of elements worth giving a thread of its own.
+_THREAD_MIN_SIZE = 1 << 15
+
+
+def _cpu_count():
+    import multiprocessing
+    try:
+        return multiprocessing.cpu_count()
+    except NotImplementedError:
+        return 1
+
+
+def _nthreads(workers):
+    if workers is None:
+        return 1
+    nthreads = operator.index(workers)
+    if nthreads < 0:
+        nthreads += _cpu_count() + 1
+    if nthreads < 1:
+        raise ValueError("Invalid number of workers (%d) specified."
+                         % workers)
+    return nthreads
+
+
+def _split(shape, axes, nthreads):
+    """
+    Return the indices splitting an array of `shape` into at most `nthreads`
+    parts along its longest axis that is not in `axes`, or None if it is
+    not worth splitting.
+    """
+    rest = [i for i in range(len(shape)) if i not in axes]
+    if nthreads < 2 or not rest:
+        return None
+    split = max(rest, key=lambda i: shape[i])
+    size = 1
+    for m in shape:
+        size *= m
+    nparts = min(nthreads, shape[split], size // _THREAD_MIN_SIZE)
+    if nparts < 2:
+        return None
+    index = [slice(None)]*len(shape)
+    parts = []
+    for i in range(nparts):
+        index[split] = slice(shape[split]*i // nparts,
+                             shape[split]*(i + 1) // nparts)
+        parts.append(tuple(index))
+    return parts
+
+
+def _run_parts(transform, a, r, parts):
+    # The work functions release the GIL, so the parts of `a` are
+    # transformed into those of `r` concurrently, the first one in the
+    # calling thread.
+    errors = []
+
+    def run(index):
+        try:
+            transform(a[index], r[index])
+        except BaseException as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=run, args=(index,))
+               for index in parts[1:]]
+    for t in threads:
+        t.start()
+    run(parts[0])
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
+    return r
 
 
 def _raw_fft(a, n=None, axis=-1, init_function=fftpack.cffti,
-             work_function=fftpack.cfftf, fft_cache=_fft_cache):
+             work_function=fftpack.cfftf, workers=None, precision=None):
     a = asarray(a)
 
     if n is None:
@@ -54,13 +148,8 @@ def _raw_fft(a, n=None, axis=-1, init_function=fftpack.cffti,
         raise ValueError("Invalid number of FFT data points (%d) specified."
                          % n)
 
-    try:
-        # Thread-safety note: We rely on list.pop() here to atomically
-        # retrieve-and-remove a wsave from the cache.  This ensures that no
-        # other thread can get the same wsave while we're using it.
-        wsave = fft_cache.setdefault(n, []).pop()
-    except (IndexError):
-        wsave = init_function(n)
+    ctype, dtype = _fft_types(precision)
+    nthreads = _nthreads(workers)
 
     if a.shape[axis] != n:
         s = list(a.shape)
@@ -76,18 +165,23 @@ def _raw_fft(a, n=None, axis=-1, init_function=fftpack.cffti,
             z[index] = a
             a = z
 
-    if axis != -1:
-        a = swapaxes(a, axis, -1)
-    r = work_function(a, wsave)
-    if axis != -1:
-        r = swapaxes(r, axis, -1)
+    wsave = _get_wsave(n, dtype, init_function)
 
-    # As soon as we put wsave back into the cache, another thread could pick it
-    # up and start using it, so we must not do this until after we're
-    # completely done using it ourselves.
-    fft_cache[n].append(wsave)
+    def transform(a, out=None):
+        # The work functions transform along any axis themselves.
+        return work_function(a, wsave, axis, out)
 
-    return r
+    parts = None
+    if -a.ndim <= axis < a.ndim:
+        parts = _split(a.shape, [axis % a.ndim], nthreads)
+    if parts is None:
+        return transform(a)
+
+    s = list(a.shape)
+    if work_function is fftpack.rfftf:
+        s[axis] = n//2 + 1
+    r = empty(s, dtype if work_function is fftpack.rfftb else ctype)
+    return _run_parts(transform, a, r, parts)
 
 
 def _unitary(norm):
@@ -97,7 +191,7 @@ def _unitary(norm):
     return norm is not None
 
 
-def fft(a, n=None, axis=-1, norm=None):
+def fft(a, n=None, axis=-1, norm=None, workers=None, precision=None):
     """
     Compute the one-dimensional discrete Fourier Transform.
 
@@ -120,6 +214,17 @@ def fft(a, n=None, axis=-1, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -183,16 +288,17 @@ def fft(a, n=None, axis=-1, norm=None):
 
     """
 
-    a = asarray(a).astype(complex)
+    a = asarray(a).astype(_fft_types(precision)[0])
     if n is None:
         n = a.shape[axis]
-    output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftf, _fft_cache)
+    output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftf, workers,
+                      precision)
     if _unitary(norm):
         output *= 1 / sqrt(n)
     return output
 
 
-def ifft(a, n=None, axis=-1, norm=None):
+def ifft(a, n=None, axis=-1, norm=None, workers=None, precision=None):
     """
     Compute the one-dimensional inverse discrete Fourier Transform.
 
@@ -230,6 +336,17 @@ def ifft(a, n=None, axis=-1, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -276,15 +393,16 @@ def ifft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = array(a, copy=True, dtype=_fft_types(precision)[0])
     if n is None:
         n = a.shape[axis]
     unitary = _unitary(norm)
-    output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftb, _fft_cache)
+    output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftb, workers,
+                      precision)
     return output * (1 / (sqrt(n) if unitary else n))
 
 
-def rfft(a, n=None, axis=-1, norm=None):
+def rfft(a, n=None, axis=-1, norm=None, workers=None, precision=None):
     """
     Compute the one-dimensional discrete Fourier Transform for real input.
 
@@ -307,6 +425,17 @@ def rfft(a, n=None, axis=-1, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -362,15 +491,15 @@ def rfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
-    output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftf,
-                      _real_fft_cache)
+    a = array(a, copy=True, dtype=_fft_types(precision)[1])
+    output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftf, workers,
+                      precision)
     if _unitary(norm):
         output *= 1 / sqrt(a.shape[axis])
     return output
 
 
-def irfft(a, n=None, axis=-1, norm=None):
+def irfft(a, n=None, axis=-1, norm=None, workers=None, precision=None):
     """
     Compute the inverse of the n-point DFT for real input.
 
@@ -401,6 +530,17 @@ def irfft(a, n=None, axis=-1, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -450,16 +590,16 @@ def irfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = array(a, copy=True, dtype=_fft_types(precision)[0])
     if n is None:
         n = (a.shape[axis] - 1) * 2
     unitary = _unitary(norm)
-    output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftb,
-                      _real_fft_cache)
+    output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftb, workers,
+                      precision)
     return output * (1 / (sqrt(n) if unitary else n))
 
 
-def hfft(a, n=None, axis=-1, norm=None):
+def hfft(a, n=None, axis=-1, norm=None, workers=None, precision=None):
     """
     Compute the FFT of a signal which has Hermitian symmetry (real spectrum).
 
@@ -479,6 +619,17 @@ def hfft(a, n=None, axis=-1, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -529,14 +680,18 @@ def hfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = array(a, copy=True, dtype=_fft_types(precision)[0])
     if n is None:
         n = (a.shape[axis] - 1) * 2
     unitary = _unitary(norm)
-    return irfft(conjugate(a), n, axis) * (sqrt(n) if unitary else n)
+    output = irfft(conjugate(a), n, axis, workers=workers,
+                   precision=precision)
+    # in place, as a large integer n would promote single precision output
+    output *= sqrt(n) if unitary else n
+    return output
 
 
-def ihfft(a, n=None, axis=-1, norm=None):
+def ihfft(a, n=None, axis=-1, norm=None, workers=None, precision=None):
     """
     Compute the inverse FFT of a signal which has Hermitian symmetry.
 
@@ -556,6 +711,17 @@ def ihfft(a, n=None, axis=-1, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -587,11 +753,12 @@ def ihfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = array(a, copy=True, dtype=_fft_types(precision)[1])
     if n is None:
         n = a.shape[axis]
     unitary = _unitary(norm)
-    output = conjugate(rfft(a, n, axis))
+    output = conjugate(rfft(a, n, axis, workers=workers,
+                            precision=precision))
     return output * (1 / (sqrt(n) if unitary else n))
 
 
@@ -614,17 +781,68 @@ def _cook_nd_args(a, s=None, axes=None, invreal=0):
     return s, axes
 
 
-def _raw_fftnd(a, s=None, axes=None, function=fft, norm=None):
+def _raw_fftnd(a, s=None, axes=None, function=fft, norm=None, workers=None,
+               precision=None):
     a = asarray(a)
     s, axes = _cook_nd_args(a, s, axes)
-    itl = list(range(len(axes)))
-    itl.reverse()
-    for ii in itl:
-        a = function(a, n=s[ii], axis=axes[ii], norm=norm)
-    return a
+    axes = [range(a.ndim)[axis] for axis in axes]
+    if len(set(axes)) != len(axes):
+        # Repeated axes are transformed once for each time they appear.
+        itl = list(range(len(axes)))
+        itl.reverse()
+        for ii in itl:
+            a = function(a, n=s[ii], axis=axes[ii], norm=norm,
+                         workers=workers, precision=precision)
+        return a
+    if not axes:
+        return a
+
+    # Crop and pad all axes at once, fftpack_lite then makes one copy and
+    # transforms it along each axis in place.
+    ctype, dtype = _fft_types(precision)
+    shape = list(a.shape)
+    for n, axis in zip(s, axes):
+        if n < 1:
+            raise ValueError("Invalid number of FFT data points (%d) "
+                             "specified." % n)
+        shape[axis] = n
+    if shape != list(a.shape):
+        index = tuple(slice(0, min(n, m)) for n, m in zip(shape, a.shape))
+        z = zeros(shape, ctype)
+        z[index] = a[index]
+        a = z
+    elif precision is not None:
+        # fftpack_lite only casts safely to the precision of the plans
+        a = asarray(a, ctype)
+
+    if function is ifft:
+        work_function = fftpack.cfftb
+    else:
+        work_function = fftpack.cfftf
 
+    wsaves = [_get_wsave(n, dtype, fftpack.cffti) for n in s]
 
-def fftn(a, s=None, axes=None, norm=None):
+    def transform(a, out=None):
+        return work_function(a, wsaves, axes, out)
+
+    parts = _split(a.shape, axes, _nthreads(workers))
+    if parts is None:
+        r = transform(a)
+    else:
+        r = _run_parts(transform, a, empty(a.shape, ctype), parts)
+
+    size = 1
+    for n in s:
+        size *= n
+    unitary = _unitary(norm)
+    if function is ifft:
+        r *= 1 / (sqrt(size) if unitary else size)
+    elif unitary:
+        r *= 1 / sqrt(size)
+    return r
+
+
+def fftn(a, s=None, axes=None, norm=None, workers=None, precision=None):
     """
     Compute the N-dimensional discrete Fourier Transform.
 
@@ -652,6 +870,17 @@ def fftn(a, s=None, axes=None, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -717,10 +946,10 @@ def fftn(a, s=None, axes=None, norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, fft, norm)
+    return _raw_fftnd(a, s, axes, fft, norm, workers, precision)
 
 
-def ifftn(a, s=None, axes=None, norm=None):
+def ifftn(a, s=None, axes=None, norm=None, workers=None, precision=None):
     """
     Compute the N-dimensional inverse discrete Fourier Transform.
 
@@ -757,6 +986,17 @@ def ifftn(a, s=None, axes=None, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -813,10 +1053,10 @@ def ifftn(a, s=None, axes=None, norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, ifft, norm)
+    return _raw_fftnd(a, s, axes, ifft, norm, workers, precision)
 
 
-def fft2(a, s=None, axes=(-2, -1), norm=None):
+def fft2(a, s=None, axes=(-2, -1), norm=None, workers=None, precision=None):
     """
     Compute the 2-dimensional discrete Fourier Transform
 
@@ -845,6 +1085,17 @@ def fft2(a, s=None, axes=(-2, -1), norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -902,10 +1153,10 @@ def fft2(a, s=None, axes=(-2, -1), norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, fft, norm)
+    return _raw_fftnd(a, s, axes, fft, norm, workers, precision)
 
 
-def ifft2(a, s=None, axes=(-2, -1), norm=None):
+def ifft2(a, s=None, axes=(-2, -1), norm=None, workers=None, precision=None):
     """
     Compute the 2-dimensional inverse discrete Fourier Transform.
 
@@ -941,6 +1192,17 @@ def ifft2(a, s=None, axes=(-2, -1), norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -988,10 +1250,10 @@ def ifft2(a, s=None, axes=(-2, -1), norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, ifft, norm)
+    return _raw_fftnd(a, s, axes, ifft, norm, workers, precision)
 
 
-def rfftn(a, s=None, axes=None, norm=None):
+def rfftn(a, s=None, axes=None, norm=None, workers=None, precision=None):
     """
     Compute the N-dimensional discrete Fourier Transform for real input.
 
@@ -1020,6 +1282,17 @@ def rfftn(a, s=None, axes=None, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -1074,15 +1347,13 @@ def rfftn(a, s=None, axes=None, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = array(a, copy=True, dtype=_fft_types(precision)[1])
     s, axes = _cook_nd_args(a, s, axes)
-    a = rfft(a, s[-1], axes[-1], norm)
-    for ii in range(len(axes)-1):
-        a = fft(a, s[ii], axes[ii], norm)
-    return a
+    a = rfft(a, s[-1], axes[-1], norm, workers, precision)
+    return _raw_fftnd(a, s[:-1], axes[:-1], fft, norm, workers, precision)
 
 
-def rfft2(a, s=None, axes=(-2, -1), norm=None):
+def rfft2(a, s=None, axes=(-2, -1), norm=None, workers=None, precision=None):
     """
     Compute the 2-dimensional FFT of a real array.
 
@@ -1097,6 +1368,17 @@ def rfft2(a, s=None, axes=(-2, -1), norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -1115,10 +1397,10 @@ def rfft2(a, s=None, axes=(-2, -1), norm=None):
 
     """
 
-    return rfftn(a, s, axes, norm)
+    return rfftn(a, s, axes, norm, workers, precision)
 
 
-def irfftn(a, s=None, axes=None, norm=None):
+def irfftn(a, s=None, axes=None, norm=None, workers=None, precision=None):
     """
     Compute the inverse of the N-dimensional FFT of real input.
 
@@ -1154,6 +1436,17 @@ def irfftn(a, s=None, axes=None, norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -1203,15 +1496,14 @@ def irfftn(a, s=None, axes=None, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = array(a, copy=True, dtype=_fft_types(precision)[0])
     s, axes = _cook_nd_args(a, s, axes, invreal=1)
-    for ii in range(len(axes)-1):
-        a = ifft(a, s[ii], axes[ii], norm)
-    a = irfft(a, s[-1], axes[-1], norm)
+    a = _raw_fftnd(a, s[:-1], axes[:-1], ifft, norm, workers, precision)
+    a = irfft(a, s[-1], axes[-1], norm, workers, precision)
     return a
 
 
-def irfft2(a, s=None, axes=(-2, -1), norm=None):
+def irfft2(a, s=None, axes=(-2, -1), norm=None, workers=None, precision=None):
     """
     Compute the 2-dimensional inverse FFT of a real array.
 
@@ -1227,6 +1519,17 @@ def irfft2(a, s=None, axes=(-2, -1), norm=None):
     norm : {None, "ortho"}, optional
         .. versionadded:: 1.10.0
         Normalization mode (see `numpy.fft`). Default is None.
+    workers : int, optional
+        .. versionadded:: 1.11.0
+        Maximum number of threads to split the transforms among.  The
+        input is split along its longest axis that is not transformed,
+        and only if it is large enough.  Negative values count back from
+        the number of CPUs, so -1 uses all of them.  Default is 1.
+    precision : {None, "single"}, optional
+        .. versionadded:: 1.11.0
+        With "single" the input is cast to single precision and
+        transformed in single precision, which gives a single precision
+        result.  By default double precision is used.
 
     Returns
     -------
@@ -1244,4 +1547,4 @@ def irfft2(a, s=None, axes=(-2, -1), norm=None):
 
     """
 
-    return irfftn(a, s, axes, norm)
+    return irfftn(a, s, axes, norm, workers, precision)
@@ -4,6 +4,9 @@ Discrete Fourier Transforms - helper.py
 """
 from __future__ import division, absolute_import, print_function
 
+import threading
+from collections import OrderedDict
+
 from numpy.compat import integer_types
 from numpy.core import (
         asarray, concatenate, arange, take, integer, empty
@@ -11,7 +14,8 @@ from numpy.core import (
 
 # Created by Pearu Peterson, September 2002
 
-__all__ = ['fftshift', 'ifftshift', 'fftfreq', 'rfftfreq']
+__all__ = ['fftshift', 'ifftshift', 'fftfreq', 'rfftfreq',
+           'plan_cache_info', 'set_plan_cache_limit', 'clear_plan_cache']
 
 integer_types = integer_types + (integer,)
 
@@ -222,3 +226,165 @@ def rfftfreq(n, d=1.0):
     N = n//2 + 1
     results = arange(0, N, dtype=int)
     return results * val
+
+
+class _FFTCache(object):
+    """
+    Cache of the work arrays, or plans, of the transforms.
+
+    The plans are read-only and shared by all threads.  Once they take
+    more than `limit` bytes, the least recently used ones are dropped, but
+    the most recently used one is kept even if it is larger than that.  A
+    plan missing from the cache is made by one thread while the others
+    asking for it wait, so that it is not made twice.
+    """
+
+    def __init__(self, limit):
+        self._limit = limit
+        self._plans = OrderedDict()
+        self._pending = {}
+        self._lock = threading.Lock()
+        self._size = 0
+        self._hits = 0
+        self._misses = 0
+
+    def get(self, key, make_plan):
+        while True:
+            with self._lock:
+                plan = self._plans.pop(key, None)
+                if plan is not None:
+                    # move it to the most recently used end
+                    self._plans[key] = plan
+                    self._hits += 1
+                    return plan
+                event = self._pending.get(key)
+                if event is None:
+                    event = self._pending[key] = threading.Event()
+                    self._misses += 1
+                    break
+            event.wait()
+
+        try:
+            plan = make_plan()
+            plan.flags.writeable = False
+            with self._lock:
+                self._plans[key] = plan
+                self._size += plan.nbytes
+                self._prune()
+        finally:
+            with self._lock:
+                del self._pending[key]
+            event.set()
+        return plan
+
+    def _prune(self):
+        while len(self._plans) > 1 and self._size > self._limit:
+            key, plan = self._plans.popitem(last=False)
+            self._size -= plan.nbytes
+
+    def info(self):
+        with self._lock:
+            return {'plans': len(self._plans), 'size': self._size,
+                    'limit': self._limit, 'hits': self._hits,
+                    'misses': self._misses}
+
+    def set_limit(self, limit):
+        with self._lock:
+            old, self._limit = self._limit, limit
+            self._prune()
+        return old
+
+    def clear(self):
+        with self._lock:
+            self._plans.clear()
+            self._size = self._hits = self._misses = 0
+
+
+_plan_cache = _FFTCache(100 * 1024 * 1024)
+
+
+def plan_cache_info():
+    """
+    Return statistics of the cache of FFT plans.
+
+    The transforms of a given length and precision share a plan, an array
+    of twiddle factors made the first time that length is transformed.
+    The plans are kept in a cache of limited size, shared by all threads.
+
+    .. versionadded:: 1.11.0
+
+    Returns
+    -------
+    info : dict
+        With the keys
+
+        ``plans``
+            Number of plans in the cache.
+        ``size``
+            Bytes taken by the plans in the cache.
+        ``limit``
+            Bytes the plans may take before the least recently used ones
+            are dropped, see `set_plan_cache_limit`.
+        ``hits``, ``misses``
+            Number of transforms which found their plan in the cache and
+            which had to make it, since the cache was last cleared.
+
+    See Also
+    --------
+    set_plan_cache_limit, clear_plan_cache
+
+    Examples
+    --------
+    >>> np.fft.clear_plan_cache()
+    >>> a = np.fft.fft(np.fft.fft(np.ones(16)))
+    >>> info = np.fft.plan_cache_info()
+    >>> info['plans'], info['hits'], info['misses']
+    (1, 1, 1)
+
+    """
+    return _plan_cache.info()
+
+
+def set_plan_cache_limit(nbytes):
+    """
+    Set the number of bytes the cache of FFT plans may take.
+
+    Least recently used plans are dropped from the cache when it grows
+    larger, but the most recently used plan is always kept, so that
+    transforms of a length with a plan larger than the limit can be
+    repeated without making it again.  The default is 100 MiB.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    nbytes : int
+        The new limit.
+
+    Returns
+    -------
+    old_nbytes : int
+        The previous limit.
+
+    See Also
+    --------
+    plan_cache_info, clear_plan_cache
+
+    """
+    if not isinstance(nbytes, integer_types) or nbytes < 0:
+        raise ValueError("nbytes should be a non-negative integer")
+    return _plan_cache.set_limit(nbytes)
+
+
+def clear_plan_cache():
+    """
+    Drop all plans from the cache of FFT plans and reset its statistics.
+
+    .. versionadded:: 1.11.0
+
+    See Also
+    --------
+    plan_cache_info, set_plan_cache_limit
+
+    """
+    _plan_cache.clear()
@@ -49,6 +49,9 @@ Helper routines
    rfftfreq  DFT sample frequencies (for usage with rfft, irfft).
    fftshift  Shift zero-frequency component to center of spectrum.
    ifftshift Inverse of fftshift.
+   plan_cache_info      Statistics of the cache of FFT plans.
+   set_plan_cache_limit Set the size limit of the cache of FFT plans.
+   clear_plan_cache     Empty the cache of FFT plans.
 
 
 Background information
@@ -9,7 +9,9 @@ def configuration(parent_package='',top_path=None):
 
     # Configure fftpack_lite
     config.add_extension('fftpack_lite',
-                         sources=['fftpack_litemodule.c', 'fftpack.c']
+                         sources=['fftpack_litemodule.c.src', 'fftpack.c.src'],
+                         depends=['fftpack.h'],
+                         include_dirs=['.'],
                          )
 
     return config
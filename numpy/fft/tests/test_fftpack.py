@@ -3,7 +3,7 @@ from __future__ import division, absolute_import, print_function
 import numpy as np
 from numpy.random import random
 from numpy.testing import TestCase, run_module_suite, assert_array_almost_equal
-from numpy.testing import assert_array_equal
+from numpy.testing import assert_array_equal, assert_equal, assert_allclose
 import threading
 import sys
 if sys.version_info[0] >= 3:
@@ -122,6 +122,104 @@ class TestFFT1D(TestCase):
             x_herm, np.fft.ihfft(np.fft.hfft(x_herm, norm="ortho"),
                                  norm="ortho"))
 
+    def test_large_prime(self):
+        # Lengths with large prime factors use Bluestein's algorithm
+        for n in [1009, 2*1009, 257*3]:
+            x = random(n) + 1j*random(n)
+            assert_array_almost_equal(fft1(x), np.fft.fft(x))
+            assert_array_almost_equal(x, np.fft.ifft(np.fft.fft(x)))
+            assert_array_almost_equal(np.fft.fft(x.real)[:n//2 + 1],
+                                      np.fft.rfft(x.real))
+            assert_array_almost_equal(x.real,
+                                      np.fft.irfft(np.fft.rfft(x.real), n))
+            y = np.vstack([x, x])
+            assert_array_almost_equal(
+                np.fft.fft(y, axis=1, precision="single")[1],
+                np.fft.fft(x), decimal=2)
+
+    def test_axes_strided(self):
+        x = random((8, 7, 6)) + 1j*random((8, 7, 6))
+        for a in [x, np.asfortranarray(x), x[::-1, :, ::2]]:
+            for axis in range(3):
+                c = np.ascontiguousarray(np.swapaxes(a, axis, -1))
+                for func in [np.fft.fft, np.fft.ifft, np.fft.irfft]:
+                    assert_array_almost_equal(
+                        func(a, 9, axis), np.swapaxes(func(c, 9), axis, -1))
+                assert_array_almost_equal(
+                    np.fft.rfft(a.real, 5, axis),
+                    np.swapaxes(np.fft.rfft(c.real, 5), axis, -1))
+            assert_array_almost_equal(
+                np.fft.fftn(a, (4, 9), (2, 0)),
+                np.fft.fft(np.fft.fft(a, 9, 0), 4, 2))
+            assert_array_almost_equal(
+                np.fft.rfftn(a.real, axes=(2, 0)),
+                np.fft.fft(np.fft.rfft(a.real, axis=0), axis=2))
+
+    def test_workers(self):
+        # large enough to be split among threads
+        x = random((3, 64, 512))
+        z = x + 1j*random((3, 64, 512))
+        for func, a in [(np.fft.fft, z), (np.fft.ifft, z), (np.fft.rfft, x),
+                        (np.fft.irfft, z), (np.fft.hfft, z),
+                        (np.fft.fft2, z), (np.fft.rfftn, x),
+                        (np.fft.irfft2, z)]:
+            expected = func(a)
+            for workers in [2, 3, -1]:
+                assert_array_equal(func(a, workers=workers), expected)
+            assert_array_equal(func(a.T, workers=2), func(a.T))
+        assert_array_equal(np.fft.fft(z, 600, 1, workers=4),
+                           np.fft.fft(z, 600, 1))
+        self.assertRaises(ValueError, np.fft.fft, z, workers=0)
+
+    def test_batches(self):
+        # batches of transforms run several lanes at once, which must give
+        # the same results as transforming each lane on its own
+        for n in [2, 8, 30, 97, 291]:
+            for precision in [None, "single"]:
+                x = random((11, n))
+                z = x + 1j*random((11, n))
+                for func, a in [(np.fft.fft, z), (np.fft.ifft, z),
+                                (np.fft.rfft, x), (np.fft.irfft, z)]:
+                    res = func(a, precision=precision)
+                    assert_array_equal(
+                        func(a.T, axis=0, precision=precision), res.T)
+                    for i in range(len(a)):
+                        assert_allclose(res[i],
+                                        func(a[i], precision=precision),
+                                        rtol=1e-5)
+
+    def test_single_precision(self):
+        # 97 and 291 go through the generic passes for odd factors
+        for n in [2, 16, 30, 97, 291]:
+            x = random((3, n))
+            z = x + 1j*random((3, n))
+            for func, a in [(np.fft.fft, z), (np.fft.ifft, z),
+                            (np.fft.rfft, x), (np.fft.ihfft, x),
+                            (np.fft.irfft, z)]:
+                expected = func(a)
+                res = func(a, precision="single")
+                assert_equal(res.dtype.itemsize, expected.dtype.itemsize // 2)
+                assert_allclose(res, expected, rtol=0,
+                                atol=1e-6 * abs(expected).max())
+                # single precision input is transformed in double precision
+                # unless asked
+                single = a.astype(np.float32 if a.dtype.kind == 'f'
+                                  else np.complex64)
+                assert_equal(func(single).dtype, expected.dtype)
+        x = random((4, 6))
+        assert_equal(np.fft.fftn(x, precision="single").dtype, np.complex64)
+        assert_equal(np.fft.rfft2(x, precision="single").dtype, np.complex64)
+        assert_equal(np.fft.irfftn(np.fft.rfftn(x), precision="single").dtype,
+                     np.float32)
+        assert_equal(np.fft.fft2(x.astype(np.float32)).dtype, np.complex128)
+        # the scaling of hfft by a large n mustn't promote the result
+        for m in [4097, 65537]:
+            z = np.ones(m, np.complex64)
+            for norm in [None, "ortho"]:
+                res = np.fft.hfft(z, norm=norm, precision="single")
+                assert_equal(res.dtype, np.float32)
+        self.assertRaises(ValueError, np.fft.fft, x, precision="half")
+
 
 class TestFFTThreadSafe(TestCase):
     threads = 16
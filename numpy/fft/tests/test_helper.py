@@ -7,7 +7,10 @@ Copied from fftpack.helper by Pearu Peterson, October 2005
 from __future__ import division, absolute_import, print_function
 
 import numpy as np
-from numpy.testing import TestCase, run_module_suite, assert_array_almost_equal
+from numpy.testing import (
+    TestCase, run_module_suite, assert_array_almost_equal, assert_equal,
+    assert_, assert_raises
+    )
 from numpy import fft
 from numpy import pi
 
@@ -74,5 +77,38 @@ class TestIRFFTN(TestCase):
         fft.irfftn(a, axes=axes)
 
 
+class TestPlanCache(TestCase):
+
+    def tearDown(self):
+        fft.set_plan_cache_limit(100 * 1024 * 1024)
+        fft.clear_plan_cache()
+
+    def test_info(self):
+        fft.clear_plan_cache()
+        x = np.random.random(16)
+        y = fft.irfft(fft.rfft(fft.ifft(fft.fft(x))), 16)
+        assert_array_almost_equal(x, y)
+        info = fft.plan_cache_info()
+        assert_equal((info['plans'], info['hits'], info['misses']), (2, 2, 2))
+        assert_(info['size'] > 0)
+        fft.fft(x, precision="single")
+        assert_equal(fft.plan_cache_info()['plans'], 3)
+        fft.clear_plan_cache()
+        info = fft.plan_cache_info()
+        assert_equal((info['plans'], info['size'], info['hits']), (0, 0, 0))
+
+    def test_limit(self):
+        fft.clear_plan_cache()
+        assert_equal(fft.set_plan_cache_limit(0), 100 * 1024 * 1024)
+        x = np.random.random(30)
+        for n in [8, 9, 10, 9]:
+            assert_array_almost_equal(fft.ifft(fft.fft(x, n)), x[:n])
+        # only the most recently used plan is kept, for the ifft to find
+        info = fft.plan_cache_info()
+        assert_equal((info['plans'], info['limit']), (1, 0))
+        assert_equal((info['hits'], info['misses']), (4, 4))
+        assert_raises(ValueError, fft.set_plan_cache_limit, -1)
+
+
 if __name__ == "__main__":
     run_module_suite()
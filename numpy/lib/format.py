@@ -102,7 +102,9 @@ format. It is an ASCII string which contains a Python literal expression
 of a dictionary. It is terminated by a newline (``\\n``) and padded with
 spaces (``\\x20``) to make the total length of
 ``magic string + 4 + HEADER_LEN`` be evenly divisible by 16 for alignment
-purposes.
+purposes. Files stored uncompressed in an ``.npz`` archive are instead
+padded so that the array data is aligned relative to the start of the
+archive.
 
 The dictionary contains three keys:
 
@@ -141,6 +143,41 @@ The description of the fourth element of the header therefore has become:
 "The next 4 bytes form a little-endian unsigned int: the length of the header
 data HEADER_LEN."
 
+Appending Rows
+--------------
+
+`ArrayAppender` writes a file row by row.  It pads the header with enough
+spaces for the shape of an array of any length, appends the rows after it
+and rewrites the header in place, keeping its length, once the rows are on
+disk.  The result is an ordinary ``.npy`` file.
+
+Chunked Format Version 1.0
+--------------------------
+
+Arrays saved by `numpy.savez_chunked` are stored in ``.npz`` archives as
+uncompressed ``.npyc`` members in the chunked format, in which the rows
+of the array (its elements along the first axis) are split into chunks
+that are compressed independently with zlib, so that they can be
+compressed and decompressed in parallel and ranges of rows read without
+decompressing the whole array.
+
+The first 6 bytes are a magic string: exactly ``\\x93NPCHK``, followed by
+the major and minor version numbers of the chunked format as unsigned
+bytes, ``\\x01`` and ``\\x00``.
+
+Next comes a complete ``.npy`` header, as described above, for an array
+with the shape and dtype of the stored array and ``fortran_order`` False.
+
+Next comes the index of the chunks as little-endian unsigned 8 byte
+integers: the number of chunks N, then N + 1 row numbers, the first rows
+of the chunks followed by the total number of rows, and then N + 1 byte
+offsets of the compressed chunks from the end of the index, the last of
+which is the total size of the compressed data.
+
+Following the index come the chunks, each the zlib compressed C-contiguous
+bytes of its rows. Arrays with no dimensions or with Python objects can't
+be stored in this format.
+
 Notes
 -----
 The ``.npy`` format, including reasons for creating it and a comparison of
@@ -151,6 +188,7 @@ from __future__ import division, absolute_import, print_function
 
 import numpy
 import sys
+import os
 import io
 import warnings
 from numpy.lib.utils import safe_eval
@@ -164,6 +202,8 @@ else:
 MAGIC_PREFIX = asbytes('\x93NUMPY')
 MAGIC_LEN = len(MAGIC_PREFIX) + 2
 BUFFER_SIZE = 2**18  # size of buffer for reading npz files in bytes
+CHUNKED_MAGIC_PREFIX = asbytes('\x93NPCHK')
+CHUNK_SIZE = 2**22  # default size of the chunks of chunked arrays in bytes
 
 # difference between version 1.0 and 2.0 is a 4 byte (I) header length
 # instead of 2 bytes (H) allowing storage of large structured arrays
@@ -279,7 +319,8 @@ def header_data_from_array_1_0(array):
     d['descr'] = dtype_to_descr(array.dtype)
     return d
 
-def _write_array_header(fp, d, version=None):
+def _write_array_header(fp, d, version=None, offset=0, length=None,
+                        align=16):
     """ Write the header for an array and returns the version used
 
     Parameters
@@ -292,6 +333,17 @@ def _write_array_header(fp, d, version=None):
         None means use oldest that works
         explicit version will raise a ValueError if the format does not
         allow saving this data.  Default: None
+    offset : int, optional
+        Position of the header in an enclosing file, such as an uncompressed
+        zip archive. The data following the header is aligned relative to
+        the start of the enclosing file.  Default: 0
+    length : int, optional
+        If given, the header is padded to exactly this many bytes, including
+        the magic string and the header length, so that it can be rewritten
+        in place.  `version` must be given too.  Default: None
+    align : int, optional
+        The alignment of the data following the header, a multiple of 16,
+        when `length` is not given.  Default: 16
     Returns
     -------
     version : tuple of int
@@ -309,7 +361,18 @@ def _write_array_header(fp, d, version=None):
     # 16-byte boundary.  Hopefully, some system, possibly memory-mapping,
     # can take advantage of our premature optimization.
     current_header_len = MAGIC_LEN + 2 + len(header) + 1  # 1 for the newline
-    topad = 16 - (current_header_len % 16)
+    if length is None:
+        if align <= 0 or align % 16 != 0:
+            raise ValueError("align must be a positive multiple of 16, "
+                             "not %r" % (align,))
+        topad = align - ((offset + current_header_len) % align)
+    else:
+        if version != (1, 0):
+            current_header_len += 2
+        topad = length - current_header_len
+        if topad < 0:
+            msg = "Header of %d bytes does not fit in %d bytes"
+            raise ValueError(msg % (current_header_len, length))
     header = header + ' '*topad + '\n'
     header = asbytes(_filter_header(header))
 
@@ -514,7 +577,8 @@ def _read_array_header(fp, version):
 
     return d['shape'], d['fortran_order'], dtype
 
-def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
+def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None,
+                offset=0, align=16):
     """
     Write an array to an NPY file, including a header.
 
@@ -538,6 +602,20 @@ def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
         Additional keyword arguments to pass to pickle.dump, excluding
         'protocol'. These are only useful when pickling objects in object
         arrays on Python 3 to Python 2 compatible format.
+    offset : int, optional
+        Position at which the file will be placed in an enclosing file, such
+        as an uncompressed ``.npz`` archive. The header is padded so that the
+        array data is aligned in the enclosing file, which allows it to be
+        memory-mapped there.  Default: 0
+
+        .. versionadded:: 1.11.0
+    align : int, optional
+        The alignment in bytes of the array data in the file, a multiple
+        of 16.  Aligning the data to the page size, 4096 bytes on most
+        systems, allows it to be read with ``O_DIRECT`` and makes it start
+        on a page boundary when memory-mapped.  Default: 16
+
+        .. versionadded:: 1.11.0
 
     Raises
     ------
@@ -552,7 +630,7 @@ def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
     """
     _check_version(version)
     used_ver = _write_array_header(fp, header_data_from_array_1_0(array),
-                                   version)
+                                   version, offset, align=align)
     # this warning can be removed when 1.9 has aged enough
     if version != (2, 0) and used_ver == (2, 0):
         warnings.warn("Stored array in format 2.0. It can only be"
@@ -596,8 +674,9 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
     Parameters
     ----------
     fp : file_like object
-        If this is not a real file object, then this may take extra memory
-        and time.
+        If this is not a real file object, then it should have a
+        ``readinto()`` method to read the data directly into the array, or
+        reading may take extra memory and time.
     allow_pickle : bool, optional
         Whether to allow reading pickled data. Default: True
     pickle_kwargs : dict
@@ -646,6 +725,14 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
         if isfileobj(fp):
             # We can use the fast fromfile() function.
             array = numpy.fromfile(fp, dtype=dtype, count=count)
+            if array.size != count:
+                msg = "EOF: reading %s, expected %d bytes got %d"
+                raise ValueError(msg % ("array data", count * dtype.itemsize,
+                                        array.nbytes))
+        elif hasattr(fp, 'readinto'):
+            # Read straight into the memory of the array.
+            array = numpy.empty(count, dtype=dtype)
+            _read_into(fp, array.view(numpy.uint8), "array data")
         else:
             # This is not a real file. We have to read it the
             # memory-intensive way.
@@ -674,6 +761,245 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
     return array
 
 
+def _cpu_count():
+    try:
+        import multiprocessing
+        return multiprocessing.cpu_count()
+    except (ImportError, NotImplementedError):
+        return 1
+
+
+def _parallel_map(func, items, workers=None):
+    """
+    Return ``[func(x) for x in items]``, calling `func` on `workers`
+    threads, by default one per CPU.
+
+    This only helps if `func` releases the GIL for most of its work, like
+    the zlib functions do.
+    """
+    import threading
+
+    items = list(items)
+    if workers is None:
+        workers = _cpu_count()
+    workers = min(workers, len(items))
+    if workers <= 1:
+        return [func(x) for x in items]
+
+    results = [None] * len(items)
+    errors = []
+    todo = iter(enumerate(items))
+    lock = threading.Lock()
+
+    def work():
+        while True:
+            with lock:
+                if errors:
+                    return
+                try:
+                    i, x = next(todo)
+                except StopIteration:
+                    return
+            try:
+                results[i] = func(x)
+            except BaseException as e:
+                errors.append(e)
+                return
+
+    threads = [threading.Thread(target=work) for i in range(workers)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
+    return results
+
+
+def _skip_bytes(fp, size):
+    """
+    Skip size bytes of a file-like object, seeking if it can.
+    """
+    try:
+        seekable = fp.seekable()
+    except AttributeError:
+        seekable = False
+    if seekable:
+        fp.seek(size, 1)
+        return
+    while size > 0:
+        r = fp.read(min(size, BUFFER_SIZE))
+        if len(r) == 0:
+            raise ValueError("EOF: skipping chunks, expected %d more bytes"
+                             % size)
+        size -= len(r)
+
+
+def write_array_chunked(fp, array, chunksize=CHUNK_SIZE, level=6,
+                        workers=None):
+    """
+    Write an array in the chunked format, compressing its chunks of rows on
+    several threads.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    fp : file_like object
+        An open, writable file object, or similar object with a ``.write()``
+        method, which must also support ``.seek()`` and ``.tell()``.
+    array : ndarray
+        The array to write to disk.
+    chunksize : int, optional
+        The approximate size of the array data in each chunk, in bytes.
+        Chunks hold at least one row.
+    level : int, optional
+        The zlib compression level, from 0 (none) to 9 (best).
+    workers : int, optional
+        The number of threads compressing chunks. Default is the number of
+        CPUs.
+
+    Raises
+    ------
+    ValueError
+        If the array has no dimensions or contains Python objects.
+
+    """
+    import struct
+    import zlib
+
+    array = numpy.asanyarray(array)
+    if array.ndim == 0 or array.dtype.hasobject:
+        raise ValueError("chunked arrays must have at least one dimension "
+                         "and can't contain Python objects")
+    if chunksize < 1:
+        raise ValueError("chunksize must be positive")
+
+    nrows = array.shape[0]
+    rowsize = array.dtype.itemsize * int(numpy.prod(array.shape[1:]))
+    rows = max(1, chunksize // max(rowsize, 1))
+    bounds = list(range(0, nrows, rows)) + [nrows]
+    nchunks = len(bounds) - 1
+
+    if sys.version_info[0] < 3:
+        fp.write(CHUNKED_MAGIC_PREFIX + chr(1) + chr(0))
+    else:
+        fp.write(CHUNKED_MAGIC_PREFIX + bytes([1, 0]))
+    d = {'descr': dtype_to_descr(array.dtype), 'fortran_order': False,
+         'shape': array.shape}
+    _write_array_header(fp, d)
+    fp.write(struct.pack('<Q', nchunks))
+    fp.write(numpy.array(bounds, dtype='<u8').tobytes())
+    offsets_pos = fp.tell()
+    fp.write(b'\0' * (8 * (nchunks + 1)))
+
+    def compress(i):
+        chunk = numpy.ascontiguousarray(array[bounds[i]:bounds[i + 1]])
+        return zlib.compress(chunk.reshape(-1).view(numpy.uint8), level)
+
+    # Compress a few chunks per thread at a time, to bound the memory used
+    offsets = [0]
+    batch = 4 * (workers or _cpu_count())
+    for start in range(0, nchunks, batch):
+        stop = min(start + batch, nchunks)
+        for data in _parallel_map(compress, range(start, stop), workers):
+            fp.write(data)
+            offsets.append(offsets[-1] + len(data))
+
+    end = fp.tell()
+    fp.seek(offsets_pos)
+    fp.write(numpy.array(offsets, dtype='<u8').tobytes())
+    fp.seek(end)
+
+
+def read_array_chunked(fp, start=None, stop=None, workers=None):
+    """
+    Read the rows ``start:stop`` of an array in the chunked format,
+    decompressing the chunks holding them on several threads.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    fp : file_like object
+        The file, positioned at the start of the chunked array. Chunks
+        before the rows are skipped by seeking if `fp` is seekable.
+    start, stop : int, optional
+        The range of rows to read, as in ``array[start:stop]``. Default is
+        all rows.
+    workers : int, optional
+        The number of threads decompressing chunks. Default is the number
+        of CPUs.
+
+    Returns
+    -------
+    array : ndarray
+        The rows of the array.
+
+    Raises
+    ------
+    ValueError
+        If the data is invalid.
+
+    """
+    import struct
+    import zlib
+
+    magic_str = _read_bytes(fp, MAGIC_LEN, "chunked magic string")
+    if magic_str[:-2] != CHUNKED_MAGIC_PREFIX:
+        msg = "the magic string is not correct; expected %r, got %r"
+        raise ValueError(msg % (CHUNKED_MAGIC_PREFIX, magic_str[:-2]))
+    if sys.version_info[0] < 3:
+        version = tuple(map(ord, magic_str[-2:]))
+    else:
+        version = tuple(magic_str[-2:])
+    if version != (1, 0):
+        raise ValueError("we only support chunked format version (1, 0), "
+                         "not %s" % (version,))
+    version = read_magic(fp)
+    _check_version(version)
+    shape, fortran_order, dtype = _read_array_header(fp, version)
+    if len(shape) == 0 or fortran_order or dtype.hasobject:
+        raise ValueError("invalid chunked array header")
+
+    nchunks = struct.unpack('<Q', _read_bytes(fp, 8, "chunk count"))[0]
+    index = numpy.frombuffer(_read_bytes(fp, 16 * (nchunks + 1),
+                                         "chunk index"), dtype='<u8')
+    bounds = [int(x) for x in index[:nchunks + 1]]
+    offsets = [int(x) for x in index[nchunks + 1:]]
+    if bounds[0] != 0 or bounds[-1] != shape[0]:
+        raise ValueError("invalid chunk index")
+
+    start, stop, step = slice(start, stop).indices(shape[0])
+    stop = max(start, stop)
+    array = numpy.empty((stop - start,) + shape[1:], dtype=dtype)
+    if start == stop or array.nbytes == 0:
+        return array
+    rowsize = array.nbytes // (stop - start)
+    out = array.reshape(-1).view(numpy.uint8)
+
+    # The chunks first:last hold the rows
+    first = numpy.searchsorted(bounds, start, 'right') - 1
+    last = numpy.searchsorted(bounds, stop, 'left')
+    _skip_bytes(fp, offsets[first])
+    data = numpy.frombuffer(_read_bytes(fp, offsets[last] - offsets[first],
+                                        "chunk data"), dtype=numpy.uint8)
+
+    def decompress(i):
+        chunk = data[offsets[i] - offsets[first]:
+                     offsets[i + 1] - offsets[first]]
+        chunk = numpy.frombuffer(zlib.decompress(chunk), dtype=numpy.uint8)
+        if len(chunk) != (bounds[i + 1] - bounds[i]) * rowsize:
+            raise ValueError("chunk %d has the wrong size" % i)
+        lo = max(start, bounds[i])
+        hi = min(stop, bounds[i + 1])
+        out[(lo - start) * rowsize:(hi - start) * rowsize] = \
+            chunk[(lo - bounds[i]) * rowsize:(hi - bounds[i]) * rowsize]
+
+    _parallel_map(decompress, range(first, last), workers)
+    return array
+
+
 def open_memmap(filename, mode='r+', dtype=None, shape=None,
                 fortran_order=False, version=None):
     """
@@ -785,6 +1111,246 @@ def open_memmap(filename, mode='r+', dtype=None, shape=None,
     return marray
 
 
+class ArrayAppender(object):
+    """
+    ArrayAppender(filename, mode='w', dtype=None, shape=None, version=None)
+
+    Write a .npy file row by row.
+
+    The rows are appended to the end of the file as they come, and the
+    header, which is given room for any number of rows when the file is
+    created, is rewritten in place with the new shape when the appender is
+    flushed or closed.  The header is only rewritten once the rows it
+    describes are on disk, so that a file left behind by a crash holds a
+    valid array of the rows appended before the last flush.  Such a file
+    may have trailing bytes after the array, which are discarded when it
+    is opened for appending again.
+
+    The file may be read with `load` or `open_memmap` at any time, and
+    holds the rows appended up to the last flush.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    filename : str
+        The name of the file on disk.  This may *not* be a file-like
+        object.
+    mode : {'w', 'a'}, optional
+        Create a new file ('w', the default) or append to an existing one
+        ('a'), which must have been created by `ArrayAppender` or otherwise
+        have room in its header for the shape to grow.
+    dtype : data-type, optional
+        The data type of the array of a new file.  Default: float64
+    shape : tuple of int, optional
+        The shape of the rows of a new file, so that the array has the shape
+        ``(nrows,) + shape``.  Default: ()
+    version : tuple of int (major, minor) or None
+        The version of the file format used to create a new file.  None
+        means use the oldest supported version that is able to store the
+        data.  Default: None
+
+    Attributes
+    ----------
+    filename : str
+        The name of the file.
+    dtype : dtype
+        The data type of the array.
+    shape : tuple of int
+        The shape of the array written so far.
+
+    Examples
+    --------
+    >>> from numpy.lib.format import ArrayAppender
+    >>> with ArrayAppender('/tmp/rows.npy', dtype=np.int64, shape=(3,)) as f:
+    ...     f.append([0, 1, 2])
+    ...     f.append(np.arange(3, 9).reshape(2, 3))
+    >>> np.load('/tmp/rows.npy')
+    array([[0, 1, 2],
+           [3, 4, 5],
+           [6, 7, 8]])
+
+    """
+
+    def __init__(self, filename, mode='w', dtype=None, shape=None,
+                 version=None):
+        if not isinstance(filename, basestring):
+            raise ValueError("Filename must be a string.  Arrays can only "
+                             "be appended to files on disk.")
+        if mode not in ('w', 'a'):
+            raise ValueError("mode must be 'w' or 'a', not %r" % (mode,))
+        self.filename = filename
+        if mode == 'w':
+            _check_version(version)
+            dtype = numpy.dtype(dtype)
+            if dtype.hasobject:
+                raise ValueError("Rows with Python objects can't be "
+                                 "appended")
+            if shape is None:
+                shape = ()
+            row_shape = tuple(int(n) for n in shape)
+            self._fp = open(filename, 'w+b')
+            try:
+                # Reserve room in the header for the largest array
+                d = self._header_data(dtype, numpy.iinfo(numpy.intp).max,
+                                      row_shape)
+                buf = io.BytesIO()
+                self._version = _write_array_header(buf, d, version)
+                self._offset = buf.tell()
+                nrows = 0
+            except:
+                self._fp.close()
+                raise
+        else:
+            self._fp = open(filename, 'r+b')
+            try:
+                self._version = read_magic(self._fp)
+                _check_version(self._version)
+                shape, fortran_order, dtype = _read_array_header(
+                    self._fp, self._version)
+                self._offset = self._fp.tell()
+                if dtype.hasobject:
+                    raise ValueError("Rows with Python objects can't be "
+                                     "appended")
+                if len(shape) == 0 or (fortran_order and len(shape) > 1):
+                    raise ValueError("Rows can only be appended to "
+                                     "C-contiguous arrays with dimensions")
+                nrows, row_shape = int(shape[0]), tuple(shape[1:])
+                # Check the header can describe the largest array
+                d = self._header_data(dtype, numpy.iinfo(numpy.intp).max,
+                                      row_shape)
+                try:
+                    _write_array_header(io.BytesIO(), d, self._version,
+                                        length=self._offset)
+                except ValueError:
+                    raise ValueError("The header of %s has no room for the "
+                                     "shape to grow" % (filename,))
+                size = (self._offset +
+                        nrows * _rows_nbytes(dtype, row_shape))
+                self._fp.seek(0, 2)
+                if self._fp.tell() < size:
+                    raise ValueError("%s is truncated" % (filename,))
+                # Discard any rows appended after the last flush
+                self._fp.truncate(size)
+            except:
+                self._fp.close()
+                raise
+        self.dtype = dtype
+        self._row_shape = row_shape
+        self._nrows = nrows
+        self._flushed_nrows = None
+        self.flush()
+
+    @staticmethod
+    def _header_data(dtype, nrows, row_shape):
+        return dict(descr=dtype_to_descr(dtype), fortran_order=False,
+                    shape=(nrows,) + row_shape)
+
+    @property
+    def shape(self):
+        return (self._nrows,) + self._row_shape
+
+    @property
+    def closed(self):
+        return self._fp is None
+
+    def append(self, rows):
+        """
+        Append one row, or an array of rows, to the file.
+
+        Parameters
+        ----------
+        rows : array_like
+            A row of the shape given when the file was created, or an
+            array of such rows.
+
+        """
+        if self._fp is None:
+            raise ValueError("I/O operation on closed file")
+        rows = numpy.ascontiguousarray(rows, dtype=self.dtype)
+        if rows.shape == self._row_shape:
+            nrows = 1
+        elif rows.shape[1:] == self._row_shape and rows.ndim > 0:
+            nrows = rows.shape[0]
+        else:
+            raise ValueError("Rows of shape %s can't be appended to an "
+                             "array of shape %s" % (rows.shape, self.shape))
+        rows.tofile(self._fp)
+        self._nrows += nrows
+
+    def flush(self):
+        """
+        Write the rows appended so far to disk and update the header.
+
+        """
+        if self._fp is None:
+            raise ValueError("I/O operation on closed file")
+        if self._nrows == self._flushed_nrows:
+            return
+        self._fp.flush()
+        os.fsync(self._fp.fileno())
+        d = self._header_data(self.dtype, self._nrows, self._row_shape)
+        self._fp.seek(0)
+        _write_array_header(self._fp, d, self._version, length=self._offset)
+        self._fp.flush()
+        os.fsync(self._fp.fileno())
+        self._fp.seek(0, 2)
+        self._flushed_nrows = self._nrows
+
+    def close(self):
+        """
+        Flush the file and close it.
+
+        """
+        if self._fp is not None:
+            try:
+                self.flush()
+            finally:
+                self._fp.close()
+                self._fp = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+
+def _rows_nbytes(dtype, row_shape):
+    """The number of bytes in a row of the given shape."""
+    size = dtype.itemsize
+    for n in row_shape:
+        size *= n
+    return size
+
+
+def _read_into(fp, buf, error_template="ran out of data"):
+    """
+    Fill the uint8 array `buf` from file-like object `fp` with readinto.
+    Raises ValueError if EOF is encountered before `buf` is full.
+
+    The data is read in blocks of BUFFER_SIZE bytes, as file-like objects
+    such as ZipExtFile read into a temporary bytes object, and gzip streams
+    fail on reads larger than 4 GiB.
+    """
+    size = buf.size
+    blocksize = BUFFER_SIZE
+    pos = 0
+    while pos < size:
+        try:
+            r = fp.readinto(buf[pos:pos + blocksize].data)
+        except io.BlockingIOError:
+            continue
+        if r is None:
+            continue
+        if r == 0:
+            break
+        pos += r
+    if pos != size:
+        msg = "EOF: reading %s, expected %d bytes got %d"
+        raise ValueError(msg % (error_template, size, pos))
+
+
 def _read_bytes(fp, size, error_template="ran out of data"):
     """
     Read from file-like object until size bytes are read.
@@ -11,11 +11,14 @@ from operator import itemgetter
 import numpy as np
 from . import format
 from ._datasource import DataSource
-from numpy.core.multiarray import packbits, unpackbits
+from numpy.core.multiarray import (
+    packbits, unpackbits, _loadtxt, _format_rows, _genfromtxt_split,
+    _genfromtxt_infer, _genfromtxt_convert
+    )
 from ._iotools import (
     LineSplitter, NameValidator, StringConverter, ConverterError,
     ConverterLockError, ConversionWarning, _is_string_like, has_nested_fields,
-    flatten_dtype, easy_dtype, _bytes_to_name
+    flatten_dtype, easy_dtype, _bytes_to_name, str2bool
     )
 
 from numpy.compat import (
@@ -31,9 +34,10 @@ else:
 loads = pickle.loads
 
 __all__ = [
-    'savetxt', 'loadtxt', 'genfromtxt', 'ndfromtxt', 'mafromtxt',
+    'savetxt', 'loadtxt', 'iterloadtxt', 'genfromtxt', 'ndfromtxt', 'mafromtxt',
     'recfromtxt', 'recfromcsv', 'load', 'loads', 'save', 'savez',
-    'savez_compressed', 'packbits', 'unpackbits', 'fromregex', 'DataSource'
+    'savez_compressed', 'savez_chunked', 'tofile_async', 'fromfile_async',
+    'packbits', 'unpackbits', 'fromregex', 'DataSource'
     ]
 
 
@@ -112,7 +116,8 @@ class NpzFile(object):
     Attributes
     ----------
     files : list of str
-        List of all files in the archive with a ``.npy`` extension.
+        List of all files in the archive, without the ``.npy`` and ``.npyc``
+        extensions.
     zip : ZipFile instance
         The ZipFile object initialized with the zipped archive.
     f : BagObj instance
@@ -124,6 +129,12 @@ class NpzFile(object):
         Additional keyword arguments to pass on to pickle.load.
         These are only useful when loading object arrays saved on
         Python 2 when using Python 3.
+    mmap_mode : {None, 'r', 'c'}, optional
+        If not None, arrays stored uncompressed in an archive on disk are
+        memory-mapped with the given mode (see `numpy.memmap`) instead of
+        being read into memory. Other arrays are always read.
+
+        .. versionadded:: 1.11.0
 
     Parameters
     ----------
@@ -156,7 +167,7 @@ class NpzFile(object):
     """
 
     def __init__(self, fid, own_fid=False, allow_pickle=True,
-                 pickle_kwargs=None):
+                 pickle_kwargs=None, mmap_mode=None):
         # Import is postponed to here since zipfile depends on gzip, an
         # optional component of the so-called standard library.
         _zip = zipfile_factory(fid)
@@ -164,9 +175,12 @@ class NpzFile(object):
         self.files = []
         self.allow_pickle = allow_pickle
         self.pickle_kwargs = pickle_kwargs
+        self.mmap_mode = mmap_mode
         for x in self._files:
             if x.endswith('.npy'):
                 self.files.append(x[:-4])
+            elif x.endswith('.npyc'):
+                self.files.append(x[:-5])
             else:
                 self.files.append(x)
         self.zip = _zip
@@ -207,25 +221,112 @@ class NpzFile(object):
         #   It would be better if the zipfile could read
         #   (or at least uncompress) the data
         #   directly into the array memory.
-        member = 0
-        if key in self._files:
-            member = 1
-        elif key in self.files:
-            member = 1
-            key += '.npy'
-        if member:
+        key = self._member(key)
+        bytes = self.zip.open(key)
+        magic = bytes.read(len(format.MAGIC_PREFIX))
+        bytes.close()
+        if magic == format.MAGIC_PREFIX:
+            if self.mmap_mode in ('r', 'c'):
+                array = self._memmap(key)
+                if array is not None:
+                    return array
             bytes = self.zip.open(key)
+            return format.read_array(bytes,
+                                     allow_pickle=self.allow_pickle,
+                                     pickle_kwargs=self.pickle_kwargs)
+        elif magic == format.CHUNKED_MAGIC_PREFIX:
+            bytes = self.zip.open(key)
+            try:
+                return format.read_array_chunked(bytes)
+            finally:
+                bytes.close()
+        else:
+            return self.zip.read(key)
+
+    def _member(self, key):
+        """The name in the archive of the file `key`."""
+        if key in self._files:
+            return key
+        for ext in ('.npy', '.npyc'):
+            if key + ext in self._files:
+                return key + ext
+        raise KeyError("%s is not a file in the archive" % key)
+
+    def _memmap(self, member):
+        """
+        Memory-map the array in `member`, or return None if it is not
+        stored uncompressed in an archive on disk.
+
+        """
+        import zipfile
+        import struct
+
+        info = self.zip.getinfo(member)
+        filename = self.zip.filename
+        if (info.compress_type != zipfile.ZIP_STORED or
+                not isinstance(filename, basestring) or
+                not os.path.isfile(filename)):
+            return None
+        # The data follows the local header of the member, whose name and
+        # extra fields need not match the central directory.
+        fp = self.zip.fp
+        fp.seek(info.header_offset)
+        header = fp.read(zipfile.sizeFileHeader)
+        if len(header) != zipfile.sizeFileHeader:
+            return None
+        header = struct.unpack(zipfile.structFileHeader, header)
+        if header[zipfile._FH_SIGNATURE] != zipfile.stringFileHeader:
+            return None
+        fp.seek(header[zipfile._FH_FILENAME_LENGTH] +
+                header[zipfile._FH_EXTRA_FIELD_LENGTH], 1)
+        version = format.read_magic(fp)
+        format._check_version(version)
+        shape, fortran_order, dtype = format._read_array_header(fp, version)
+        if dtype.hasobject or np.prod(shape, dtype=np.intp) == 0:
+            return None
+        if fortran_order:
+            order = 'F'
+        else:
+            order = 'C'
+        return np.memmap(filename, dtype=dtype, mode=self.mmap_mode,
+                         offset=fp.tell(), shape=shape, order=order)
+
+    def read_rows(self, key, start=None, stop=None):
+        """
+        Read the rows ``start:stop`` of an array in the archive.
+
+        For arrays saved by `savez_chunked` only the chunks holding the
+        rows are decompressed. Other arrays are read whole and sliced.
+
+        .. versionadded:: 1.11.0
+
+        Parameters
+        ----------
+        key : str
+            The name of the array.
+        start, stop : int, optional
+            The range of rows, as in ``array[start:stop]``. Default is all
+            rows.
+
+        Returns
+        -------
+        rows : ndarray
+            The rows of the array.
+
+        """
+        member = self._member(key)
+        bytes = self.zip.open(member)
+        try:
             magic = bytes.read(len(format.MAGIC_PREFIX))
+        finally:
+            bytes.close()
+        if magic != format.CHUNKED_MAGIC_PREFIX:
+            return self[key][start:stop]
+        bytes = self.zip.open(member)
+        try:
+            return format.read_array_chunked(bytes, start, stop)
+        finally:
             bytes.close()
-            if magic == format.MAGIC_PREFIX:
-                bytes = self.zip.open(key)
-                return format.read_array(bytes,
-                                         allow_pickle=self.allow_pickle,
-                                         pickle_kwargs=self.pickle_kwargs)
-            else:
-                return self.zip.read(key)
-        else:
-            raise KeyError("%s is not a file in the archive" % key)
 
     def __iter__(self):
         return iter(self.files)
@@ -271,7 +372,9 @@ def load(file, mmap_mode=None, allow_pickle=True, fix_imports=True,
         memory-mapped array is kept on disk. However, it can be accessed
         and sliced like any ndarray.  Memory mapping is especially useful
         for accessing small fragments of large files without reading the
-        entire file into memory.
+        entire file into memory. Arrays in ``.npz`` files are memory-mapped
+        when they are stored uncompressed, as by `savez`, and the mode is
+        'r' or 'c'; other arrays are read into memory.
     allow_pickle : bool, optional
         Allow loading pickled object arrays stored in npy files. Reasons for
         disallowing pickles include security, as loading pickled data can
@@ -354,6 +457,13 @@ def load(file, mmap_mode=None, allow_pickle=True, fix_imports=True,
     >>> X[1, :]
     memmap([4, 5, 6])
 
+    The arrays of an uncompressed ``.npz`` file can be memory-mapped too:
+
+    >>> data = np.load('/tmp/123.npz', mmap_mode='r')
+    >>> data['a'][1, :]
+    memmap([4, 5, 6])
+    >>> data.close()
+
     """
     import gzip
 
@@ -396,7 +506,7 @@ def load(file, mmap_mode=None, allow_pickle=True, fix_imports=True,
             tmp = own_fid
             own_fid = False
             return NpzFile(fid, own_fid=tmp, allow_pickle=allow_pickle,
-                           pickle_kwargs=pickle_kwargs)
+                           pickle_kwargs=pickle_kwargs, mmap_mode=mmap_mode)
         elif magic == format.MAGIC_PREFIX:
             # .npy file
             if mmap_mode:
@@ -594,12 +704,150 @@ def savez_compressed(file, *args, **kwds):
     See Also
     --------
     numpy.savez : Save several arrays into an uncompressed ``.npz`` file format
+    numpy.savez_chunked : Save arrays split into chunks compressed in parallel.
     numpy.load : Load the files created by savez_compressed.
 
     """
     _savez(file, args, kwds, True)
 
 
+def savez_chunked(file, *args, **kwds):
+    """
+    savez_chunked(file, *args, chunksize=2**22, level=6, workers=None, **kwds)
+
+    Save several arrays into a single file in a chunked, compressed ``.npz``
+    format.
+
+    The arrays are named like `savez` names them: after the keywords, or
+    arr_0, arr_1, etc. for the arguments given without keywords.  Each
+    array is split along its first axis into chunks of about
+    `chunksize` bytes, which are compressed independently on several
+    threads. `load` decompresses the chunks of an array on several threads
+    as well, and `NpzFile.read_rows` reads a range of rows by only
+    decompressing the chunks holding them.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    file : str or file
+        Either the file name (string) or an open file (file-like object)
+        where the data will be saved. If file is a string, the ``.npz``
+        extension will be appended to the file name if it is not already
+        there.
+    args : Arguments, optional
+        Arrays to save to the file, named ``arr_0``, ``arr_1``, etc.
+    chunksize : int, optional
+        The approximate size of the array data in each chunk, in bytes.
+        Chunks hold at least one row.
+    level : int, optional
+        The zlib compression level, from 0 (none) to 9 (best).
+    workers : int, optional
+        The number of threads compressing chunks. Default is the number of
+        CPUs.
+    kwds : Keyword arguments, optional
+        Arrays to save to the file, named after the keywords.  Arrays can't
+        be named ``chunksize``, ``level`` or ``workers``.
+
+    See Also
+    --------
+    savez_compressed : Save several arrays into a compressed ``.npz`` file.
+    numpy.lib.format.write_array_chunked : Layout of the chunked arrays.
+
+    Notes
+    -----
+    The chunked arrays are stored as ``.npyc`` files in the archive, which
+    can only be read by NumPy 1.11.0 or later. Arrays with no dimensions or
+    with Python objects can't be chunked, and are stored like
+    `savez_compressed` does. Chunked arrays are always loaded in C order.
+
+    Examples
+    --------
+    >>> from tempfile import TemporaryFile
+    >>> outfile = TemporaryFile()
+    >>> x = np.arange(100000).reshape(-1, 10)
+    >>> np.savez_chunked(outfile, x=x, chunksize=2**16)
+    >>> outfile.seek(0)
+    >>> npz = np.load(outfile)
+    >>> npz.read_rows('x', 5000, 5002)
+    array([[50000, 50001, 50002, 50003, 50004, 50005, 50006, 50007, 50008,
+            50009],
+           [50010, 50011, 50012, 50013, 50014, 50015, 50016, 50017, 50018,
+            50019]])
+
+    """
+    import zipfile
+    import tempfile
+
+    chunksize = kwds.pop('chunksize', format.CHUNK_SIZE)
+    level = kwds.pop('level', 6)
+    workers = kwds.pop('workers', None)
+
+    if isinstance(file, basestring):
+        if not file.endswith('.npz'):
+            file = file + '.npz'
+
+    namedict = kwds
+    for i, val in enumerate(args):
+        key = 'arr_%d' % i
+        if key in namedict.keys():
+            raise ValueError(
+                "Cannot use un-named variables and keyword %s" % key)
+        namedict[key] = val
+
+    zipf = zipfile_factory(file, mode="w", compression=zipfile.ZIP_DEFLATED)
+
+    # Stage arrays in a temporary file on disk, before writing to zip.
+    fd, tmpfile = tempfile.mkstemp(suffix='-numpy.npyc')
+    os.close(fd)
+    try:
+        for key, val in namedict.items():
+            val = np.asanyarray(val)
+            fid = open(tmpfile, 'wb')
+            try:
+                if val.ndim == 0 or val.dtype.hasobject:
+                    format.write_array(fid, val)
+                    fname, compression = key + '.npy', zipfile.ZIP_DEFLATED
+                else:
+                    format.write_array_chunked(fid, val, chunksize, level,
+                                               workers)
+                    fname, compression = key + '.npyc', zipfile.ZIP_STORED
+                fid.close()
+                fid = None
+                zipf.write(tmpfile, arcname=fname, compress_type=compression)
+            finally:
+                if fid:
+                    fid.close()
+    finally:
+        os.remove(tmpfile)
+
+    zipf.close()
+
+
+def _zip_data_offset(zipf, arcname, size):
+    """
+    The position in the archive at which the data of a member `arcname` of
+    about `size` bytes, written next to `zipf`, will start.
+
+    """
+    import zipfile
+
+    try:
+        pos = zipf.fp.tell()
+    except (AttributeError, IOError, OSError):
+        return 0
+    if sys.version_info[0] >= 3:
+        try:
+            arcname = arcname.encode('ascii')
+        except UnicodeEncodeError:
+            arcname = arcname.encode('utf-8')
+    extra = 0
+    if size * 1.05 > zipfile.ZIP64_LIMIT:
+        # zipfile adds a zip64 extra field to the local header
+        extra = 20
+    return pos + zipfile.sizeFileHeader + len(arcname) + extra
+
+
 def _savez(file, args, kwds, compress, allow_pickle=True, pickle_kwargs=None):
     # Import is postponed to here since zipfile depends on gzip, an optional
     # component of the so-called standard library.
@@ -632,11 +880,18 @@ def _savez(file, args, kwds, compress, allow_pickle=True, pickle_kwargs=None):
     try:
         for key, val in namedict.items():
             fname = key + '.npy'
+            val = np.asanyarray(val)
+            # Align the data of uncompressed arrays so they can be mapped.
+            if compress:
+                offset = 0
+            else:
+                offset = _zip_data_offset(zipf, fname, val.nbytes)
             fid = open(tmpfile, 'wb')
             try:
-                format.write_array(fid, np.asanyarray(val),
+                format.write_array(fid, val,
                                    allow_pickle=allow_pickle,
-                                   pickle_kwargs=pickle_kwargs)
+                                   pickle_kwargs=pickle_kwargs,
+                                   offset=offset)
                 fid.close()
                 fid = None
                 zipf.write(tmpfile, arcname=fname)
@@ -649,6 +904,327 @@ def _savez(file, args, kwds, compress, allow_pickle=True, pickle_kwargs=None):
     zipf.close()
 
 
+# Alignment of the buffers, file offsets and sizes of O_DIRECT transfers,
+# which is enough for the logical block size of common devices.
+_DIRECT_ALIGNMENT = 4096
+
+# Default size of the blocks of tofile_async and fromfile_async
+_ASYNC_BLOCK_SIZE = 2**22
+
+
+def _aligned_empty(nbytes, alignment=_DIRECT_ALIGNMENT):
+    """An uninitialized uint8 array of `nbytes` with aligned data."""
+    buf = np.empty(nbytes + alignment, dtype=np.uint8)
+    start = -buf.ctypes.data % alignment
+    return buf[start:start + nbytes]
+
+
+def _async_open(file, flags, direct):
+    """
+    Open the file named `file`, with O_DIRECT if `direct` and the platform
+    and file system support it. Returns the descriptor and whether O_DIRECT
+    is used.
+    """
+    if direct and hasattr(os, 'O_DIRECT'):
+        try:
+            return os.open(file, flags | os.O_DIRECT, 0o666), True
+        except OSError:
+            # e.g. tmpfs doesn't support O_DIRECT
+            pass
+    return os.open(file, flags, 0o666), False
+
+
+def _async_start(file, flags, direct):
+    """
+    The descriptor, whether it uses O_DIRECT, whether it should be closed
+    and the offset in the file to start at, for a file name or file object.
+    File objects are read and written from their current position.
+    """
+    if isinstance(file, basestring):
+        fd, direct = _async_open(file, flags, direct)
+        return fd, direct, True, 0
+    file.flush()
+    return file.fileno(), False, False, file.tell()
+
+
+def _async_appends(file):
+    """
+    Whether writes to `file` go to the end of the file whatever their
+    offset, as for files opened in append mode.
+    """
+    if isinstance(file, basestring):
+        return False
+    try:
+        import fcntl
+    except ImportError:
+        return 'a' in getattr(file, 'mode', '')
+    return bool(fcntl.fcntl(file.fileno(), fcntl.F_GETFL) & os.O_APPEND)
+
+
+def _pwrite_all(fd, buf, offset):
+    """Write all of the uint8 array `buf` at `offset`."""
+    buf = memoryview(buf)
+    while len(buf) > 0:
+        n = os.pwrite(fd, buf, offset)
+        buf = buf[n:]
+        offset += n
+
+
+def _pread_into(fd, buf, offset, direct):
+    """
+    Fill the uint8 array `buf` from `offset`, returning the number of bytes
+    read, which is less than its size at the end of the file.
+    """
+    pos = 0
+    while pos < len(buf):
+        if hasattr(os, 'preadv'):
+            n = os.preadv(fd, [memoryview(buf[pos:])], offset + pos)
+        else:
+            data = os.pread(fd, len(buf) - pos, offset + pos)
+            n = len(data)
+            buf[pos:pos + n] = np.frombuffer(data, dtype=np.uint8)
+        pos += n
+        # O_DIRECT reads are only short at the end of the file, and may not
+        # continue at an unaligned offset
+        if n == 0 or direct:
+            break
+    return pos
+
+
+def _async_stats(nbytes, seconds, direct):
+    return {'nbytes': nbytes, 'seconds': seconds,
+            'throughput': nbytes / seconds if seconds > 0 else float('inf'),
+            'direct': direct}
+
+
+def tofile_async(arr, file, blocksize=_ASYNC_BLOCK_SIZE, workers=4,
+                 direct=False, return_stats=False):
+    """
+    Write an array to a file as binary data, like ``arr.tofile(file)``,
+    with several writes in flight at once.
+
+    The data is written in blocks of `blocksize` bytes by `workers`
+    threads, which lets fast devices such as NVMe drives, whose bandwidth
+    a single stream of writes doesn't use, write at close to their full
+    speed. With `direct` the file is opened with ``O_DIRECT``, bypassing
+    the page cache.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    arr : array_like
+        The array to write, in C order.
+    file : str or file
+        A file name, or an open file object, written at its current
+        position, which is moved after the data. Files opened in append
+        mode are written at their end with `ndarray.tofile`.
+    blocksize : int, optional
+        The size of each write in bytes, rounded up to a multiple of 4096.
+    workers : int, optional
+        The number of writes in flight at once.
+    direct : bool, optional
+        Open the file with ``O_DIRECT`` if it is a file name and the
+        platform and file system support it. Blocks which are not aligned
+        in memory are copied into aligned buffers, and the last block is
+        padded, then the file truncated.
+    return_stats : bool, optional
+        Return the size and time of the transfer.
+
+    Returns
+    -------
+    stats : dict
+        Only if `return_stats`: the number of bytes written ``'nbytes'``,
+        the time taken ``'seconds'``, the ``'throughput'`` in bytes per
+        second, and whether ``O_DIRECT`` was used, ``'direct'``.
+
+    See Also
+    --------
+    ndarray.tofile, fromfile_async
+
+    Notes
+    -----
+    Where ``os.pwrite`` is not available (Python 2 and Windows) this writes
+    with `ndarray.tofile`. Like other writes, ``O_DIRECT`` writes are only
+    durable after an ``os.fsync``.
+
+    Examples
+    --------
+    >>> from tempfile import mkstemp
+    >>> fname = mkstemp()[1]
+    >>> x = np.arange(2**20, dtype=np.float64)
+    >>> stats = np.tofile_async(x, fname, blocksize=2**20, return_stats=True)
+    >>> stats['nbytes']
+    8388608
+    >>> np.array_equal(np.fromfile_async(fname, dtype=np.float64), x)
+    True
+
+    """
+    import time
+
+    arr = np.asanyarray(arr)
+    if arr.dtype.hasobject:
+        raise ValueError("cannot write arrays with Python objects "
+                         "to a binary file")
+    data = np.ascontiguousarray(arr).reshape(-1).view(np.uint8)
+    nbytes = data.size
+    blocksize = -(-max(blocksize, 1) // _DIRECT_ALIGNMENT) * _DIRECT_ALIGNMENT
+    t0 = time.time()
+
+    # writes at an offset would go to the end of files opened for appending
+    if not hasattr(os, 'pwrite') or _async_appends(file):
+        arr.tofile(file)
+        if return_stats:
+            return _async_stats(nbytes, time.time() - t0, False)
+        return
+
+    import threading
+
+    fd, direct, close, start = _async_start(
+        file, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, direct)
+    try:
+        aligned = data.ctypes.data % _DIRECT_ALIGNMENT == 0
+        local = threading.local()
+
+        def write(i):
+            block = data[i * blocksize:(i + 1) * blocksize]
+            if direct and (not aligned or len(block) % _DIRECT_ALIGNMENT):
+                buf = getattr(local, 'buf', None)
+                if buf is None:
+                    buf = local.buf = _aligned_empty(blocksize)
+                size = (-(-len(block) // _DIRECT_ALIGNMENT) *
+                        _DIRECT_ALIGNMENT)
+                buf[:len(block)] = block
+                buf[len(block):size] = 0
+                block = buf[:size]
+            _pwrite_all(fd, block, start + i * blocksize)
+
+        format._parallel_map(write, range(-(-nbytes // blocksize)), workers)
+        if direct and nbytes % _DIRECT_ALIGNMENT:
+            os.ftruncate(fd, start + nbytes)
+    finally:
+        if close:
+            os.close(fd)
+    if not close:
+        file.seek(start + nbytes)
+
+    if return_stats:
+        return _async_stats(nbytes, time.time() - t0, direct)
+
+
+def fromfile_async(file, dtype=float, count=-1, blocksize=_ASYNC_BLOCK_SIZE,
+                   workers=4, direct=False, return_stats=False):
+    """
+    Read an array from a binary file, like ``np.fromfile(file, dtype,
+    count)``, with several reads in flight at once.
+
+    The data is read in blocks of `blocksize` bytes by `workers` threads,
+    straight into the array. With `direct` the file is opened with
+    ``O_DIRECT``, bypassing the page cache.
+
+    .. versionadded:: 1.11.0
+
+    Parameters
+    ----------
+    file : str or file
+        A file name, or an open file object, read from its current
+        position, which is moved after the data.
+    dtype : data-type, optional
+        The data type of the array.
+    count : int, optional
+        The number of items to read. ``-1`` means all items to the end of
+        the file.
+    blocksize : int, optional
+        The size of each read in bytes, rounded up to a multiple of 4096.
+    workers : int, optional
+        The number of reads in flight at once.
+    direct : bool, optional
+        Open the file with ``O_DIRECT`` if it is a file name and the
+        platform and file system support it, and ``os.preadv`` is
+        available. The array data is then aligned to 4096 bytes.
+    return_stats : bool, optional
+        Return the size and time of the transfer as well.
+
+    Returns
+    -------
+    out : ndarray
+        The data read.
+    stats : dict
+        Only if `return_stats`: the number of bytes read ``'nbytes'``, the
+        time taken ``'seconds'``, the ``'throughput'`` in bytes per second,
+        and whether ``O_DIRECT`` was used, ``'direct'``.
+
+    Raises
+    ------
+    ValueError
+        If the file is shorter than `count` items, or changes while it is
+        read.
+
+    See Also
+    --------
+    fromfile, tofile_async
+
+    Notes
+    -----
+    Where ``os.pread`` is not available (Python 2 and Windows) this reads
+    with `fromfile`.
+
+    """
+    import time
+
+    dtype = np.dtype(dtype)
+    if dtype.hasobject:
+        raise ValueError("cannot read arrays with Python objects "
+                         "from a binary file")
+    if dtype.itemsize == 0:
+        raise ValueError("the elements are 0-sized")
+    blocksize = -(-max(blocksize, 1) // _DIRECT_ALIGNMENT) * _DIRECT_ALIGNMENT
+    t0 = time.time()
+
+    if not hasattr(os, 'pread'):
+        out = np.fromfile(file, dtype=dtype, count=count)
+        if return_stats:
+            return out, _async_stats(out.nbytes, time.time() - t0, False)
+        return out
+
+    # os.pread reads into a buffer of its own, which isn't aligned
+    direct = direct and hasattr(os, 'preadv')
+    fd, direct, close, start = _async_start(file, os.O_RDONLY, direct)
+    try:
+        available = max(os.fstat(fd).st_size - start, 0) // dtype.itemsize
+        if count < 0:
+            count = available
+        elif count > available:
+            raise ValueError("EOF: reading array data, expected %d items "
+                             "got %d" % (count, available))
+        nbytes = count * dtype.itemsize
+        if direct:
+            buf = _aligned_empty(-(-nbytes // _DIRECT_ALIGNMENT) *
+                                 _DIRECT_ALIGNMENT)
+        else:
+            buf = np.empty(nbytes, dtype=np.uint8)
+
+        def read(i):
+            block = buf[i * blocksize:(i + 1) * blocksize]
+            expected = min(blocksize, nbytes - i * blocksize)
+            n = _pread_into(fd, block, start + i * blocksize, direct)
+            if n < expected:
+                raise ValueError("EOF: reading array data, expected %d "
+                                 "bytes got %d" % (expected, n))
+
+        format._parallel_map(read, range(-(-nbytes // blocksize)), workers)
+    finally:
+        if close:
+            os.close(fd)
+    if not close:
+        file.seek(start + nbytes)
+
+    out = buf[:nbytes].view(dtype)
+    if return_stats:
+        return out, _async_stats(nbytes, time.time() - t0, direct)
+    return out
+
+
 def _getconv(dtype):
     """ Find the correct dtype converter. Adapted from matplotlib """
 
@@ -679,9 +1255,103 @@ def _getconv(dtype):
         return str
 
 
+# Size of the blocks in which loadtxt reads files
+_LOADTXT_BLOCKSIZE = 2**20
+
+
+def _loadtxt_fields(dtype):
+    """
+    Describe the columns of `dtype` for the native loadtxt reader.
+
+    Returns a list of ``(offset, dtype, kind, converter)`` tuples, one per
+    column in the order used by `loadtxt`, or None if some column can't be
+    parsed natively.  `kind` tells the reader which of the converters
+    returned by `_getconv` it has to reproduce; `converter` is used for
+    the values it doesn't parse itself.
+
+    """
+    fields = []
+
+    def add_leaves(dt, offset):
+        if dt.names is not None:
+            for name in dt.names:
+                tp, off = dt.fields[name][:2]
+                if not add_leaves(tp, offset + off):
+                    return False
+            return True
+        if dt.shape:
+            # The Python code broadcasts the values of short rows to
+            # subarrays, which the compiled reader doesn't do
+            return False
+        typ = dt.type
+        if not dt.isnative:
+            return False
+        if issubclass(typ, np.bool_):
+            kind = b'b'
+        elif issubclass(typ, np.uint64) or issubclass(typ, np.int64):
+            kind = b'i'
+        elif issubclass(typ, np.integer):
+            kind = b'I'
+        elif issubclass(typ, np.longdouble):
+            return False
+        elif issubclass(typ, np.floating):
+            kind = b'f'
+        else:
+            return False
+        fields.append((offset, dt, kind, _getconv(dt)))
+        return True
+
+    if not add_leaves(dtype, 0):
+        return None
+    # A single field is read like a plain dtype by the Python code
+    if dtype.names is not None and len(fields) < 2:
+        return None
+    return fields
+
+
+def _loadtxt_open(fname):
+    """
+    Open the input of loadtxt, returning an iterator over its lines and
+    whether it has to be closed by the caller.
+
+    """
+    try:
+        if _is_string_like(fname):
+            if fname.endswith('.gz'):
+                import gzip
+                return iter(gzip.GzipFile(fname)), True
+            elif fname.endswith('.bz2'):
+                import bz2
+                return iter(bz2.BZ2File(fname)), True
+            elif sys.version_info[0] == 2:
+                return iter(open(fname, 'U')), True
+            else:
+                return iter(open(fname)), True
+        else:
+            return iter(fname), False
+    except TypeError:
+        raise ValueError('fname must be a string, file handle, or generator')
+
+
+def _loadtxt_blocks(fh, blocks=True):
+    """Yield the contents of `fh` as bytes, in large blocks if possible."""
+    if blocks and hasattr(fh, 'read'):
+        while True:
+            chunk = fh.read(_LOADTXT_BLOCKSIZE)
+            if not chunk:
+                break
+            yield asbytes(chunk)
+    else:
+        for line in fh:
+            line = asbytes(line)
+            if not line.endswith(b'\n'):
+                line += b'\n'
+            yield line
+
+
 def loadtxt(fname, dtype=float, comments='#', delimiter=None,
             converters=None, skiprows=0, usecols=None, unpack=False,
-            ndmin=0):
+            ndmin=0, max_rows=None):
     """
     Load data from a text file.
 
@@ -728,6 +1398,11 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
         Legal values: 0 (default), 1 or 2.
 
         .. versionadded:: 1.6.0
+    max_rows : int, optional
+        Read `max_rows` rows of data after `skiprows` lines. The default is
+        to read all the rows.
+
+        .. versionadded:: 1.11.0
 
     Returns
     -------
@@ -751,6 +1426,10 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
     The strings produced by the Python float.hex method can be used as
     input for floats.
 
+    Boolean, integer and float data without user `converters` is parsed
+    by a compiled reader, which gives the same results as the default
+    converters for those types.
+
     Examples
     --------
     >>> from io import StringIO   # StringIO behaves like a file object
@@ -781,32 +1460,17 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
             comments = [asbytes(comment) for comment in comments]
 
         # Compile regex for comments beforehand
-        comments = (re.escape(comment) for comment in comments)
-        regex_comments = re.compile(asbytes('|').join(comments))
+        regex_comments = re.compile(asbytes('|').join(
+            re.escape(comment) for comment in comments))
     user_converters = converters
     if delimiter is not None:
         delimiter = asbytes(delimiter)
     if usecols is not None:
         usecols = list(usecols)
+    if max_rows is not None and max_rows < 0:
+        raise ValueError('max_rows must be non-negative: %s' % max_rows)
 
-    fown = False
-    try:
-        if _is_string_like(fname):
-            fown = True
-            if fname.endswith('.gz'):
-                import gzip
-                fh = iter(gzip.GzipFile(fname))
-            elif fname.endswith('.bz2'):
-                import bz2
-                fh = iter(bz2.BZ2File(fname))
-            elif sys.version_info[0] == 2:
-                fh = iter(open(fname, 'U'))
-            else:
-                fh = iter(open(fname))
-        else:
-            fh = iter(fname)
-    except TypeError:
-        raise ValueError('fname must be a string, file handle, or generator')
+    fh, fown = _loadtxt_open(fname)
     X = []
 
     def flatten_dtype(dt):
@@ -874,6 +1538,23 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
         # Make sure we're dealing with a proper dtype
         dtype = np.dtype(dtype)
         defconv = _getconv(dtype)
+        dtype_types, packing = flatten_dtype(dtype)
+
+        fields = None
+        if not user_converters and delimiter != b'':
+            fields = _loadtxt_fields(dtype)
+        if fields is not None:
+            # Files we don't own are read by lines when only a part of
+            # them is wanted, so that the rest can still be read.
+            blocks = _loadtxt_blocks(fh, fown or max_rows is None)
+            X = _loadtxt(blocks, dtype, fields, delimiter, comments,
+                         skiprows, usecols or None,
+                         -1 if max_rows is None else max_rows)[0]
+            if len(X) == 0:
+                if max_rows != 0:
+                    warnings.warn('loadtxt: Empty input file: "%s"' % fname)
+                X = np.array([], dtype)
+            return _loadtxt_finish(X, dtype, dtype_types, ndmin, unpack)
 
         # Skip the first `skiprows` lines
         for i in range(skiprows):
@@ -893,7 +1574,6 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
             warnings.warn('loadtxt: Empty input file: "%s"' % fname)
         N = len(usecols or first_vals)
 
-        dtype_types, packing = flatten_dtype(dtype)
         if len(dtype_types) > 1:
             # We're dealing with a structured array, each field of
             # the dtype matches a column
@@ -916,6 +1596,8 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
 
         # Parse each line, including the first
         for i, line in enumerate(itertools.chain([first_line], fh)):
+            if max_rows == 0:
+                break
             vals = split_line(line)
             if len(vals) == 0:
                 continue
@@ -931,6 +1613,8 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
             # Then pack it according to the dtype's nesting
             items = pack_items(items, packing)
             X.append(items)
+            if max_rows is not None and len(X) >= max_rows:
+                break
     finally:
         if fown:
             fh.close()
@@ -940,7 +1624,11 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
     # (1, 1, M) for a single row - remove the singleton dimension there
     if X.ndim == 3 and X.shape[:2] == (1, 1):
         X.shape = (1, -1)
+    return _loadtxt_finish(X, dtype, dtype_types, ndmin, unpack)
 
+
+def _loadtxt_finish(X, dtype, dtype_types, ndmin, unpack):
+    """Apply the `ndmin` and `unpack` arguments of loadtxt to its result."""
     # Verify that the array has at least dimensions `ndmin`.
     # Check correctness of the values of `ndmin`
     if ndmin not in [0, 1, 2]:
@@ -966,6 +1654,140 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
         return X
 
 
+def iterloadtxt(fname, chunksize, dtype=float, comments='#', delimiter=None,
+                converters=None, skiprows=0, usecols=None, reuse=False):
+    """
+    Iterate over the data of a text file in arrays of `chunksize` rows.
+
+    The data is read like `loadtxt` reads it, but only `chunksize` rows
+    are held in memory at a time, so that files which are larger than the
+    available memory can be processed.
+
+    Parameters
+    ----------
+    fname : file, str, or generator
+        File, filename, or generator to read, as for `loadtxt`.
+    chunksize : int
+        Number of rows in each array.
+    dtype, comments, delimiter, converters, skiprows, usecols
+        As for `loadtxt`.
+    reuse : bool, optional
+        If True, all chunks are read into the same array instead of a new
+        one each, which is then overwritten when the next chunk is read.
+        Default is False.
+
+    Yields
+    ------
+    out : ndarray
+        The next `chunksize` rows of data, or the remaining ones for the
+        last array.  The arrays are 1-dimensional for a structured `dtype`
+        and have a column for every value of a row otherwise.
+
+    See Also
+    --------
+    loadtxt
+
+    Notes
+    -----
+    .. versionadded:: 1.11.0
+
+    Boolean, integer and float data without `converters` is read by the
+    compiled reader used by `loadtxt`, which doesn't hold the GIL while
+    parsing, so that the next chunk can be read in one thread while the
+    previous one is processed in another.
+
+    Examples
+    --------
+    >>> from io import StringIO
+    >>> c = StringIO("0 1\\n2 3\\n4 5")
+    >>> for rows in np.iterloadtxt(c, 2):
+    ...     print(rows)
+    [[ 0.  1.]
+     [ 2.  3.]]
+    [[ 4.  5.]]
+
+    """
+    chunksize = int(chunksize)
+    if chunksize < 1:
+        raise ValueError('chunksize must be positive: %s' % chunksize)
+    dtype = np.dtype(dtype)
+    if comments is not None:
+        if isinstance(comments, (basestring, bytes)):
+            comments = [comments]
+        comments = [asbytes(comment) for comment in comments]
+    if delimiter is not None:
+        delimiter = asbytes(delimiter)
+    if usecols is not None:
+        usecols = list(usecols) or None
+
+    fields = None
+    if not converters and delimiter != b'':
+        fields = _loadtxt_fields(dtype)
+    if fields is None:
+        return _iterloadtxt_loadtxt(
+            fname, chunksize, dtype=dtype, comments=comments,
+            delimiter=delimiter, converters=converters, skiprows=skiprows,
+            usecols=usecols, ndmin=1 if dtype.names else 2, reuse=reuse)
+    return _iterloadtxt_native(fname, chunksize, dtype, fields, delimiter,
+                               comments, skiprows, usecols, reuse)
+
+
+def _iterloadtxt_native(fname, chunksize, dtype, fields, delimiter,
+                        comments, skiprows, usecols, reuse):
+    """Generator for iterloadtxt using the compiled reader."""
+    fh, fown = _loadtxt_open(fname)
+    try:
+        blocks = _loadtxt_blocks(fh)
+        rest, ncols, lineno, out = b'', -1, 0, None
+        while True:
+            # The reader hands back the input it didn't use
+            X, ncols, lineno, rest = _loadtxt(
+                itertools.chain([rest], blocks), dtype, fields, delimiter,
+                comments, skiprows, usecols, chunksize, ncols=ncols,
+                lineno=lineno, out=out)
+            if len(X) == 0:
+                break
+            if reuse:
+                out = X
+            yield X
+            if len(X) < chunksize:
+                break
+    finally:
+        if fown:
+            fh.close()
+
+
+def _iterloadtxt_loadtxt(fname, chunksize, reuse, **kwargs):
+    """Generator for iterloadtxt calling loadtxt for every chunk."""
+    fh, fown = _loadtxt_open(fname)
+    out = None
+    try:
+        while True:
+            with warnings.catch_warnings():
+                warnings.filterwarnings('ignore',
+                                        message='loadtxt: Empty input file')
+                X = loadtxt(fh, max_rows=chunksize, **kwargs)
+            if len(X) == 0:
+                break
+            if reuse:
+                # Copy the chunk into the array of the first one
+                if out is None:
+                    out = X
+                elif X.shape[1:] != out.shape[1:]:
+                    raise ValueError("Wrong number of columns: %d instead "
+                                     "of %d" % (X.shape[1], out.shape[1]))
+                else:
+                    out[:len(X)] = X
+                    X = out[:len(X)] if len(X) < len(out) else out
+            yield X
+            if len(X) < chunksize:
+                break
+            kwargs['skiprows'] = 0
+    finally:
+        if fown:
+            fh.close()
+
+
 def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
             footer='', comments='# '):
     """
@@ -1145,21 +1967,43 @@ def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
         if len(header) > 0:
             header = header.replace('\n', '\n' + comments)
             fh.write(asbytes(comments + header + newline))
-        if iscomplex_X:
-            for row in X:
+
+        def write_row(row):
+            if iscomplex_X:
                 row2 = []
                 for number in row:
                     row2.append(number.real)
                     row2.append(number.imag)
                 fh.write(asbytes(format % tuple(row2) + newline))
-        else:
-            for row in X:
+            else:
                 try:
                     fh.write(asbytes(format % tuple(row) + newline))
                 except TypeError:
                     raise TypeError("Mismatch between array dtype ('%s') and "
                                     "format specifier ('%s')"
                                     % (str(X.dtype), format))
+
+        # Numeric rows are formatted in blocks by `_format_rows`, which
+        # stops at rows it can't format exactly as Python does
+        i = 0
+        values = _savetxt_values(X)
+        if values is not None:
+            try:
+                bformat, bnewline = asbytes(format), asbytes(newline)
+            except UnicodeError:
+                values = None
+        while values is not None and i < len(X):
+            res = _format_rows(values[i:], bformat, bnewline)
+            if res is None:
+                break
+            text, nrows = res
+            fh.write(text)
+            i += nrows
+            if nrows == 0:
+                write_row(X[i])
+                i += 1
+        for row in X[i:]:
+            write_row(row)
         if len(footer) > 0:
             footer = footer.replace('\n', '\n' + comments)
             fh.write(asbytes(comments + footer + newline))
@@ -1168,6 +2012,23 @@ def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
             fh.close()
 
 
+def _savetxt_values(X):
+    """
+    The values of the rows of `X` for `_format_rows`, as a 2-d array with
+    the real and imaginary parts of complex numbers in separate columns,
+    or None if `X` isn't numeric.
+
+    """
+    if X.ndim != 2 or X.dtype.names is not None or X.dtype.kind not in 'biufc':
+        return None
+    values = np.ascontiguousarray(X)
+    if not values.dtype.isnative:
+        values = values.astype(values.dtype.newbyteorder('='))
+    if values.dtype.kind == 'c':
+        values = values.view(values.real.dtype)
+    return values
+
+
 def fromregex(file, regexp, dtype):
     """
     Construct an array from a text file, using regular expression parsing.
@@ -1256,6 +2117,220 @@ def fromregex(file, regexp, dtype):
 #####--------------------------------------------------------------------------
 
 
+# The conversions of StringConverter known to the native genfromtxt reader
+_GENFROMTXT_MAPPER = [func for (_, func, _) in StringConverter._mapper]
+
+
+def _genfromtxt_native_ok(dtype, delimiter, comments, nbcols, missing_values,
+                          converters, user_converters):
+    """
+    Tell whether the rows of genfromtxt can be split and converted by the
+    native reader.  This needs the standard converters, with the missing
+    values they know being those used for the mask, a plain delimiter and
+    types whose conversions it knows.
+
+    """
+    if user_converters or len(converters) != nbcols:
+        return False
+    if delimiter is not None and not isinstance(delimiter, bytes):
+        return False
+    if comments is not None and not (isinstance(comments, bytes) and
+                                     comments):
+        return False
+    for (miss, conv) in zip(missing_values, converters):
+        if (not all(isinstance(_, bytes) for _ in miss) or
+                set(miss) != conv.missing_values):
+            return False
+    if dtype is None:
+        mapper = [func for (_, func, _) in StringConverter._mapper]
+        return mapper == _GENFROMTXT_MAPPER
+    dtype_flat = flatten_dtype(dtype, flatten_base=True)
+    if len(dtype_flat) > 1:
+        if dtype.names is None or len(dtype_flat) != nbcols:
+            return False
+    elif dtype.names is not None:
+        return False
+    for dt in dtype_flat:
+        if dt.kind not in 'biufcS' or not dt.isnative or dt.itemsize == 0:
+            return False
+    return True
+
+
+def _genfromtxt_accepts(value, status):
+    """
+    Tell whether the conversion of StringConverter with the given status
+    accepts `value` in `StringConverter._strict_call`.
+
+    """
+    (typ, func, _) = StringConverter._mapper[status]
+    try:
+        func(value)
+        if func is int:
+            try:
+                np.array(value, dtype=typ)
+            except OverflowError:
+                raise ValueError
+    except ValueError:
+        return False
+    return True
+
+
+def _genfromtxt_upgrade(converters, text, offsets, mask):
+    """
+    Upgrade the converters of genfromtxt with dtype=None for a table from
+    `_genfromtxt_split`, like `StringConverter.iterupgrade` does for each
+    column.
+
+    """
+    mapper = StringConverter._mapper
+    classes = tuple(sum(_genfromtxt_accepts(value, i) << i
+                        for i in range(len(mapper)))
+                    for value in (b'TRUE', b'1', b'1.5'))
+    columns = _genfromtxt_infer(text, offsets, mask,
+                                [conv._status for conv in converters],
+                                len(mapper), classes, _genfromtxt_accepts)
+    for (conv, (status, bool_missing)) in zip(converters, columns):
+        if status != conv._status:
+            (conv.type, conv.func, default) = mapper[status]
+            if conv._initial_default is not None:
+                conv.default = conv._initial_default
+            else:
+                conv.default = default
+            conv._status = status
+        # _strict_call unchecks booleans for missing values
+        conv._checked = not (status == 0 and bool_missing)
+
+
+def _genfromtxt_field(conv, dt, offset, loose):
+    """
+    Describe a column for `_genfromtxt_convert`, like `_loadtxt_fields`
+    but following the function of its converter.
+
+    """
+    func = conv.func
+    if func is str2bool and dt.kind == 'b':
+        kind = b'B'
+    elif func is int:
+        kind = b'l'
+    elif func is np.int64 or func is np.uint64:
+        kind = b'i'
+    elif dt.kind in 'iu':
+        # StringConverter uses int(float(x)) for the other integers
+        kind = b'I'
+    elif func is float:
+        kind = b'f'
+    elif func is bytes and dt.kind == 'S':
+        kind = b'S'
+    else:
+        kind = b'n'
+    fill = None
+    if kind != b'n':
+        try:
+            fill = np.array(conv.default, dtype=dt).tobytes()
+        except (TypeError, ValueError, OverflowError):
+            pass
+    call = conv._loose_call if loose else conv._strict_call
+    return (offset, dt, kind, call, fill)
+
+
+def _genfromtxt_output(text, offsets, mask, nrows, converters, dtype, names,
+                       defaultfmt, loose, usemask):
+    """
+    Convert the first `nrows` rows of a table from `_genfromtxt_split`
+    into the output of genfromtxt and its mask.  Returns None for the
+    cases left to the Python code, which gets the rows as lists then.
+
+    """
+    nbcols = mask.shape[1]
+    if nrows == 0:
+        return None
+    plain = False
+    if dtype is None:
+        column_types = [np.dtype(conv.type) for conv in converters]
+        strcolidx = [i for (i, conv) in enumerate(converters)
+                     if conv.type in (type('S'), np.string_)]
+        if strcolidx:
+            lens = np.diff(offsets[:nrows * nbcols + 1]).reshape(nrows,
+                                                                 nbcols)
+            for i in strcolidx:
+                width = lens[:, i].max()
+                if width == 0:
+                    return None
+                column_types[i] = np.dtype("|S%i" % width)
+        if names is None:
+            base = set([c.type for c in converters if c._checked])
+            if len(base) == 1:
+                if any(c.type not in base for c in converters):
+                    return None
+                plain = True
+                coldt = max(column_types, key=lambda dt: dt.itemsize)
+            else:
+                names = [defaultfmt % i for i in range(nbcols)]
+        elif len(names) != nbcols:
+            return None
+        if plain:
+            flat = np.dtype([('', coldt)] * nbcols)
+        else:
+            flat = np.dtype(list(zip(names, column_types)))
+            mdtype = np.dtype(list(zip(names, [np.bool] * nbcols)))
+    elif len(flatten_dtype(dtype, flatten_base=True)) > 1:
+        dtype_flat = flatten_dtype(dtype, flatten_base=True)
+        flat = np.dtype([('', _) for _ in dtype_flat])
+    else:
+        plain = True
+        coldt = dtype
+        flat = np.dtype([('', coldt)] * nbcols)
+
+    leaves = [flat.fields[_][:2] for _ in flat.names]
+    fields = [_genfromtxt_field(conv, dt, offset, loose)
+              for (conv, (dt, offset)) in zip(converters, leaves)]
+    rows = _genfromtxt_convert(text, offsets, mask, nrows, flat, fields)
+    mask = mask[:nrows]
+    if plain:
+        return (rows.view(coldt).reshape(nrows, nbcols), mask)
+    if dtype is None:
+        return (rows, mask.view(mdtype).reshape(nrows))
+    if names and dtype.names:
+        dtype.names = names
+    output = rows.view(dtype)
+    if usemask:
+        from numpy.ma import make_mask_descr
+        rowmasks = mask.view(np.dtype([('', np.bool) for t in dtype_flat]))
+        mask = rowmasks.reshape(nrows).view(make_mask_descr(dtype))
+    return (output, mask)
+
+
+def _genfromtxt_rows(text, offsets, mask, nrows):
+    """Return the rows and masks of a table as genfromtxt collects them."""
+    nbcols = mask.shape[1]
+    text = text.tobytes()
+    offsets = offsets[:nrows * nbcols + 1].tolist()
+    values = [text[i:j] for (i, j) in zip(offsets[:-1], offsets[1:])]
+    rows = [tuple(values[i * nbcols:(i + 1) * nbcols]) for i in range(nrows)]
+    masks = [tuple(_) for _ in mask[:nrows].tolist()]
+    return (rows, masks)
+
+
+def _genfromtxt_finish(output, outputmask, converters, usemask, unpack):
+    """Complete the mask of the output of genfromtxt and shape it."""
+    # Try to take care of the missing data we missed
+    names = output.dtype.names
+    if usemask and names:
+        for (name, conv) in zip(names or (), converters):
+            missing_values = [conv(_) for _ in conv.missing_values
+                              if _ != asbytes('')]
+            for mval in missing_values:
+                outputmask[name] |= (output[name] == mval)
+    # Construct the final array
+    if usemask:
+        from numpy.ma import MaskedArray
+        output = output.view(MaskedArray)
+        output._mask = outputmask
+    if unpack:
+        return output.squeeze().T
+    return output.squeeze()
+
+
 def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
                skip_header=0, skip_footer=0, converters=None,
                missing_values=None, filling_values=None, usecols=None,
@@ -1435,7 +2510,7 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
 
     #
     if usemask:
-        from numpy.ma import MaskedArray, make_mask_descr
+        from numpy.ma import make_mask_descr
     # Check the input dictionary of converters
     user_converters = converters or {}
     if not isinstance(user_converters, dict):
@@ -1685,49 +2760,72 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
     # Fixme: possible error as following variable never used.
     #miss_chars = [_.missing_values for _ in converters]
 
-    # Initialize the output lists ...
-    # ... rows
-    rows = []
-    append_to_rows = rows.append
-    # ... masks
-    if usemask:
-        masks = []
-        append_to_masks = masks.append
-    # ... invalid
-    invalid = []
-    append_to_invalid = invalid.append
-
-    # Parse each line
-    for (i, line) in enumerate(itertools.chain([first_line, ], fhd)):
-        values = split_line(line)
-        nbvalues = len(values)
-        # Skip an empty line
-        if nbvalues == 0:
-            continue
-        if usecols:
-            # Select only the columns we need
-            try:
-                values = [values[_] for _ in usecols]
-            except IndexError:
+    # With the standard converters, the lines are split into a table of
+    # tokens and their mask by the native reader
+    native = _genfromtxt_native_ok(dtype, delimiter, comments, nbcols,
+                                   missing_values, converters,
+                                   user_converters)
+    if native:
+        if not first_line.endswith(b'\n'):
+            first_line += b'\n'
+        # Files we don't own are read by lines when only a part of them is
+        # wanted, so that the rest can still be read.  Python 2 files
+        # can't be read after having been iterated over.
+        blocks = _loadtxt_blocks(fhd, sys.version_info[0] >= 3 and
+                                 (own_fhd or max_rows is None))
+        (text, offsets, table_mask, invalid) = _genfromtxt_split(
+            itertools.chain([first_line], blocks), nbcols, delimiter or None,
+            None if comments is None else [comments], autostrip,
+            usecols or None, missing_values,
+            -1 if max_rows is None else max_rows, skip_header)
+        nbvalid = len(table_mask)
+    else:
+        # Initialize the output lists ...
+        # ... rows
+        rows = []
+        append_to_rows = rows.append
+        # ... masks
+        if usemask:
+            masks = []
+            append_to_masks = masks.append
+        # ... invalid
+        invalid = []
+        append_to_invalid = invalid.append
+
+        # Parse each line
+        for (i, line) in enumerate(itertools.chain([first_line, ], fhd)):
+            values = split_line(line)
+            nbvalues = len(values)
+            # Skip an empty line
+            if nbvalues == 0:
+                continue
+            if usecols:
+                # Select only the columns we need
+                try:
+                    values = [values[_] for _ in usecols]
+                except IndexError:
+                    append_to_invalid((i + skip_header + 1, nbvalues))
+                    continue
+            elif nbvalues != nbcols:
                 append_to_invalid((i + skip_header + 1, nbvalues))
                 continue
-        elif nbvalues != nbcols:
-            append_to_invalid((i + skip_header + 1, nbvalues))
-            continue
-        # Store the values
-        append_to_rows(tuple(values))
-        if usemask:
-            append_to_masks(tuple([v.strip() in m
-                                   for (v, m) in zip(values,
-                                                     missing_values)]))
-        if len(rows) == max_rows:
-            break
+            # Store the values
+            append_to_rows(tuple(values))
+            if usemask:
+                append_to_masks(tuple([v.strip() in m
+                                       for (v, m) in zip(values,
+                                                         missing_values)]))
+            if len(rows) == max_rows:
+                break
+        nbvalid = len(rows)
 
     if own_fhd:
         fhd.close()
 
     # Upgrade the converters (if needed)
-    if dtype is None:
+    if dtype is None and native:
+        _genfromtxt_upgrade(converters, text, offsets, table_mask)
+    elif dtype is None:
         for (i, converter) in enumerate(converters):
             current_column = [itemgetter(i)(_m) for _m in rows]
             try:
@@ -1746,7 +2844,7 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
     # Check that we don't have invalid values
     nbinvalid = len(invalid)
     if nbinvalid > 0:
-        nbrows = len(rows) + nbinvalid - skip_footer
+        nbrows = nbvalid + nbinvalid - skip_footer
         # Construct the error message
         template = "    Line #%%i (got %%i columns instead of %i)" % nbcols
         if skip_footer > 0:
@@ -1773,9 +2871,21 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
 
     # Strip the last skip_footer data
     if skip_footer > 0:
-        rows = rows[:-skip_footer]
-        if usemask:
-            masks = masks[:-skip_footer]
+        nbvalid = max(nbvalid - skip_footer, 0)
+        if not native:
+            rows = rows[:-skip_footer]
+            if usemask:
+                masks = masks[:-skip_footer]
+
+    # Convert the table natively, or hand it to the Python code
+    if native:
+        result = _genfromtxt_output(text, offsets, table_mask, nbvalid,
+                                    converters, dtype, names, defaultfmt,
+                                    loose, usemask)
+        if result is not None:
+            return _genfromtxt_finish(result[0], result[1], converters,
+                                      usemask, unpack)
+        (rows, masks) = _genfromtxt_rows(text, offsets, table_mask, nbvalid)
 
     # Convert each value according to the converter:
     # We want to modify the list in place to avoid creating a new one...
@@ -1874,21 +2984,10 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
                 else:
                     mdtype = np.bool
                 outputmask = np.array(masks, dtype=mdtype)
-    # Try to take care of the missing data we missed
-    names = output.dtype.names
-    if usemask and names:
-        for (name, conv) in zip(names or (), converters):
-            missing_values = [conv(_) for _ in conv.missing_values
-                              if _ != asbytes('')]
-            for mval in missing_values:
-                outputmask[name] |= (output[name] == mval)
-    # Construct the final array
-    if usemask:
-        output = output.view(MaskedArray)
-        output._mask = outputmask
-    if unpack:
-        return output.squeeze().T
-    return output.squeeze()
+    if not usemask:
+        outputmask = None
+    return _genfromtxt_finish(output, outputmask, converters, usemask,
+                              unpack)
 
 
 def ndfromtxt(fname, **kwargs):
@@ -422,6 +422,19 @@ class BytesIOSRandomSize(BytesIO):
         size = random.randint(1, size)
         return super(BytesIOSRandomSize, self).read(size)
 
+    def readinto(self, b):
+        data = self.read(len(b))
+        b[:len(data)] = data
+        return len(data)
+
+
+class BytesIOSRead(BytesIO):
+    # A file-like object without readinto
+    def __getattribute__(self, name):
+        if name == 'readinto':
+            raise AttributeError(name)
+        return super(BytesIOSRead, self).__getattribute__(name)
+
 
 def roundtrip(arr):
     f = BytesIO()
@@ -465,6 +478,14 @@ def test_roundtrip_randsize():
             yield assert_array_equal, arr, arr2
 
 
+def test_roundtrip_read():
+    for arr in basic_arrays + record_arrays:
+        f = BytesIO()
+        format.write_array(f, arr)
+        arr2 = format.read_array(BytesIOSRead(f.getvalue()))
+        yield assert_array_equal, arr, arr2
+
+
 def test_roundtrip_truncated():
     for arr in basic_arrays:
         if arr.dtype != object:
@@ -524,6 +545,129 @@ def test_compressed_roundtrip():
     assert_array_equal(arr, arr1)
 
 
+def roundtrip_chunked(arr, start=None, stop=None, cls=BytesIO, **kwargs):
+    f = BytesIO()
+    format.write_array_chunked(f, arr, **kwargs)
+    return format.read_array_chunked(cls(f.getvalue()), start, stop)
+
+
+def test_chunked_roundtrip():
+    for arr in basic_arrays + record_arrays:
+        if arr.ndim == 0 or arr.dtype.hasobject:
+            continue
+        for chunksize in [1, 50, 2**20]:
+            arr2 = roundtrip_chunked(arr, chunksize=chunksize)
+            yield assert_array_equal, arr, arr2
+            if len(arr) < 3:
+                continue
+            arr2 = roundtrip_chunked(arr, 1, -1, BytesIOSRandomSize,
+                                     chunksize=chunksize, workers=3)
+            yield assert_array_equal, arr[1:-1], arr2
+
+
+def test_chunked_rows():
+    arr = np.arange(1000.).reshape(250, 4)
+    f = BytesIO()
+    format.write_array_chunked(f, arr, chunksize=100, level=1, workers=4)
+    for start, stop in [(None, None), (0, 1), (3, 4), (3, 250), (-7, None),
+                        (100, 10), (200, 1000), (-1000, 2)]:
+        for cls in [BytesIO, BytesIOSRandomSize]:
+            arr2 = format.read_array_chunked(cls(f.getvalue()), start, stop,
+                                             workers=2)
+            assert_array_equal(arr[start:stop], arr2)
+
+
+def test_chunked_errors():
+    f = BytesIO()
+    assert_raises(ValueError, format.write_array_chunked, f, np.array(1))
+    assert_raises(ValueError, format.write_array_chunked, f,
+                  np.array([1, 'a'], dtype=object))
+    f = BytesIO()
+    format.write_array_chunked(f, np.arange(100), chunksize=80)
+    data = f.getvalue()
+    assert_raises(ValueError, format.read_array_chunked,
+                  BytesIO(data[:-1]))
+    assert_raises(ValueError, format.read_array_chunked, BytesIO(data[8:]))
+    f = BytesIO()
+    format.write_array(f, np.arange(100))
+    assert_raises(ValueError, format.read_array_chunked,
+                  BytesIO(f.getvalue()))
+
+
+def test_appender():
+    for arr in basic_arrays + record_arrays:
+        if arr.ndim == 0 or arr.dtype.hasobject:
+            continue
+        fname = os.path.join(tempdir, 'appended.npy')
+        with format.ArrayAppender(fname, dtype=arr.dtype,
+                                  shape=arr.shape[1:]) as f:
+            assert_(f.shape == (0,) + arr.shape[1:])
+            assert_(np.load(fname).shape == f.shape)
+            for row in arr[:2]:
+                f.append(row)
+            f.append(arr[2:2])
+        with format.ArrayAppender(fname, 'a') as f:
+            assert_(f.shape == (min(len(arr), 2),) + arr.shape[1:])
+            f.append(arr[2:])
+            assert_(f.shape == arr.shape)
+        yield assert_array_equal, arr, np.load(fname)
+        if arr.size:
+            yield assert_array_equal, arr, format.open_memmap(fname, 'r')
+
+
+def test_appender_crash():
+    fname = os.path.join(tempdir, 'crashed.npy')
+    f = format.ArrayAppender(fname, dtype='<i4', shape=(2,))
+    f.append([[1, 2], [3, 4]])
+    f.flush()
+    f.append([5, 6])
+    # Leave without closing, as a crashed writer would, with part of a row
+    f._fp.write(asbytes('\x07'))
+    f._fp.flush()
+    assert_array_equal(np.load(fname), [[1, 2], [3, 4]])
+    with format.ArrayAppender(fname, 'a') as f2:
+        assert_(f2.shape == (2, 2))
+        f2.append([7, 8])
+    f._fp.close()
+    assert_array_equal(np.load(fname), [[1, 2], [3, 4], [7, 8]])
+
+
+def test_appender_errors():
+    fname = os.path.join(tempdir, 'appended.npy')
+    assert_raises(ValueError, format.ArrayAppender, fname, dtype=object)
+    assert_raises(ValueError, format.ArrayAppender, fname, 'r')
+    assert_raises(ValueError, format.ArrayAppender, BytesIO())
+    with format.ArrayAppender(fname, shape=(3,)) as f:
+        assert_raises(ValueError, f.append, [1, 2])
+        assert_raises(ValueError, f.append, [[1, 2]])
+        assert_raises(ValueError, f.append, 1)
+    assert_(f.closed)
+    assert_raises(ValueError, f.append, [1, 2, 3])
+    # np.save leaves no room in the header for the shape to grow
+    np.save(fname, np.arange(3))
+    assert_raises(ValueError, format.ArrayAppender, fname, 'a')
+    np.save(fname, np.array(1))
+    assert_raises(ValueError, format.ArrayAppender, fname, 'a')
+
+
+def test_write_align():
+    arr = np.arange(1000.).reshape(10, 100)
+    fname = os.path.join(tempdir, 'aligned.npy')
+    for align in [16, 64, 4096]:
+        with open(fname, 'wb') as f:
+            format.write_array(f, arr, align=align)
+        with open(fname, 'rb') as f:
+            format.read_magic(f)
+            format.read_array_header_1_0(f)
+            assert_(f.tell() % align == 0)
+            f.seek(0)
+            assert_array_equal(format.read_array(f), arr)
+        assert_array_equal(format.open_memmap(fname, 'r'), arr)
+    for align in [0, 8, 100]:
+        assert_raises(ValueError, format.write_array, BytesIO(), arr,
+                      align=align)
+
+
 def test_python2_python3_interoperability():
     if sys.version_info[0] >= 3:
         fname = 'win64python2.npy'
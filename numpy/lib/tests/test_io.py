@@ -303,6 +303,155 @@ class TestSavezLoad(RoundtripTest, TestCase):
             data.close()
             assert_(fp.closed)
 
+    def test_mmap(self):
+        arrays = dict(a=np.arange(10.),
+                      b=np.arange(12, dtype=np.complex128).reshape(3, 4).T,
+                      c=np.array([(1, 2.5)], dtype=[('x', 'i1'), ('y', 'f8')]),
+                      d=np.array(3), e=np.array([], dtype='i4'),
+                      f=np.array([None, 1]))
+        for name in 'abcdef':
+            # Shift the members so that alignment must be padded for.
+            arrays['x' * len(name)] = np.zeros(len(name), dtype='u1')
+        with temppath(suffix='.npz') as tmp:
+            np.savez(tmp, **arrays)
+            with np.load(tmp, mmap_mode='r') as data:
+                for name in 'abcd':
+                    arr = data[name]
+                    assert_(isinstance(arr, np.memmap))
+                    assert_(arr.flags.aligned)
+                    assert_(not arr.flags.writeable)
+                    assert_equal(arr, arrays[name])
+                    assert_equal(arr.dtype, arrays[name].dtype)
+                    assert_equal(arr.flags.fnc, arrays[name].flags.fnc)
+                    del arr
+                for name in 'ef':
+                    arr = data[name]
+                    assert_(not isinstance(arr, np.memmap))
+                    assert_equal(arr, arrays[name])
+            with np.load(tmp, mmap_mode='c') as data:
+                arr = data['a']
+                arr[...] = 0
+                del arr
+                assert_equal(data['a'], arrays['a'])
+
+    def test_mmap_compressed(self):
+        a = np.arange(10.)
+        with temppath(suffix='.npz') as tmp:
+            np.savez_compressed(tmp, a=a)
+            with np.load(tmp, mmap_mode='r') as data:
+                arr = data['a']
+                assert_(not isinstance(arr, np.memmap))
+                assert_equal(arr, a)
+
+
+class TestSavezChunked(TestCase):
+    def test_roundtrip(self):
+        a = np.arange(10000.).reshape(-1, 10)
+        b = np.array([(1, 2.), (3, 4.)] * 100, dtype=[('x', 'i4'), ('y', 'f8')])
+        c = np.arange(24).reshape(2, 3, 4).T
+        d = np.array([1, 'a'], dtype=object)
+        e = np.array(3.5)
+        with temppath(suffix='.npz') as tmp:
+            np.savez_chunked(tmp, a=a, b=b, c=c, d=d, e=e, chunksize=1000,
+                             workers=2)
+            with np.load(tmp) as npz:
+                assert_equal(sorted(npz.files), ['a', 'b', 'c', 'd', 'e'])
+                assert_equal(sorted(npz.zip.namelist()),
+                             ['a.npyc', 'b.npyc', 'c.npyc', 'd.npy', 'e.npy'])
+                for name, arr in zip('abcde', [a, b, c, d, e]):
+                    assert_array_equal(npz[name], arr)
+                    assert_equal(npz[name].dtype, arr.dtype)
+                assert_array_equal(npz['a.npyc'], a)
+                assert_(npz['c'].flags.c_contiguous)
+
+    def test_named_like_savez(self):
+        a = np.arange(20).reshape(10, 2)
+        c = BytesIO()
+        np.savez_chunked(c, a, 2*a, x=3*a, level=1)
+        c.seek(0)
+        with np.load(c) as npz:
+            assert_equal(sorted(npz.files), ['arr_0', 'arr_1', 'x'])
+            for name, arr in [('arr_0', a), ('arr_1', 2*a), ('x', 3*a)]:
+                assert_array_equal(npz[name], arr)
+        assert_raises(ValueError, np.savez_chunked, BytesIO(), a, arr_0=a)
+
+    def test_read_rows(self):
+        a = np.arange(10000).reshape(-1, 10)
+        c = BytesIO()
+        np.savez_chunked(c, a, a[:, 0], chunksize=256)
+        c.seek(0)
+        with np.load(c) as npz:
+            for start, stop in [(0, 1), (10, 100), (-3, None), (500, 10)]:
+                assert_array_equal(npz.read_rows('arr_0', start, stop),
+                                   a[start:stop])
+                assert_array_equal(npz.read_rows('arr_1', start, stop),
+                                   a[start:stop, 0])
+            assert_raises(KeyError, npz.read_rows, 'arr_2', 0, 1)
+
+        # other arrays are read whole
+        c = BytesIO()
+        np.savez(c, a=a)
+        c.seek(0)
+        with np.load(c) as npz:
+            assert_array_equal(npz.read_rows('a', 5, 7), a[5:7])
+
+
+class TestFileAsync(TestCase):
+    def test_roundtrip(self):
+        x = np.arange(3 * 2**14 + 3, dtype=np.float64)
+        with temppath() as tmp:
+            for direct in [False, True]:
+                for a in [x, x[1:], x[::2], x[:0], x.reshape(-1, 3).T]:
+                    stats = np.tofile_async(a, tmp, blocksize=5000,
+                                            workers=3, direct=direct,
+                                            return_stats=True)
+                    assert_equal(stats['nbytes'], a.nbytes)
+                    assert_equal(os.path.getsize(tmp), a.nbytes)
+                    y, stats = np.fromfile_async(tmp, a.dtype,
+                                                 blocksize=5000, workers=3,
+                                                 direct=direct,
+                                                 return_stats=True)
+                    assert_array_equal(y, a.ravel())
+                    assert_equal(stats['nbytes'], a.nbytes)
+
+    def test_file_position(self):
+        x = np.arange(1000, dtype=np.int32)
+        with temppath() as tmp:
+            with open(tmp, 'wb') as f:
+                f.write(b'HDR')
+                np.tofile_async(x, f, blocksize=1000)
+                f.write(b'END')
+            with open(tmp, 'rb') as f:
+                assert_equal(f.read(3), b'HDR')
+                y = np.fromfile_async(f, np.int32, count=10)
+                assert_array_equal(y, x[:10])
+                y = np.fromfile_async(f, np.int32, count=990, blocksize=1)
+                assert_array_equal(y, x[10:])
+                assert_equal(f.read(), b'END')
+                f.seek(3)
+                assert_raises(ValueError, np.fromfile_async, f, np.int32,
+                              count=2000)
+
+    def test_append_mode(self):
+        x = np.arange(300000, dtype=np.int64)
+        with temppath() as tmp:
+            with open(tmp, 'wb') as f:
+                f.write(b'HDR')
+            with open(tmp, 'ab') as f:
+                np.tofile_async(x, f, blocksize=4096, workers=8)
+                f.write(b'END')
+            with open(tmp, 'rb') as f:
+                assert_equal(f.read(3), b'HDR')
+                y = np.fromfile_async(f, np.int64, count=x.size)
+                assert_array_equal(y, x)
+                assert_equal(f.read(), b'END')
+
+    def test_object_arrays(self):
+        a = np.array([1, 'a'], dtype=object)
+        with temppath() as tmp:
+            assert_raises(ValueError, np.tofile_async, a, tmp)
+            assert_raises(ValueError, np.fromfile_async, tmp, object)
+
 
 class TestSaveTxt(TestCase):
     def test_array(self):
@@ -448,6 +597,61 @@ class TestSaveTxt(TestCase):
             [b'(3.142e+00+2.718e+00j) (3.142e+00+2.718e+00j)\n',
              b'(3.142e+00+2.718e+00j) (3.142e+00+2.718e+00j)\n'])
 
+    def test_format_like_python(self):
+        # the rows are formatted as by `fmt % tuple(row)`
+        a = np.array([[0.1, -2.5, 1e300, 7],
+                      [-0.0, 1e-10, np.nan, -np.inf],
+                      [1/3., 2**63, 1e20, 5e-324]])
+        ints = ['%05d', '%.0d', '%i']
+        floats = ['%.18e', '%g', '%10.3f', '%-+8.2E|', '%#.0f', '%s']
+        cases = [(x, floats) for x in [a, a.astype(np.float32),
+                                       a.astype(np.longdouble),
+                                       a.astype('>f8'), a[:, ::2],
+                                       a[:, :2].astype(np.complex64)]]
+        cases += [(x, floats + ints) for x in [a[::2, :2],
+                                               np.arange(-5, 7).reshape(3, 4),
+                                               np.eye(3, dtype=bool)]]
+        for x, fmts in cases:
+            for fmt in fmts:
+                c = BytesIO()
+                np.savetxt(c, x, fmt=fmt, delimiter=',', newline='\r\n')
+                if x.dtype.kind == 'c':
+                    rows = [[v for z in row for v in (z.real, z.imag)]
+                            for row in x]
+                    fmt = ' (%s+%sj)' % (fmt, fmt)
+                else:
+                    rows = x
+                fmt = ','.join([fmt] * x.shape[1])
+                expected = ''.join(fmt % tuple(row) + '\r\n' for row in rows)
+                assert_equal(c.getvalue(), asbytes(expected))
+
+        x = np.arange(-5, 7).reshape(3, 4)
+        c = BytesIO()
+        np.savetxt(c, x, fmt=['%x', '%o', '%+X', '%d'])
+        expected = ''.join('%x %o %+X %d\n' % tuple(row) for row in x)
+        assert_equal(c.getvalue(), asbytes(expected))
+
+        # C ignores the sign flags of its unsigned conversions
+        for x in [np.arange(4, dtype=np.uint8).reshape(2, 2),
+                  np.array([[0, 2**63], [2**63 - 1, 2**64 - 1]], np.uint64)]:
+            for fmt in ['%+d', '% d', '%+5i', '%-+6u', '% 03d']:
+                c = BytesIO()
+                np.savetxt(c, x, fmt=fmt)
+                expected = ''.join('%s %s\n' % (fmt % row[0], fmt % row[1])
+                                   for row in x.tolist())
+                assert_equal(c.getvalue(), asbytes(expected))
+
+        # Python before 3.8 keeps the trailing zeros of %g for decimal
+        # ties, and glibc drops those of the alternate form on carries
+        x = np.array([[-105.0, 1905.0], [0.125, 999.5], [0.0, 100.0],
+                      [1.05, 2.5e-7]])
+        for fmt in ['%.2g', '%.3G', '%10.1g', '%#.3g', '%-#8.2G', '%g']:
+            c = BytesIO()
+            np.savetxt(c, x, fmt=fmt)
+            expected = ''.join('%s %s\n' % (fmt % row[0], fmt % row[1])
+                               for row in x.tolist())
+            assert_equal(c.getvalue(), asbytes(expected))
+
     def test_custom_writer(self):
 
         class CustomWriter(list):
@@ -818,6 +1022,180 @@ class TestLoadTxt(TestCase):
         dt = np.dtype([('x', int), ('a', 'S10'), ('y', int)])
         np.loadtxt(c, delimiter=',', dtype=dt, comments=None)  # Should succeed
 
+    def test_max_rows(self):
+        c = TextIO()
+        c.write('# header\n1,2\n3,4\n5,6\n7,8\n')
+        c.seek(0)
+        x = np.loadtxt(c, dtype=int, delimiter=',', max_rows=2)
+        assert_array_equal(x, [[1, 2], [3, 4]])
+        # The rest of the file can still be read
+        x = np.loadtxt(c, dtype=int, delimiter=',', max_rows=1)
+        assert_array_equal(x, [5, 6])
+        c.seek(0)
+        x = np.loadtxt(c, dtype=int, delimiter=',', skiprows=2, max_rows=5)
+        assert_array_equal(x, [[3, 4], [5, 6], [7, 8]])
+        c.seek(0)
+        x = np.loadtxt(c, delimiter=',', max_rows=0)
+        assert_equal(x.shape, (0,))
+        c.seek(0)
+        assert_raises(ValueError, np.loadtxt, c, max_rows=-1)
+
+    def test_native_parsing(self):
+        # The compiled reader must give the results of the default
+        # converters, which it falls back to for other input
+        values = ['0', '1', '-2', '+37', ' 12 ', '1.5', '-2.75', '1e3',
+                  '12345678901234567890', '0x1.8p1', 'inf', '-nan', '1e400',
+                  '2.5e-330', '9007199254740993', '0.1', '123456.789e-3']
+        ints = ['0', '1', '-2', '+37', ' 12 ', '-3', '123456789012345678',
+                '9223372036854775807', '-9223372036854775808']
+        data = '\n'.join(values)
+        for dt in [np.float16, np.float32, np.float64]:
+            conv = np.lib.npyio._getconv(np.dtype(dt))
+            res = np.loadtxt(TextIO(data), dtype=dt, delimiter=',')
+            tgt = np.loadtxt(TextIO(data), dtype=dt, delimiter=',',
+                             converters={0: conv})
+            assert_equal(res, tgt, err_msg=str(dt))
+        for dt in [np.bool_, np.int64, np.uint64, np.longlong, np.int32]:
+            conv = np.lib.npyio._getconv(np.dtype(dt))
+            if dt in (np.int64, np.uint64):
+                data = '\n'.join(ints)
+            elif dt is np.bool_:
+                data = '\n'.join(ints[:-2])
+            else:
+                # These go through float and can't hold all of int64
+                data = '\n'.join(ints[:-2] + values[5:8])
+            res = np.loadtxt(TextIO(data), dtype=dt, delimiter=',')
+            tgt = np.loadtxt(TextIO(data), dtype=dt, delimiter=',',
+                             converters={0: conv})
+            assert_equal(res, tgt, err_msg=str(dt))
+            assert_equal(res.dtype, np.dtype(dt))
+
+        assert_raises(ValueError, np.loadtxt, TextIO('1 2\n3 x'))
+        assert_raises(ValueError, np.loadtxt, TextIO('1.5'), dtype=np.int64)
+        assert_raises(OverflowError, np.loadtxt, TextIO('1e20'),
+                      dtype=np.int32)
+
+    def test_native_blocks(self):
+        # Lines and comments which are split between the blocks read
+        c = TextIO()
+        c.write('# a comment\n')
+        c.write(''.join('%d -%d.5 # comment %d\r\n' % (i, i, i)
+                        for i in range(50)))
+        c.write('\n  \n50 51')
+        blocksize = np.lib.npyio._LOADTXT_BLOCKSIZE
+        try:
+            for np.lib.npyio._LOADTXT_BLOCKSIZE in [1, 7, 64]:
+                c.seek(0)
+                x = np.loadtxt(c, skiprows=1)
+                assert_equal(x.shape, (51, 2))
+                assert_array_equal(x[:50, 0], np.arange(50))
+                assert_array_equal(x[:50, 1], -np.arange(50) - 0.5)
+                assert_array_equal(x[50], [50, 51])
+        finally:
+            np.lib.npyio._LOADTXT_BLOCKSIZE = blocksize
+
+    def test_native_structured(self):
+        data = '1;2.5;3;4;ignored\n-1;0.5;5;6;ignored'
+        dt = np.dtype([('a', 'u1'), ('b', [('x', 'f4'), ('y', 'i8', (2,))])],
+                      align=True)
+        x = np.loadtxt(TextIO(data), dtype=dt, delimiter=';')
+        a = np.array([(1, (2.5, [3, 4])), (255, (0.5, [5, 6]))], dtype=dt)
+        assert_array_equal(x, a)
+        x = np.loadtxt(TextIO(data), dtype=dt, delimiter=';',
+                       usecols=(0, 1, -3, 3))
+        assert_array_equal(x, a)
+        assert_raises(ValueError, np.loadtxt, TextIO(data), dtype=dt,
+                      delimiter=';', usecols=(0, 1))
+        assert_raises(IndexError, np.loadtxt, TextIO(data), dtype=dt,
+                      delimiter=';', usecols=(0, 1, 2, 5))
+
+    def test_structured_short_rows(self):
+        # Short rows are broadcast to subarray fields, like the converters
+        # of the Python code do, but are errors for plain fields
+        dt = np.dtype([('a', int), ('b', int, (2,))])
+        tgt = np.array([(1, [2, 2]), (3, [4, 4])], dtype=dt)
+        assert_array_equal(np.loadtxt(TextIO('1 2\n3 4'), dtype=dt), tgt)
+        chunks = list(np.iterloadtxt(TextIO('1 2\n3 4'), 1, dtype=dt))
+        assert_array_equal(np.concatenate(chunks), tgt)
+        x = np.loadtxt(TextIO('1\n2'), dtype=[('a', int, (3,))])
+        assert_array_equal(x['a'], [[1, 1, 1], [2, 2, 2]])
+        dt = np.dtype([('a', int), ('b', [('x', int), ('y', float)])])
+        assert_raises_regex(ValueError, "line 2", np.loadtxt,
+                            TextIO('1 2 3\n4 5'), dtype=dt)
+        assert_raises_regex(ValueError, "line 1", np.loadtxt,
+                            TextIO('1\n2'), dtype=[('a', int), ('b', int)])
+
+
+class TestIterLoadTxt(TestCase):
+    def test_chunks(self):
+        data = ''.join('%d,%d.5\n' % (i, i) for i in range(10))
+        tgt = np.loadtxt(TextIO(data), delimiter=',')
+        for reuse in [False, True]:
+            chunks = list(np.iterloadtxt(TextIO(data), 4, delimiter=',',
+                                         reuse=reuse))
+            assert_equal([len(x) for x in chunks], [4, 4, 2])
+            if reuse:
+                assert_(chunks[0] is chunks[1])
+                assert_(chunks[2].base is chunks[0])
+            else:
+                assert_array_equal(np.concatenate(chunks), tgt)
+
+        chunks = list(np.iterloadtxt(TextIO(data), 5, delimiter=',',
+                                     usecols=(1,)))
+        assert_equal([x.shape for x in chunks], [(5, 1), (5, 1)])
+        assert_array_equal(np.concatenate(chunks)[:, 0], tgt[:, 1])
+        assert_equal(list(np.iterloadtxt(TextIO(''), 5)), [])
+        assert_raises(ValueError, np.iterloadtxt, TextIO(data), 0)
+
+    def test_blocks(self):
+        # Rows which are split between the blocks read
+        data = '# header\n' + ''.join('%d %d\n' % (i, -i) for i in range(25))
+        blocksize = np.lib.npyio._LOADTXT_BLOCKSIZE
+        try:
+            for np.lib.npyio._LOADTXT_BLOCKSIZE in [1, 5, 64]:
+                chunks = [x.copy() for x in
+                          np.iterloadtxt(TextIO(data), 3, dtype=int,
+                                         skiprows=1, reuse=True)]
+                x = np.concatenate(chunks)
+                assert_array_equal(x[:, 0], np.arange(25))
+                assert_array_equal(x[:, 1], -np.arange(25))
+        finally:
+            np.lib.npyio._LOADTXT_BLOCKSIZE = blocksize
+
+    def test_errors(self):
+        # Errors in later chunks report the line in the file
+        c = TextIO('1 2\n3 4\n5 6\n7\n')
+        it = np.iterloadtxt(c, 2)
+        assert_array_equal(next(it), [[1, 2], [3, 4]])
+        assert_raises_regex(ValueError, "line 4", next, it)
+
+    def test_structured_and_converters(self):
+        data = 'a 1 2.5\nb 3 4.5\nc 5 6.5'
+        dt = np.dtype([('x', int), ('y', float)])
+        chunks = list(np.iterloadtxt(TextIO(data), 2, dtype=dt,
+                                     usecols=(1, 2)))
+        assert_array_equal(np.concatenate(chunks),
+                           np.array([(1, 2.5), (3, 4.5), (5, 6.5)], dt))
+        # Read with loadtxt for every chunk
+        dt = np.dtype([('s', 'S1'), ('x', int), ('y', float)])
+        chunks = list(np.iterloadtxt(TextIO(data), 2, dtype=dt))
+        assert_equal([x.shape for x in chunks], [(2,), (1,)])
+        assert_array_equal(np.concatenate(chunks), np.loadtxt(TextIO(data),
+                                                              dtype=dt))
+        chunks = list(np.iterloadtxt(TextIO(data), 2, usecols=(1,),
+                                     converters={1: lambda s: 2*int(s)}))
+        assert_array_equal(np.concatenate(chunks), [[2], [6], [10]])
+        # The chunks read with loadtxt are reused too
+        tgt = np.loadtxt(TextIO(data), dtype=dt)
+        chunks = [(x, x.copy()) for x in
+                  np.iterloadtxt(TextIO(data), 2, dtype=dt, reuse=True)]
+        assert_(chunks[1][0].base is chunks[0][0])
+        assert_array_equal(np.concatenate([x[1] for x in chunks]), tgt)
+        it = np.iterloadtxt(TextIO('1 2\n3 4\n5\n'), 2, reuse=True,
+                            converters={0: float})
+        assert_array_equal(next(it), [[1, 2], [3, 4]])
+        assert_raises(ValueError, next, it)
+
 
 class Testfromregex(TestCase):
     # np.fromregex expects files opened in binary mode.
@@ -1791,6 +2169,40 @@ M   33  21.99
         assert_equal(test['f1'], 17179869184)
         assert_equal(test['f2'], 1024)
 
+    def test_auto_dtype_upgrade_order(self):
+        # A column is upgraded until one conversion accepts all of it,
+        # booleans and numbers only fit together as strings
+        data = TextIO('TRUE,1,1\nfalse,2,2.5\n1,3,')
+        test = np.genfromtxt(data, delimiter=',', dtype=None, usemask=True)
+        assert_equal(test.dtype, np.dtype([('f0', 'S5'), ('f1', np.int_),
+                                           ('f2', np.float)]))
+        assert_equal(test['f0'], [b'TRUE', b'false', b'1'])
+        assert_equal(test['f2'].mask, [False, False, True])
+
+    def test_missing_values_converted(self):
+        # Missing values which can be converted keep their value and are
+        # masked, filling values are used for the others
+        data = TextIO('1,-999\n2,\n3,4')
+        test = np.genfromtxt(data, delimiter=',', dtype=int,
+                             missing_values='-999', filling_values=0,
+                             usemask=True)
+        assert_equal(test.data, [[1, -999], [2, 0], [3, 4]])
+        assert_equal(test.mask, [[0, 1], [0, 1], [0, 0]])
+
+    def test_large_input(self):
+        # Input spanning several blocks, without a final newline
+        x = np.arange(3 * 2**17).reshape(-1, 3) / 4.
+        txt = BytesIO()
+        np.savetxt(txt, x, fmt='%.10g', delimiter=',')
+        txt = BytesIO(txt.getvalue().rstrip())
+        test = np.genfromtxt(txt, delimiter=',')
+        assert_equal(test, x)
+        txt.seek(0)
+        test = np.genfromtxt(txt, delimiter=',', dtype=None, max_rows=2)
+        assert_equal(test, x[:2])
+        test = np.genfromtxt(txt, delimiter=',', dtype=None, max_rows=2)
+        assert_equal(test, x[2:4])
+
 def test_gzip_load():
     a = np.random.random((5, 5))
 
@@ -44,6 +44,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include "distributions.h"
+#include "ziggurat.h"
 #include <stdio.h>
 
 #ifndef min
@@ -122,21 +123,27 @@ double rk_uniform(rk_state *state, double loc, double scale)
     return loc + scale*rk_double(state);
 }
 
-double rk_standard_gamma(rk_state *state, double shape)
+/*
+ * Standard gamma variates drawn with the given normal and exponential
+ * samplers, shared by the legacy and the ziggurat versions.
+ */
+static double standard_gamma(rk_state *state, double shape,
+                             double (*gauss)(rk_state *),
+                             double (*exponential)(rk_state *))
 {
     double b, c;
     double U, V, X, Y;
 
     if (shape == 1.0)
     {
-        return rk_standard_exponential(state);
+        return exponential(state);
     }
     else if (shape < 1.0)
     {
         for (;;)
         {
             U = rk_double(state);
-            V = rk_standard_exponential(state);
+            V = exponential(state);
             if (U <= 1.0 - shape)
             {
                 X = pow(U, 1./shape);
@@ -164,7 +171,7 @@ double rk_standard_gamma(rk_state *state, double shape)
         {
             do
             {
-                X = rk_gauss(state);
+                X = gauss(state);
                 V = 1.0 + c*X;
             } while (V <= 0.0);
 
@@ -176,11 +183,103 @@ double rk_standard_gamma(rk_state *state, double shape)
     }
 }
 
+double rk_standard_gamma(rk_state *state, double shape)
+{
+    return standard_gamma(state, shape, rk_gauss, rk_standard_exponential);
+}
+
 double rk_gamma(rk_state *state, double shape, double scale)
 {
     return scale * rk_standard_gamma(state, shape);
 }
 
+/*
+ * Ziggurat samplers.  Almost all variates take a single 64 bit draw, 8 bits
+ * of which pick the layer, and are accepted with a table lookup and a
+ * compare.  The tables are in ziggurat.h.
+ */
+double rk_gauss_zig(rk_state *state)
+{
+    npy_uint64 r, rabs;
+    int idx, sign;
+    double x, xx, yy;
+
+    for (;;)
+    {
+        r = rk_uint64(state);
+        idx = r & 0xff;
+        sign = (r >> 8) & 0x1;
+        rabs = (r >> 9) & 0x000fffffffffffffULL;
+        x = rabs*rk_zig_norm_w[idx];
+        if (sign)
+        {
+            x = -x;
+        }
+        if (rabs < rk_zig_norm_k[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            /* Marsaglia's sampler for the tail beyond r */
+            for (;;)
+            {
+                xx = -log(1.0 - rk_double(state))/RK_ZIG_NORM_R;
+                yy = -log(1.0 - rk_double(state));
+                if (yy + yy > xx*xx)
+                {
+                    return sign ? -(RK_ZIG_NORM_R + xx) : RK_ZIG_NORM_R + xx;
+                }
+            }
+        }
+        if ((rk_zig_norm_f[idx - 1] - rk_zig_norm_f[idx])*rk_double(state) +
+                rk_zig_norm_f[idx] < exp(-0.5*x*x))
+        {
+            return x;
+        }
+    }
+}
+
+double rk_normal_zig(rk_state *state, double loc, double scale)
+{
+    return loc + scale*rk_gauss_zig(state);
+}
+
+double rk_standard_exponential_zig(rk_state *state)
+{
+    npy_uint64 r;
+    int idx;
+    double x;
+
+    for (;;)
+    {
+        r = rk_uint64(state) >> 3;
+        idx = r & 0xff;
+        r >>= 8;
+        x = r*rk_zig_exp_w[idx];
+        if (r < rk_zig_exp_k[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            /* the tail beyond r is r plus an exponential variate */
+            return RK_ZIG_EXP_R - log(1.0 - rk_double(state));
+        }
+        if ((rk_zig_exp_f[idx - 1] - rk_zig_exp_f[idx])*rk_double(state) +
+                rk_zig_exp_f[idx] < exp(-x))
+        {
+            return x;
+        }
+    }
+}
+
+double rk_standard_gamma_zig(rk_state *state, double shape)
+{
+    return standard_gamma(state, shape, rk_gauss_zig,
+                          rk_standard_exponential_zig);
+}
+
 double rk_beta(rk_state *state, double a, double b)
 {
     double Ga, Gb;
@@ -913,3 +1012,199 @@ long rk_logseries(rk_state *state, double p)
         return 2;
     }
 }
+
+/*
+ * Fill functions, drawing cnt variates with the same parameters into out.
+ * They give the same values as cnt calls of the samplers, which are called
+ * directly so that they can be inlined.  The cheapest ones transform a
+ * whole block of uniform or normal variates instead.
+ *
+ * The _strided variants read the parameters of the i-th variate from
+ * a[i*a_step], b[i*b_step] and so on, and the plain ones call them with
+ * steps of 0.
+ */
+#define RK_FILL_CONT0(name) \
+void rk_fill_##name(npy_intp cnt, double *out, rk_state *state) \
+{ \
+    npy_intp i; \
+    for (i = 0; i < cnt; i++) \
+    { \
+        out[i] = rk_##name(state); \
+    } \
+}
+
+#define RK_FILL_CONT1(name) \
+void rk_fill_##name##_strided(double *a, npy_intp a_step, npy_intp cnt, \
+                              double *out, rk_state *state) \
+{ \
+    npy_intp i; \
+    for (i = 0; i < cnt; i++) \
+    { \
+        out[i] = rk_##name(state, a[i*a_step]); \
+    } \
+} \
+void rk_fill_##name(double a, npy_intp cnt, double *out, rk_state *state) \
+{ \
+    rk_fill_##name##_strided(&a, 0, cnt, out, state); \
+}
+
+#define RK_FILL_CONT2(name) \
+void rk_fill_##name##_strided(double *a, npy_intp a_step, double *b, \
+                              npy_intp b_step, npy_intp cnt, double *out, \
+                              rk_state *state) \
+{ \
+    npy_intp i; \
+    for (i = 0; i < cnt; i++) \
+    { \
+        out[i] = rk_##name(state, a[i*a_step], b[i*b_step]); \
+    } \
+} \
+void rk_fill_##name(double a, double b, npy_intp cnt, double *out, \
+                    rk_state *state) \
+{ \
+    rk_fill_##name##_strided(&a, 0, &b, 0, cnt, out, state); \
+}
+
+#define RK_FILL_CONT3(name) \
+void rk_fill_##name##_strided(double *a, npy_intp a_step, double *b, \
+                              npy_intp b_step, double *c, npy_intp c_step, \
+                              npy_intp cnt, double *out, rk_state *state) \
+{ \
+    npy_intp i; \
+    for (i = 0; i < cnt; i++) \
+    { \
+        out[i] = rk_##name(state, a[i*a_step], b[i*b_step], c[i*c_step]); \
+    } \
+} \
+void rk_fill_##name(double a, double b, double c, npy_intp cnt, double *out, \
+                    rk_state *state) \
+{ \
+    rk_fill_##name##_strided(&a, 0, &b, 0, &c, 0, cnt, out, state); \
+}
+
+/* The location and scale families, transforming a block of variates */
+#define RK_FILL_LOC_SCALE(name, standard) \
+void rk_fill_##name##_strided(double *loc, npy_intp loc_step, double *scale, \
+                              npy_intp scale_step, npy_intp cnt, double *out, \
+                              rk_state *state) \
+{ \
+    npy_intp i; \
+    rk_fill_##standard(cnt, out, state); \
+    for (i = 0; i < cnt; i++) \
+    { \
+        out[i] = loc[i*loc_step] + scale[i*scale_step]*out[i]; \
+    } \
+} \
+void rk_fill_##name(double loc, double scale, npy_intp cnt, double *out, \
+                    rk_state *state) \
+{ \
+    rk_fill_##name##_strided(&loc, 0, &scale, 0, cnt, out, state); \
+}
+
+#define RK_FILL_DISC(name, params, args) \
+void rk_fill_##name params \
+{ \
+    npy_intp i; \
+    for (i = 0; i < cnt; i++) \
+    { \
+        out[i] = rk_##name args; \
+    } \
+}
+
+void rk_fill_standard_exponential(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+
+    rk_fill_double(cnt, out, state);
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = -log(1.0 - out[i]);
+    }
+}
+
+void rk_fill_exponential_strided(double *scale, npy_intp scale_step,
+                                 npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+
+    rk_fill_standard_exponential(cnt, out, state);
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = scale[i*scale_step] * out[i];
+    }
+}
+
+void rk_fill_exponential(double scale, npy_intp cnt, double *out,
+                         rk_state *state)
+{
+    rk_fill_exponential_strided(&scale, 0, cnt, out, state);
+}
+
+RK_FILL_LOC_SCALE(uniform, double)
+RK_FILL_LOC_SCALE(normal, gauss)
+RK_FILL_LOC_SCALE(normal_zig, gauss_zig)
+
+void rk_fill_lognormal_strided(double *mean, npy_intp mean_step,
+                               double *sigma, npy_intp sigma_step,
+                               npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+
+    rk_fill_normal_strided(mean, mean_step, sigma, sigma_step, cnt, out,
+                           state);
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = exp(out[i]);
+    }
+}
+
+void rk_fill_lognormal(double mean, double sigma, npy_intp cnt, double *out,
+                       rk_state *state)
+{
+    rk_fill_lognormal_strided(&mean, 0, &sigma, 0, cnt, out, state);
+}
+
+RK_FILL_CONT0(gauss_zig)
+RK_FILL_CONT0(standard_exponential_zig)
+RK_FILL_CONT0(standard_cauchy)
+
+RK_FILL_CONT1(standard_gamma)
+RK_FILL_CONT1(standard_gamma_zig)
+RK_FILL_CONT1(chisquare)
+RK_FILL_CONT1(standard_t)
+RK_FILL_CONT1(pareto)
+RK_FILL_CONT1(weibull)
+RK_FILL_CONT1(power)
+RK_FILL_CONT1(rayleigh)
+
+RK_FILL_CONT2(gamma)
+RK_FILL_CONT2(beta)
+RK_FILL_CONT2(f)
+RK_FILL_CONT2(noncentral_chisquare)
+RK_FILL_CONT2(vonmises)
+RK_FILL_CONT2(laplace)
+RK_FILL_CONT2(gumbel)
+RK_FILL_CONT2(logistic)
+RK_FILL_CONT2(wald)
+
+RK_FILL_CONT3(noncentral_f)
+RK_FILL_CONT3(triangular)
+
+RK_FILL_DISC(binomial,
+             (long n, double p, npy_intp cnt, long *out, rk_state *state),
+             (state, n, p))
+RK_FILL_DISC(negative_binomial,
+             (double n, double p, npy_intp cnt, long *out, rk_state *state),
+             (state, n, p))
+RK_FILL_DISC(hypergeometric,
+             (long good, long bad, long sample, npy_intp cnt, long *out,
+              rk_state *state),
+             (state, good, bad, sample))
+RK_FILL_DISC(poisson, (double lam, npy_intp cnt, long *out, rk_state *state),
+             (state, lam))
+RK_FILL_DISC(zipf, (double a, npy_intp cnt, long *out, rk_state *state),
+             (state, a))
+RK_FILL_DISC(geometric, (double p, npy_intp cnt, long *out, rk_state *state),
+             (state, p))
+RK_FILL_DISC(logseries, (double p, npy_intp cnt, long *out, rk_state *state),
+             (state, p))
@@ -45,6 +45,9 @@ extern "C" {
  * Marsaglia, G. and Tsang, W. W. A Simple Method for Generating Gamma
  * Variables. ACM Transactions on Mathematical Software, Vol. 26, No. 3,
  * September 2000, Pages 363–372.
+ *
+ * Marsaglia, G. and Tsang, W. W. The Ziggurat Method for Generating Random
+ * Variables. Journal of Statistical Software, Vol. 5, No. 8, 2000.
  */
 
 /* Normal distribution with mean=loc and standard deviation=scale. */
@@ -68,6 +71,17 @@ extern double rk_uniform(rk_state *state, double loc, double scale);
  */
 extern double rk_standard_gamma(rk_state *state, double shape);
 
+/* Standard normal, normal, standard exponential and standard gamma
+ * distributions with the ziggurat method (Marsaglia and Tsang 2000) in place
+ * of the polar Box-Muller method and the inversion of the CDF.  The
+ * ziggurats take a 64 bit random integer per variate, so they give
+ * different streams than the functions above.
+ */
+extern double rk_gauss_zig(rk_state *state);
+extern double rk_normal_zig(rk_state *state, double loc, double scale);
+extern double rk_standard_exponential_zig(rk_state *state);
+extern double rk_standard_gamma_zig(rk_state *state, double shape);
+
 /* Gamma distribution with shape and scale. */
 extern double rk_gamma(rk_state *state, double shape, double scale);
 
@@ -177,6 +191,160 @@ extern double rk_triangular(rk_state *state, double left, double mode, double ri
 /* Logarithmic series distribution */
 extern long rk_logseries(rk_state *state, double p);
 
+/* Fill functions, drawing cnt variates of the distributions above with the
+ * same parameters into out.  The values are the same as from cnt calls of
+ * the samplers.
+ */
+extern void rk_fill_standard_exponential(npy_intp cnt, double *out,
+                                         rk_state *state);
+extern void rk_fill_gauss_zig(npy_intp cnt, double *out, rk_state *state);
+extern void rk_fill_standard_exponential_zig(npy_intp cnt, double *out,
+                                             rk_state *state);
+extern void rk_fill_standard_cauchy(npy_intp cnt, double *out,
+                                    rk_state *state);
+
+extern void rk_fill_exponential(double scale, npy_intp cnt, double *out,
+                                rk_state *state);
+extern void rk_fill_standard_gamma(double shape, npy_intp cnt, double *out,
+                                   rk_state *state);
+extern void rk_fill_standard_gamma_zig(double shape, npy_intp cnt,
+                                       double *out, rk_state *state);
+extern void rk_fill_chisquare(double df, npy_intp cnt, double *out,
+                              rk_state *state);
+extern void rk_fill_standard_t(double df, npy_intp cnt, double *out,
+                               rk_state *state);
+extern void rk_fill_pareto(double a, npy_intp cnt, double *out,
+                           rk_state *state);
+extern void rk_fill_weibull(double a, npy_intp cnt, double *out,
+                            rk_state *state);
+extern void rk_fill_power(double a, npy_intp cnt, double *out,
+                          rk_state *state);
+extern void rk_fill_rayleigh(double mode, npy_intp cnt, double *out,
+                             rk_state *state);
+
+extern void rk_fill_normal(double loc, double scale, npy_intp cnt,
+                           double *out, rk_state *state);
+extern void rk_fill_normal_zig(double loc, double scale, npy_intp cnt,
+                               double *out, rk_state *state);
+extern void rk_fill_uniform(double loc, double scale, npy_intp cnt,
+                            double *out, rk_state *state);
+extern void rk_fill_gamma(double shape, double scale, npy_intp cnt,
+                          double *out, rk_state *state);
+extern void rk_fill_beta(double a, double b, npy_intp cnt, double *out,
+                         rk_state *state);
+extern void rk_fill_f(double dfnum, double dfden, npy_intp cnt, double *out,
+                      rk_state *state);
+extern void rk_fill_noncentral_chisquare(double df, double nonc,
+                                         npy_intp cnt, double *out,
+                                         rk_state *state);
+extern void rk_fill_vonmises(double mu, double kappa, npy_intp cnt,
+                             double *out, rk_state *state);
+extern void rk_fill_laplace(double loc, double scale, npy_intp cnt,
+                            double *out, rk_state *state);
+extern void rk_fill_gumbel(double loc, double scale, npy_intp cnt,
+                           double *out, rk_state *state);
+extern void rk_fill_logistic(double loc, double scale, npy_intp cnt,
+                             double *out, rk_state *state);
+extern void rk_fill_lognormal(double mean, double sigma, npy_intp cnt,
+                              double *out, rk_state *state);
+extern void rk_fill_wald(double mean, double scale, npy_intp cnt,
+                         double *out, rk_state *state);
+
+extern void rk_fill_noncentral_f(double dfnum, double dfden, double nonc,
+                                 npy_intp cnt, double *out, rk_state *state);
+extern void rk_fill_triangular(double left, double mode, double right,
+                               npy_intp cnt, double *out, rk_state *state);
+
+/* The same with the parameters of the i-th variate at a[i*a_step],
+ * b[i*b_step] and c[i*c_step], a step of 0 repeating a single value.
+ */
+extern void rk_fill_exponential_strided(double *a, npy_intp a_step,
+                                        npy_intp cnt, double *out,
+                                        rk_state *state);
+extern void rk_fill_standard_gamma_strided(double *a, npy_intp a_step,
+                                           npy_intp cnt, double *out,
+                                           rk_state *state);
+extern void rk_fill_standard_gamma_zig_strided(double *a, npy_intp a_step,
+                                               npy_intp cnt, double *out,
+                                               rk_state *state);
+extern void rk_fill_chisquare_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                      double *out, rk_state *state);
+extern void rk_fill_standard_t_strided(double *a, npy_intp a_step,
+                                       npy_intp cnt, double *out,
+                                       rk_state *state);
+extern void rk_fill_pareto_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                   double *out, rk_state *state);
+extern void rk_fill_weibull_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                    double *out, rk_state *state);
+extern void rk_fill_power_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                  double *out, rk_state *state);
+extern void rk_fill_rayleigh_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                     double *out, rk_state *state);
+
+extern void rk_fill_normal_strided(double *a, npy_intp a_step, double *b,
+                                   npy_intp b_step, npy_intp cnt, double *out,
+                                   rk_state *state);
+extern void rk_fill_normal_zig_strided(double *a, npy_intp a_step, double *b,
+                                       npy_intp b_step, npy_intp cnt,
+                                       double *out, rk_state *state);
+extern void rk_fill_uniform_strided(double *a, npy_intp a_step, double *b,
+                                    npy_intp b_step, npy_intp cnt, double *out,
+                                    rk_state *state);
+extern void rk_fill_gamma_strided(double *a, npy_intp a_step, double *b,
+                                  npy_intp b_step, npy_intp cnt, double *out,
+                                  rk_state *state);
+extern void rk_fill_beta_strided(double *a, npy_intp a_step, double *b,
+                                 npy_intp b_step, npy_intp cnt, double *out,
+                                 rk_state *state);
+extern void rk_fill_f_strided(double *a, npy_intp a_step, double *b,
+                              npy_intp b_step, npy_intp cnt, double *out,
+                              rk_state *state);
+extern void rk_fill_noncentral_chisquare_strided(double *a, npy_intp a_step,
+                                                 double *b, npy_intp b_step,
+                                                 npy_intp cnt, double *out,
+                                                 rk_state *state);
+extern void rk_fill_vonmises_strided(double *a, npy_intp a_step, double *b,
+                                     npy_intp b_step, npy_intp cnt,
+                                     double *out, rk_state *state);
+extern void rk_fill_laplace_strided(double *a, npy_intp a_step, double *b,
+                                    npy_intp b_step, npy_intp cnt, double *out,
+                                    rk_state *state);
+extern void rk_fill_gumbel_strided(double *a, npy_intp a_step, double *b,
+                                   npy_intp b_step, npy_intp cnt, double *out,
+                                   rk_state *state);
+extern void rk_fill_logistic_strided(double *a, npy_intp a_step, double *b,
+                                     npy_intp b_step, npy_intp cnt,
+                                     double *out, rk_state *state);
+extern void rk_fill_lognormal_strided(double *a, npy_intp a_step, double *b,
+                                      npy_intp b_step, npy_intp cnt,
+                                      double *out, rk_state *state);
+extern void rk_fill_wald_strided(double *a, npy_intp a_step, double *b,
+                                 npy_intp b_step, npy_intp cnt, double *out,
+                                 rk_state *state);
+
+extern void rk_fill_noncentral_f_strided(double *a, npy_intp a_step, double *b,
+                                         npy_intp b_step, double *c,
+                                         npy_intp c_step, npy_intp cnt,
+                                         double *out, rk_state *state);
+extern void rk_fill_triangular_strided(double *a, npy_intp a_step, double *b,
+                                       npy_intp b_step, double *c,
+                                       npy_intp c_step, npy_intp cnt,
+                                       double *out, rk_state *state);
+
+extern void rk_fill_binomial(long n, double p, npy_intp cnt, long *out,
+                             rk_state *state);
+extern void rk_fill_negative_binomial(double n, double p, npy_intp cnt,
+                                      long *out, rk_state *state);
+extern void rk_fill_hypergeometric(long good, long bad, long sample,
+                                   npy_intp cnt, long *out, rk_state *state);
+extern void rk_fill_poisson(double lam, npy_intp cnt, long *out,
+                            rk_state *state);
+extern void rk_fill_zipf(double a, npy_intp cnt, long *out, rk_state *state);
+extern void rk_fill_geometric(double p, npy_intp cnt, long *out,
+                              rk_state *state);
+extern void rk_fill_logseries(double p, npy_intp cnt, long *out,
+                              rk_state *state);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+"""
+Write mt19937_jump.h, the coefficients of the polynomial x**(2**128)
+modulo the characteristic polynomial of the Mersenne Twister, for the
+jump ahead in randomkit.c.
+
+The characteristic polynomial is the minimal polynomial of the lowest bit
+of the output of the Mersenne Twister in the random module, found with
+the Berlekamp-Massey algorithm.  Polynomials over GF(2) are Python ints,
+bit i holding the coefficient of x**i.
+"""
+from __future__ import division, absolute_import, print_function
+
+import random
+
+MEXP = 19937
+JUMP_LOG2 = 128
+
+
+def berlekamp_massey(bits):
+    # shortest LFSR generating bits, as its connection polynomial
+    n = len(bits)
+    srev = 0
+    for j, b in enumerate(bits):
+        if b:
+            srev |= 1 << (n - 1 - j)
+    c, b, l, m = 1, 1, 0, 1
+    for i in range(n):
+        d = bin(c & (srev >> (n - 1 - i))).count('1') & 1
+        if d == 0:
+            m += 1
+        elif 2*l <= i:
+            c, b = c ^ (b << m), c
+            l = i + 1 - l
+            m = 1
+        else:
+            c ^= b << m
+            m += 1
+    return c, l
+
+
+def polymod(a, p):
+    dp = p.bit_length()
+    while a.bit_length() >= dp:
+        a ^= p << (a.bit_length() - dp)
+    return a
+
+
+def polysquare(a):
+    # squaring over GF(2) spreads the bits apart
+    return int(bin(a)[2:].replace('', '0')[:-1] or '0', 2)
+
+
+def jump_polynomial():
+    random.seed(1)
+    bits = [random.getrandbits(32) & 1 for _ in range(2*MEXP + 100)]
+    c, l = berlekamp_massey(bits)
+    assert l == MEXP
+    # the characteristic polynomial is the reciprocal of c
+    p = 0
+    for i in range(l + 1):
+        if (c >> i) & 1:
+            p |= 1 << (l - i)
+    q = 2
+    for i in range(JUMP_LOG2):
+        q = polymod(polysquare(q), p)
+    return q
+
+
+if __name__ == '__main__':
+    q = jump_polynomial()
+    words = [(q >> (32*i)) & 0xffffffff for i in range(624)]
+    with open('mt19937_jump.h', 'w') as f:
+        f.write('/*\n'
+                ' * Generated by generate_jump_poly.py, do not edit.\n'
+                ' *\n'
+                ' * Coefficients of x^(2^%d) modulo the characteristic '
+                'polynomial of\n'
+                ' * the Mersenne Twister, the coefficient of x^i in bit '
+                'i %% 32 of word\n'
+                ' * i / 32.\n'
+                ' */\n\n' % JUMP_LOG2)
+        f.write('static const npy_uint32 rk_mt19937_jump_poly[624] = {\n')
+        for i in range(0, 624, 5):
+            f.write('    ' + ', '.join('0x%08xUL' % w for w in words[i:i+5]) +
+                    (',\n' if i + 5 < 624 else '\n'))
+        f.write('};\n')
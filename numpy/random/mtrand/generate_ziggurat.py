@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+"""
+Write ziggurat.h, the tables of the 256 layer ziggurats for the normal and
+exponential samplers in distributions.c.
+
+The layers follow Marsaglia and Tsang, "The Ziggurat Method for Generating
+Random Variables", Journal of Statistical Software, Vol. 5, No. 8, 2000:
+layer 0 is the base strip with the tail, layer i > 0 the box of width x[i]
+between f(x[i]) and f(x[i - 1]), all of the same area v.  Variates are
+drawn as u*w[i] with an integer u below 2**bits, accepted at once when
+u < k[i], that is when u*w[i] < x[i - 1].
+"""
+from __future__ import division, absolute_import, print_function
+
+import math
+
+NLAYERS = 256
+
+
+class Normal(object):
+    name = 'norm'
+    bits = 52
+
+    @staticmethod
+    def f(x):
+        return math.exp(-0.5*x*x)
+
+    @staticmethod
+    def finv(y):
+        return math.sqrt(-2.0*math.log(y))
+
+    @staticmethod
+    def tail(r):
+        return math.sqrt(math.pi/2)*math.erfc(r/math.sqrt(2))
+
+
+class Exponential(object):
+    name = 'exp'
+    bits = 53
+
+    @staticmethod
+    def f(x):
+        return math.exp(-x)
+
+    @staticmethod
+    def finv(y):
+        return -math.log(y)
+
+    @staticmethod
+    def tail(r):
+        return math.exp(-r)
+
+
+def layers(dist, r):
+    # x[1], ..., x[N - 1] = r for the rightmost edge r and the area v, or
+    # None when r is too small for the layers to fit under f
+    v = r*dist.f(r) + dist.tail(r)
+    x = [0.0]*NLAYERS
+    x[-1] = r
+    for i in range(NLAYERS - 1, 1, -1):
+        y = v/x[i] + dist.f(x[i])
+        if y >= 1.0:
+            return None, v
+        x[i - 1] = dist.finv(y)
+    return x, v
+
+
+def solve(dist):
+    # the top layer closes at f(0) = 1 for the right r
+    lo, hi = 1.0, 20.0
+    for _ in range(200):
+        r = 0.5*(lo + hi)
+        x, v = layers(dist, r)
+        if x is None or v/x[1] + dist.f(x[1]) > 1.0:
+            lo = r
+        else:
+            hi = r
+        if hi - lo <= 1e-16*r:
+            break
+    return hi
+
+
+def tables(dist):
+    r = solve(dist)
+    x, v = layers(dist, r)
+    m = 2.0**dist.bits
+    q = v/dist.f(r)
+    k = [0]*NLAYERS
+    w = [0.0]*NLAYERS
+    f = [0.0]*NLAYERS
+    k[0] = int(r/q*m)
+    w[0] = q/m
+    f[0] = 1.0
+    for i in range(1, NLAYERS):
+        k[i] = int(x[i - 1]/x[i]*m) if i > 1 else 0
+        w[i] = x[i]/m
+        f[i] = dist.f(x[i])
+    return r, k, w, f
+
+
+def table(ctype, name, values, fmt, per_line):
+    lines = ['    ' + ', '.join(fmt(v) for v in values[i:i+per_line])
+             for i in range(0, len(values), per_line)]
+    return ('static const %s %s[%d] = {\n%s\n};\n' %
+            (ctype, name, len(values), ',\n'.join(lines)))
+
+
+if __name__ == '__main__':
+    with open('ziggurat.h', 'w') as out:
+        out.write('/*\n'
+                  ' * Generated by generate_ziggurat.py, do not edit.\n'
+                  ' *\n'
+                  ' * Ziggurats of %d layers for the normal and exponential '
+                  'samplers.\n'
+                  ' */\n\n' % NLAYERS)
+        parts = []
+        for dist in [Normal, Exponential]:
+            r, k, w, f = tables(dist)
+            parts.append('#define RK_ZIG_%s_R %r\n' % (dist.name.upper(), r))
+            parts.append(table('npy_uint64', 'rk_zig_%s_k' % dist.name, k,
+                               lambda v: '0x%016xULL' % v, 3))
+            parts.append(table('double', 'rk_zig_%s_w' % dist.name, w,
+                               lambda v: '%.17g' % v, 3))
+            parts.append(table('double', 'rk_zig_%s_f' % dist.name, f,
+                               lambda v: '%.17g' % v, 3))
+        out.write('\n'.join(parts))
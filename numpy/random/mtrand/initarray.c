@@ -149,4 +149,6 @@ init_by_array(rk_state *self, unsigned long init_key[], npy_intp key_length)
     self->gauss = 0;
     self->has_gauss = 0;
     self->has_binomial = 0;
+    self->brng = RK_MT19937;
+    self->has_uint32 = 0;
 }
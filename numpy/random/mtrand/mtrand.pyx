@@ -39,11 +39,22 @@ cdef extern from "mtrand_py_helper.h":
 
 cdef extern from "randomkit.h":
 
+    ctypedef enum rk_brng:
+        RK_MT19937 = 0
+        RK_PCG64 = 1
+        RK_XOROSHIRO128PLUS = 2
+        RK_PHILOX4X32 = 3
+        RK_BRNG_MAX = 4
+
+    # 8
+    int RK_BRNG_WORDS
+
     ctypedef struct rk_state:
         unsigned long key[624]
         int pos
         int has_gauss
         double gauss
+        rk_brng brng
 
     ctypedef enum rk_error:
         RK_NOERR = 0
@@ -57,16 +68,24 @@ cdef extern from "randomkit.h":
 
     void rk_seed(unsigned long seed, rk_state *state)
     rk_error rk_randomseed(rk_state *state)
+    void rk_set_brng(rk_brng brng, rk_state *state)
+    void rk_get_brng_state(npy_uint64 *words, rk_state *state)
+    void rk_set_brng_state(rk_brng brng, npy_uint64 *words, rk_state *state)
+    void rk_jump(rk_state *state) nogil
     unsigned long rk_random(rk_state *state)
     long rk_long(rk_state *state) nogil
     unsigned long rk_ulong(rk_state *state) nogil
     unsigned long rk_interval(unsigned long max, rk_state *state) nogil
     double rk_double(rk_state *state) nogil
+    void rk_fill_double(npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_float(npy_intp cnt, float *out, rk_state *state) nogil
+    void rk_fill_long(npy_intp cnt, long *out, rk_state *state) nogil
     void rk_fill(void *buffer, size_t size, rk_state *state) nogil
     rk_error rk_devfill(void *buffer, size_t size, int strong)
     rk_error rk_altfill(void *buffer, size_t size, int strong,
             rk_state *state) nogil
     double rk_gauss(rk_state *state) nogil
+    void rk_fill_gauss(npy_intp cnt, double *out, rk_state *state) nogil
     void rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
                           npy_uint64 *out, rk_state *state) nogil
     void rk_random_uint32(npy_uint32 off, npy_uint32 rng, npy_intp cnt,
@@ -84,6 +103,10 @@ cdef extern from "distributions.h":
 
     double rk_normal(rk_state *state, double loc, double scale) nogil
     double rk_standard_exponential(rk_state *state) nogil
+    double rk_gauss_zig(rk_state *state) nogil
+    double rk_normal_zig(rk_state *state, double loc, double scale) nogil
+    double rk_standard_exponential_zig(rk_state *state) nogil
+    double rk_standard_gamma_zig(rk_state *state, double shape) nogil
     double rk_exponential(rk_state *state, double scale) nogil
     double rk_uniform(rk_state *state, double loc, double scale) nogil
     double rk_standard_gamma(rk_state *state, double shape) nogil
@@ -119,6 +142,143 @@ cdef extern from "distributions.h":
     long rk_hypergeometric(rk_state *state, long good, long bad, long sample) nogil
     long rk_logseries(rk_state *state, double p) nogil
 
+    void rk_fill_standard_exponential(npy_intp cnt, double *out,
+                                      rk_state *state) nogil
+    void rk_fill_gauss_zig(npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_standard_exponential_zig(npy_intp cnt, double *out,
+                                          rk_state *state) nogil
+    void rk_fill_standard_cauchy(npy_intp cnt, double *out,
+                                 rk_state *state) nogil
+    void rk_fill_exponential(double scale, npy_intp cnt, double *out,
+                             rk_state *state) nogil
+    void rk_fill_standard_gamma(double shape, npy_intp cnt, double *out,
+                                rk_state *state) nogil
+    void rk_fill_standard_gamma_zig(double shape, npy_intp cnt, double *out,
+                                    rk_state *state) nogil
+    void rk_fill_chisquare(double df, npy_intp cnt, double *out,
+                           rk_state *state) nogil
+    void rk_fill_standard_t(double df, npy_intp cnt, double *out,
+                            rk_state *state) nogil
+    void rk_fill_pareto(double a, npy_intp cnt, double *out,
+                        rk_state *state) nogil
+    void rk_fill_weibull(double a, npy_intp cnt, double *out,
+                         rk_state *state) nogil
+    void rk_fill_power(double a, npy_intp cnt, double *out,
+                       rk_state *state) nogil
+    void rk_fill_rayleigh(double mode, npy_intp cnt, double *out,
+                          rk_state *state) nogil
+    void rk_fill_normal(double loc, double scale, npy_intp cnt, double *out,
+                        rk_state *state) nogil
+    void rk_fill_normal_zig(double loc, double scale, npy_intp cnt,
+                            double *out, rk_state *state) nogil
+    void rk_fill_uniform(double loc, double scale, npy_intp cnt, double *out,
+                         rk_state *state) nogil
+    void rk_fill_gamma(double shape, double scale, npy_intp cnt, double *out,
+                       rk_state *state) nogil
+    void rk_fill_beta(double a, double b, npy_intp cnt, double *out,
+                      rk_state *state) nogil
+    void rk_fill_f(double dfnum, double dfden, npy_intp cnt, double *out,
+                   rk_state *state) nogil
+    void rk_fill_noncentral_chisquare(double df, double nonc, npy_intp cnt,
+                                      double *out, rk_state *state) nogil
+    void rk_fill_vonmises(double mu, double kappa, npy_intp cnt, double *out,
+                          rk_state *state) nogil
+    void rk_fill_laplace(double loc, double scale, npy_intp cnt, double *out,
+                         rk_state *state) nogil
+    void rk_fill_gumbel(double loc, double scale, npy_intp cnt, double *out,
+                        rk_state *state) nogil
+    void rk_fill_logistic(double loc, double scale, npy_intp cnt, double *out,
+                          rk_state *state) nogil
+    void rk_fill_lognormal(double mean, double sigma, npy_intp cnt,
+                           double *out, rk_state *state) nogil
+    void rk_fill_wald(double mean, double scale, npy_intp cnt, double *out,
+                      rk_state *state) nogil
+    void rk_fill_noncentral_f(double dfnum, double dfden, double nonc,
+                              npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_triangular(double left, double mode, double right,
+                            npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_exponential_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                     double *out, rk_state *state) nogil
+    void rk_fill_standard_gamma_strided(double *a, npy_intp a_step,
+                                        npy_intp cnt, double *out,
+                                        rk_state *state) nogil
+    void rk_fill_standard_gamma_zig_strided(double *a, npy_intp a_step,
+                                            npy_intp cnt, double *out,
+                                            rk_state *state) nogil
+    void rk_fill_chisquare_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                   double *out, rk_state *state) nogil
+    void rk_fill_standard_t_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                    double *out, rk_state *state) nogil
+    void rk_fill_pareto_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                double *out, rk_state *state) nogil
+    void rk_fill_weibull_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                 double *out, rk_state *state) nogil
+    void rk_fill_power_strided(double *a, npy_intp a_step, npy_intp cnt,
+                               double *out, rk_state *state) nogil
+    void rk_fill_rayleigh_strided(double *a, npy_intp a_step, npy_intp cnt,
+                                  double *out, rk_state *state) nogil
+    void rk_fill_normal_strided(double *a, npy_intp a_step, double *b,
+                                npy_intp b_step, npy_intp cnt, double *out,
+                                rk_state *state) nogil
+    void rk_fill_normal_zig_strided(double *a, npy_intp a_step, double *b,
+                                    npy_intp b_step, npy_intp cnt, double *out,
+                                    rk_state *state) nogil
+    void rk_fill_uniform_strided(double *a, npy_intp a_step, double *b,
+                                 npy_intp b_step, npy_intp cnt, double *out,
+                                 rk_state *state) nogil
+    void rk_fill_gamma_strided(double *a, npy_intp a_step, double *b,
+                               npy_intp b_step, npy_intp cnt, double *out,
+                               rk_state *state) nogil
+    void rk_fill_beta_strided(double *a, npy_intp a_step, double *b,
+                              npy_intp b_step, npy_intp cnt, double *out,
+                              rk_state *state) nogil
+    void rk_fill_f_strided(double *a, npy_intp a_step, double *b,
+                           npy_intp b_step, npy_intp cnt, double *out,
+                           rk_state *state) nogil
+    void rk_fill_noncentral_chisquare_strided(double *a, npy_intp a_step,
+                                              double *b, npy_intp b_step,
+                                              npy_intp cnt, double *out,
+                                              rk_state *state) nogil
+    void rk_fill_vonmises_strided(double *a, npy_intp a_step, double *b,
+                                  npy_intp b_step, npy_intp cnt, double *out,
+                                  rk_state *state) nogil
+    void rk_fill_laplace_strided(double *a, npy_intp a_step, double *b,
+                                 npy_intp b_step, npy_intp cnt, double *out,
+                                 rk_state *state) nogil
+    void rk_fill_gumbel_strided(double *a, npy_intp a_step, double *b,
+                                npy_intp b_step, npy_intp cnt, double *out,
+                                rk_state *state) nogil
+    void rk_fill_logistic_strided(double *a, npy_intp a_step, double *b,
+                                  npy_intp b_step, npy_intp cnt, double *out,
+                                  rk_state *state) nogil
+    void rk_fill_lognormal_strided(double *a, npy_intp a_step, double *b,
+                                   npy_intp b_step, npy_intp cnt, double *out,
+                                   rk_state *state) nogil
+    void rk_fill_wald_strided(double *a, npy_intp a_step, double *b,
+                              npy_intp b_step, npy_intp cnt, double *out,
+                              rk_state *state) nogil
+    void rk_fill_noncentral_f_strided(double *a, npy_intp a_step, double *b,
+                                      npy_intp b_step, double *c,
+                                      npy_intp c_step, npy_intp cnt,
+                                      double *out, rk_state *state) nogil
+    void rk_fill_triangular_strided(double *a, npy_intp a_step, double *b,
+                                    npy_intp b_step, double *c,
+                                    npy_intp c_step, npy_intp cnt, double *out,
+                                    rk_state *state) nogil
+    void rk_fill_binomial(long n, double p, npy_intp cnt, long *out,
+                          rk_state *state) nogil
+    void rk_fill_negative_binomial(double n, double p, npy_intp cnt, long *out,
+                                   rk_state *state) nogil
+    void rk_fill_hypergeometric(long good, long bad, long sample, npy_intp cnt,
+                                long *out, rk_state *state) nogil
+    void rk_fill_poisson(double lam, npy_intp cnt, long *out,
+                         rk_state *state) nogil
+    void rk_fill_zipf(double a, npy_intp cnt, long *out, rk_state *state) nogil
+    void rk_fill_geometric(double p, npy_intp cnt, long *out,
+                           rk_state *state) nogil
+    void rk_fill_logseries(double p, npy_intp cnt, long *out,
+                           rk_state *state) nogil
+
 ctypedef double (* rk_cont0)(rk_state *state) nogil
 ctypedef double (* rk_cont1)(rk_state *state, double a) nogil
 ctypedef double (* rk_cont2)(rk_state *state, double a, double b) nogil
@@ -130,6 +290,39 @@ ctypedef long (* rk_discdd)(rk_state *state, double n, double p) nogil
 ctypedef long (* rk_discnmN)(rk_state *state, long n, long m, long N) nogil
 ctypedef long (* rk_discd)(rk_state *state, double a) nogil
 
+ctypedef void (* rk_fill_cont0)(npy_intp cnt, double *out,
+                                rk_state *state) nogil
+ctypedef void (* rk_fill_cont1)(double a, npy_intp cnt, double *out,
+                                rk_state *state) nogil
+ctypedef void (* rk_fill_cont2)(double a, double b, npy_intp cnt, double *out,
+                                rk_state *state) nogil
+ctypedef void (* rk_fill_cont3)(double a, double b, double c, npy_intp cnt,
+                                double *out, rk_state *state) nogil
+
+ctypedef void (* rk_fill_cont1_strided)(double *a, npy_intp a_step,
+                                        npy_intp cnt, double *out,
+                                        rk_state *state) nogil
+ctypedef void (* rk_fill_cont2_strided)(double *a, npy_intp a_step,
+                                        double *b, npy_intp b_step,
+                                        npy_intp cnt, double *out,
+                                        rk_state *state) nogil
+ctypedef void (* rk_fill_cont3_strided)(double *a, npy_intp a_step,
+                                        double *b, npy_intp b_step,
+                                        double *c, npy_intp c_step,
+                                        npy_intp cnt, double *out,
+                                        rk_state *state) nogil
+
+ctypedef void (* rk_fill_disc0)(npy_intp cnt, long *out,
+                                rk_state *state) nogil
+ctypedef void (* rk_fill_discnp)(long n, double p, npy_intp cnt, long *out,
+                                 rk_state *state) nogil
+ctypedef void (* rk_fill_discdd)(double n, double p, npy_intp cnt, long *out,
+                                 rk_state *state) nogil
+ctypedef void (* rk_fill_discnmN)(long n, long m, long N, npy_intp cnt,
+                                  long *out, rk_state *state) nogil
+ctypedef void (* rk_fill_discd)(double a, npy_intp cnt, long *out,
+                                rk_state *state) nogil
+
 
 cdef extern from "initarray.h":
    void init_by_array(rk_state *self, unsigned long *init_key,
@@ -148,326 +341,442 @@ try:
 except ImportError:
     from dummy_threading import Lock
 
-cdef object cont0_array(rk_state *state, rk_cont0 func, object size,
-                        object lock):
+# Size of the blocks of doubles that are rounded to single precision or of
+# gathered broadcast parameters
+DEF FILL_BUFFER = 256
+
+cdef inline npy_intp param_step(ndarray op, npy_intp n):
+    # The step through the data of a parameter broadcast to n values: 0 for
+    # a single value, 1 when it holds the n values C contiguously and -1
+    # when it needs an iterator.
+    if PyArray_SIZE(op) == 1:
+        return 0
+    if (PyArray_SIZE(op) == n and
+            PyArray_CHKFLAGS(op, NPY_ARRAY_C_CONTIGUOUS)):
+        return 1
+    return -1
+
+cdef object cont0_array(rk_state *state, rk_fill_cont0 fill, object size,
+                        object lock, bint single=0):
     cdef double *array_data
+    cdef float *single_data
+    cdef double buffer[FILL_BUFFER]
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
+    cdef npy_intp i, j, n
 
     if size is None:
-        return func(state)
+        fill(1, buffer, state)
+        if single:
+            return np.float32(buffer[0])
+        return buffer[0]
+    elif single:
+        array = <ndarray>np.empty(size, np.float32)
+        length = PyArray_SIZE(array)
+        single_data = <float *>PyArray_DATA(array)
+        with lock, nogil:
+            for i from 0 <= i < length by FILL_BUFFER:
+                n = min(length - i, FILL_BUFFER)
+                fill(n, buffer, state)
+                for j from 0 <= j < n:
+                    single_data[i + j] = <float>buffer[j]
+        return array
     else:
         array = <ndarray>np.empty(size, np.float64)
         length = PyArray_SIZE(array)
         array_data = <double *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state)
+            fill(length, array_data, state)
         return array
 
+cdef object float_array(rk_state *state, object size, object lock):
+    cdef float *array_data
+    cdef float value
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+
+    if size is None:
+        rk_fill_float(1, &value, state)
+        return np.float32(value)
+    else:
+        array = <ndarray>np.empty(size, np.float32)
+        length = PyArray_SIZE(array)
+        array_data = <float *>PyArray_DATA(array)
+        with lock, nogil:
+            rk_fill_float(length, array_data, state)
+        return array
 
-cdef object cont1_array_sc(rk_state *state, rk_cont1 func, object size, double a,
-                           object lock):
+cdef object cont1_array_sc(rk_state *state, rk_fill_cont1 fill, object size,
+                           double a, object lock, bint single=0):
     cdef double *array_data
+    cdef float *single_data
+    cdef double buffer[FILL_BUFFER]
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
+    cdef npy_intp i, j, n
 
     if size is None:
-        return func(state, a)
+        fill(a, 1, buffer, state)
+        if single:
+            return np.float32(buffer[0])
+        return buffer[0]
+    elif single:
+        array = <ndarray>np.empty(size, np.float32)
+        length = PyArray_SIZE(array)
+        single_data = <float *>PyArray_DATA(array)
+        with lock, nogil:
+            for i from 0 <= i < length by FILL_BUFFER:
+                n = min(length - i, FILL_BUFFER)
+                fill(a, n, buffer, state)
+                for j from 0 <= j < n:
+                    single_data[i + j] = <float>buffer[j]
+        return array
     else:
         array = <ndarray>np.empty(size, np.float64)
         length = PyArray_SIZE(array)
         array_data = <double *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, a)
+            fill(a, length, array_data, state)
         return array
 
-cdef object cont1_array(rk_state *state, rk_cont1 func, object size,
-                        ndarray oa, object lock):
+cdef object cont1_array(rk_state *state, rk_fill_cont1_strided fill,
+                        object size, ndarray oa, object lock):
     cdef double *array_data
     cdef double *oa_data
+    cdef double abuf[FILL_BUFFER]
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
+    cdef npy_intp i, j, n, sa
     cdef flatiter itera
     cdef broadcast multi
 
     if size is None:
         array = <ndarray>PyArray_SimpleNew(PyArray_NDIM(oa),
-                PyArray_DIMS(oa) , NPY_DOUBLE)
+                PyArray_DIMS(oa), NPY_DOUBLE)
         length = PyArray_SIZE(array)
         array_data = <double *>PyArray_DATA(array)
+        if PyArray_CHKFLAGS(oa, NPY_ARRAY_C_CONTIGUOUS):
+            oa_data = <double *>PyArray_DATA(oa)
+            with lock, nogil:
+                fill(oa_data, 1, length, array_data, state)
+            return array
         itera = <flatiter>PyArray_IterNew(<object>oa)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, (<double *>(itera.dataptr))[0])
-                PyArray_ITER_NEXT(itera)
+            for i from 0 <= i < length by FILL_BUFFER:
+                n = min(length - i, FILL_BUFFER)
+                for j from 0 <= j < n:
+                    abuf[j] = (<double *>(itera.dataptr))[0]
+                    PyArray_ITER_NEXT(itera)
+                fill(abuf, 1, n, array_data + i, state)
     else:
         array = <ndarray>np.empty(size, np.float64)
         array_data = <double *>PyArray_DATA(array)
-        multi = <broadcast>PyArray_MultiIterNew(2, <void *>array,
-                                                <void *>oa)
+        multi = <broadcast>PyArray_MultiIterNew(2, <void *>array, <void *>oa)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        sa = param_step(oa, multi.size)
+        if sa >= 0:
+            # contiguous or single valued parameters need no iterator
+            oa_data = <double *>PyArray_DATA(oa)
+            with lock, nogil:
+                fill(oa_data, sa, multi.size, array_data, state)
+            return array
+        # otherwise gather the parameters into blocks for the fill
         with lock, nogil:
-            for i from 0 <= i < multi.size:
-                oa_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                array_data[i] = func(state, oa_data[0])
-                PyArray_MultiIter_NEXTi(multi, 1)
+            for i from 0 <= i < multi.size by FILL_BUFFER:
+                n = min(multi.size - i, FILL_BUFFER)
+                for j from 0 <= j < n:
+                    abuf[j] = (<double *>PyArray_MultiIter_DATA(multi, 1))[0]
+                    PyArray_MultiIter_NEXTi(multi, 1)
+                fill(abuf, 1, n, array_data + i, state)
     return array
 
-cdef object cont2_array_sc(rk_state *state, rk_cont2 func, object size, double a,
-                           double b, object lock):
+cdef object cont2_array_sc(rk_state *state, rk_fill_cont2 fill, object size,
+                           double a, double b, object lock):
     cdef double *array_data
+    cdef double value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state, a, b)
+        fill(a, b, 1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, np.float64)
         length = PyArray_SIZE(array)
         array_data = <double *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, a, b)
+            fill(a, b, length, array_data, state)
         return array
 
-
-cdef object cont2_array(rk_state *state, rk_cont2 func, object size,
-                        ndarray oa, ndarray ob, object lock):
+cdef object cont2_array(rk_state *state, rk_fill_cont2_strided fill,
+                        object size, ndarray oa, ndarray ob, object lock):
     cdef double *array_data
     cdef double *oa_data
     cdef double *ob_data
+    cdef double abuf[FILL_BUFFER]
+    cdef double bbuf[FILL_BUFFER]
     cdef ndarray array "arrayObject"
-    cdef npy_intp i
+    cdef npy_intp i, j, k, n
+    cdef npy_intp sa, sb
     cdef broadcast multi
 
     if size is None:
         multi = <broadcast> PyArray_MultiIterNew(2, <void *>oa, <void *>ob)
         array = <ndarray> PyArray_SimpleNew(multi.nd, multi.dimensions, NPY_DOUBLE)
-        array_data = <double *>PyArray_DATA(array)
-        with lock, nogil:
-            for i from 0 <= i < multi.size:
-                oa_data = <double *>PyArray_MultiIter_DATA(multi, 0)
-                ob_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                array_data[i] = func(state, oa_data[0], ob_data[0])
-                PyArray_MultiIter_NEXT(multi)
+        k = 0
     else:
         array = <ndarray>np.empty(size, np.float64)
-        array_data = <double *>PyArray_DATA(array)
-        multi = <broadcast>PyArray_MultiIterNew(3, <void*>array, <void *>oa, <void *>ob)
+        multi = <broadcast>PyArray_MultiIterNew(3, <void *>array, <void *>oa, <void *>ob)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        k = 1
+    array_data = <double *>PyArray_DATA(array)
+
+    sa = param_step(oa, multi.size)
+    sb = param_step(ob, multi.size)
+    if sa >= 0 and sb >= 0:
+        # contiguous or single valued parameters need no iterator
+        oa_data = <double *>PyArray_DATA(oa)
+        ob_data = <double *>PyArray_DATA(ob)
         with lock, nogil:
-            for i from 0 <= i < multi.size:
-                oa_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                ob_data = <double *>PyArray_MultiIter_DATA(multi, 2)
-                array_data[i] = func(state, oa_data[0], ob_data[0])
-                PyArray_MultiIter_NEXTi(multi, 1)
-                PyArray_MultiIter_NEXTi(multi, 2)
-    return array
+            fill(oa_data, sa, ob_data, sb, multi.size, array_data, state)
+        return array
 
-cdef object cont3_array_sc(rk_state *state, rk_cont3 func, object size, double a,
-                           double b, double c, object lock):
+    # otherwise gather the parameters into blocks for the fill
+    with lock, nogil:
+        for i from 0 <= i < multi.size by FILL_BUFFER:
+            n = min(multi.size - i, FILL_BUFFER)
+            for j from 0 <= j < n:
+                abuf[j] = (<double *>PyArray_MultiIter_DATA(multi, k))[0]
+                bbuf[j] = (<double *>PyArray_MultiIter_DATA(multi, k + 1))[0]
+                PyArray_MultiIter_NEXT(multi)
+            fill(abuf, 1, bbuf, 1, n, array_data + i, state)
+    return array
 
+cdef object cont3_array_sc(rk_state *state, rk_fill_cont3 fill, object size,
+                           double a, double b, double c, object lock):
     cdef double *array_data
+    cdef double value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state, a, b, c)
+        fill(a, b, c, 1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, np.float64)
         length = PyArray_SIZE(array)
         array_data = <double *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, a, b, c)
+            fill(a, b, c, length, array_data, state)
         return array
 
-cdef object cont3_array(rk_state *state, rk_cont3 func, object size,
-                        ndarray oa, ndarray ob, ndarray oc, object lock):
-
+cdef object cont3_array(rk_state *state, rk_fill_cont3_strided fill,
+                        object size, ndarray oa, ndarray ob, ndarray oc,
+                        object lock):
     cdef double *array_data
     cdef double *oa_data
     cdef double *ob_data
     cdef double *oc_data
+    cdef double abuf[FILL_BUFFER]
+    cdef double bbuf[FILL_BUFFER]
+    cdef double cbuf[FILL_BUFFER]
     cdef ndarray array "arrayObject"
-    cdef npy_intp i
+    cdef npy_intp i, j, k, n
+    cdef npy_intp sa, sb, sc
     cdef broadcast multi
 
     if size is None:
         multi = <broadcast> PyArray_MultiIterNew(3, <void *>oa, <void *>ob, <void *>oc)
         array = <ndarray> PyArray_SimpleNew(multi.nd, multi.dimensions, NPY_DOUBLE)
-        array_data = <double *>PyArray_DATA(array)
-        with lock, nogil:
-            for i from 0 <= i < multi.size:
-                oa_data = <double *>PyArray_MultiIter_DATA(multi, 0)
-                ob_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                oc_data = <double *>PyArray_MultiIter_DATA(multi, 2)
-                array_data[i] = func(state, oa_data[0], ob_data[0], oc_data[0])
-                PyArray_MultiIter_NEXT(multi)
+        k = 0
     else:
         array = <ndarray>np.empty(size, np.float64)
-        array_data = <double *>PyArray_DATA(array)
-        multi = <broadcast>PyArray_MultiIterNew(4, <void*>array, <void *>oa,
+        multi = <broadcast>PyArray_MultiIterNew(4, <void *>array, <void *>oa,
                                                 <void *>ob, <void *>oc)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        k = 1
+    array_data = <double *>PyArray_DATA(array)
+
+    sa = param_step(oa, multi.size)
+    sb = param_step(ob, multi.size)
+    sc = param_step(oc, multi.size)
+    if sa >= 0 and sb >= 0 and sc >= 0:
+        # contiguous or single valued parameters need no iterator
+        oa_data = <double *>PyArray_DATA(oa)
+        ob_data = <double *>PyArray_DATA(ob)
+        oc_data = <double *>PyArray_DATA(oc)
         with lock, nogil:
-            for i from 0 <= i < multi.size:
-                oa_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                ob_data = <double *>PyArray_MultiIter_DATA(multi, 2)
-                oc_data = <double *>PyArray_MultiIter_DATA(multi, 3)
-                array_data[i] = func(state, oa_data[0], ob_data[0], oc_data[0])
+            fill(oa_data, sa, ob_data, sb, oc_data, sc, multi.size,
+                 array_data, state)
+        return array
+
+    # otherwise gather the parameters into blocks for the fill
+    with lock, nogil:
+        for i from 0 <= i < multi.size by FILL_BUFFER:
+            n = min(multi.size - i, FILL_BUFFER)
+            for j from 0 <= j < n:
+                abuf[j] = (<double *>PyArray_MultiIter_DATA(multi, k))[0]
+                bbuf[j] = (<double *>PyArray_MultiIter_DATA(multi, k + 1))[0]
+                cbuf[j] = (<double *>PyArray_MultiIter_DATA(multi, k + 2))[0]
                 PyArray_MultiIter_NEXT(multi)
+            fill(abuf, 1, bbuf, 1, cbuf, 1, n, array_data + i, state)
     return array
 
-cdef object disc0_array(rk_state *state, rk_disc0 func, object size, object lock):
+cdef object disc0_array(rk_state *state, rk_fill_disc0 fill, object size,
+                        object lock):
     cdef long *array_data
+    cdef long value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state)
+        fill(1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, int)
         length = PyArray_SIZE(array)
         array_data = <long *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state)
+            fill(length, array_data, state)
         return array
 
-cdef object discnp_array_sc(rk_state *state, rk_discnp func, object size,
+cdef object discnp_array_sc(rk_state *state, rk_fill_discnp fill, object size,
                             long n, double p, object lock):
     cdef long *array_data
+    cdef long value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state, n, p)
+        fill(n, p, 1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, int)
         length = PyArray_SIZE(array)
         array_data = <long *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, n, p)
+            fill(n, p, length, array_data, state)
         return array
 
 cdef object discnp_array(rk_state *state, rk_discnp func, object size,
                          ndarray on, ndarray op, object lock):
     cdef long *array_data
-    cdef ndarray array "arrayObject"
-    cdef npy_intp i
-    cdef double *op_data
     cdef long *on_data
+    cdef double *op_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp i, k
+    cdef npy_intp sn, sp
     cdef broadcast multi
 
     if size is None:
         multi = <broadcast> PyArray_MultiIterNew(2, <void *>on, <void *>op)
         array = <ndarray> PyArray_SimpleNew(multi.nd, multi.dimensions, NPY_LONG)
-        array_data = <long *>PyArray_DATA(array)
-        with lock, nogil:
-            for i from 0 <= i < multi.size:
-                on_data = <long *>PyArray_MultiIter_DATA(multi, 0)
-                op_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                array_data[i] = func(state, on_data[0], op_data[0])
-                PyArray_MultiIter_NEXT(multi)
+        k = 0
     else:
         array = <ndarray>np.empty(size, int)
-        array_data = <long *>PyArray_DATA(array)
-        multi = <broadcast>PyArray_MultiIterNew(3, <void*>array, <void *>on, <void *>op)
+        multi = <broadcast>PyArray_MultiIterNew(3, <void *>array, <void *>on, <void *>op)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        k = 1
+    array_data = <long *>PyArray_DATA(array)
+
+    sn = param_step(on, multi.size)
+    sp = param_step(op, multi.size)
+    if sn >= 0 and sp >= 0:
+        # contiguous or single valued parameters need no iterator
+        on_data = <long *>PyArray_DATA(on)
+        op_data = <double *>PyArray_DATA(op)
         with lock, nogil:
             for i from 0 <= i < multi.size:
-                on_data = <long *>PyArray_MultiIter_DATA(multi, 1)
-                op_data = <double *>PyArray_MultiIter_DATA(multi, 2)
-                array_data[i] = func(state, on_data[0], op_data[0])
-                PyArray_MultiIter_NEXTi(multi, 1)
-                PyArray_MultiIter_NEXTi(multi, 2)
+                array_data[i] = func(state, on_data[i*sn], op_data[i*sp])
+        return array
 
+    with lock, nogil:
+        for i from 0 <= i < multi.size:
+            on_data = <long *>PyArray_MultiIter_DATA(multi, k)
+            op_data = <double *>PyArray_MultiIter_DATA(multi, k + 1)
+            array_data[i] = func(state, on_data[0], op_data[0])
+            PyArray_MultiIter_NEXT(multi)
     return array
 
-cdef object discdd_array_sc(rk_state *state, rk_discdd func, object size,
+cdef object discdd_array_sc(rk_state *state, rk_fill_discdd fill, object size,
                             double n, double p, object lock):
     cdef long *array_data
+    cdef long value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state, n, p)
+        fill(n, p, 1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, int)
         length = PyArray_SIZE(array)
         array_data = <long *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, n, p)
+            fill(n, p, length, array_data, state)
         return array
 
 cdef object discdd_array(rk_state *state, rk_discdd func, object size,
                          ndarray on, ndarray op, object lock):
     cdef long *array_data
-    cdef ndarray array "arrayObject"
-    cdef npy_intp i
-    cdef double *op_data
     cdef double *on_data
+    cdef double *op_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp i, k
+    cdef npy_intp sn, sp
     cdef broadcast multi
 
     if size is None:
         multi = <broadcast> PyArray_MultiIterNew(2, <void *>on, <void *>op)
         array = <ndarray> PyArray_SimpleNew(multi.nd, multi.dimensions, NPY_LONG)
-        array_data = <long *>PyArray_DATA(array)
-        with lock, nogil:
-            for i from 0 <= i < multi.size:
-                on_data = <double *>PyArray_MultiIter_DATA(multi, 0)
-                op_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                array_data[i] = func(state, on_data[0], op_data[0])
-                PyArray_MultiIter_NEXT(multi)
+        k = 0
     else:
         array = <ndarray>np.empty(size, int)
-        array_data = <long *>PyArray_DATA(array)
-        multi = <broadcast>PyArray_MultiIterNew(3, <void*>array, <void *>on, <void *>op)
+        multi = <broadcast>PyArray_MultiIterNew(3, <void *>array, <void *>on, <void *>op)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        k = 1
+    array_data = <long *>PyArray_DATA(array)
+
+    sn = param_step(on, multi.size)
+    sp = param_step(op, multi.size)
+    if sn >= 0 and sp >= 0:
+        # contiguous or single valued parameters need no iterator
+        on_data = <double *>PyArray_DATA(on)
+        op_data = <double *>PyArray_DATA(op)
         with lock, nogil:
             for i from 0 <= i < multi.size:
-                on_data = <double *>PyArray_MultiIter_DATA(multi, 1)
-                op_data = <double *>PyArray_MultiIter_DATA(multi, 2)
-                array_data[i] = func(state, on_data[0], op_data[0])
-                PyArray_MultiIter_NEXTi(multi, 1)
-                PyArray_MultiIter_NEXTi(multi, 2)
+                array_data[i] = func(state, on_data[i*sn], op_data[i*sp])
+        return array
 
+    with lock, nogil:
+        for i from 0 <= i < multi.size:
+            on_data = <double *>PyArray_MultiIter_DATA(multi, k)
+            op_data = <double *>PyArray_MultiIter_DATA(multi, k + 1)
+            array_data[i] = func(state, on_data[0], op_data[0])
+            PyArray_MultiIter_NEXT(multi)
     return array
 
-cdef object discnmN_array_sc(rk_state *state, rk_discnmN func, object size,
-                             long n, long m, long N, object lock):
+cdef object discnmN_array_sc(rk_state *state, rk_fill_discnmN fill,
+                             object size, long n, long m, long N, object lock):
     cdef long *array_data
+    cdef long value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state, n, m, N)
+        fill(n, m, N, 1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, int)
         length = PyArray_SIZE(array)
         array_data = <long *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, n, m, N)
+            fill(n, m, N, length, array_data, state)
         return array
 
 cdef object discnmN_array(rk_state *state, rk_discnmN func, object size,
@@ -477,70 +786,85 @@ cdef object discnmN_array(rk_state *state, rk_discnmN func, object size,
     cdef long *om_data
     cdef long *oN_data
     cdef ndarray array "arrayObject"
-    cdef npy_intp i
+    cdef npy_intp i, k
+    cdef npy_intp sn, sm, sN
     cdef broadcast multi
 
     if size is None:
         multi = <broadcast> PyArray_MultiIterNew(3, <void *>on, <void *>om, <void *>oN)
         array = <ndarray> PyArray_SimpleNew(multi.nd, multi.dimensions, NPY_LONG)
-        array_data = <long *>PyArray_DATA(array)
-        with lock, nogil:
-            for i from 0 <= i < multi.size:
-                on_data = <long *>PyArray_MultiIter_DATA(multi, 0)
-                om_data = <long *>PyArray_MultiIter_DATA(multi, 1)
-                oN_data = <long *>PyArray_MultiIter_DATA(multi, 2)
-                array_data[i] = func(state, on_data[0], om_data[0], oN_data[0])
-                PyArray_MultiIter_NEXT(multi)
+        k = 0
     else:
         array = <ndarray>np.empty(size, int)
-        array_data = <long *>PyArray_DATA(array)
-        multi = <broadcast>PyArray_MultiIterNew(4, <void*>array, <void *>on, <void *>om,
-                                                <void *>oN)
+        multi = <broadcast>PyArray_MultiIterNew(4, <void *>array, <void *>on,
+                                                <void *>om, <void *>oN)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        k = 1
+    array_data = <long *>PyArray_DATA(array)
+
+    sn = param_step(on, multi.size)
+    sm = param_step(om, multi.size)
+    sN = param_step(oN, multi.size)
+    if sn >= 0 and sm >= 0 and sN >= 0:
+        # contiguous or single valued parameters need no iterator
+        on_data = <long *>PyArray_DATA(on)
+        om_data = <long *>PyArray_DATA(om)
+        oN_data = <long *>PyArray_DATA(oN)
         with lock, nogil:
             for i from 0 <= i < multi.size:
-                on_data = <long *>PyArray_MultiIter_DATA(multi, 1)
-                om_data = <long *>PyArray_MultiIter_DATA(multi, 2)
-                oN_data = <long *>PyArray_MultiIter_DATA(multi, 3)
-                array_data[i] = func(state, on_data[0], om_data[0], oN_data[0])
-                PyArray_MultiIter_NEXT(multi)
+                array_data[i] = func(state, on_data[i*sn], om_data[i*sm],
+                                     oN_data[i*sN])
+        return array
 
+    with lock, nogil:
+        for i from 0 <= i < multi.size:
+            on_data = <long *>PyArray_MultiIter_DATA(multi, k)
+            om_data = <long *>PyArray_MultiIter_DATA(multi, k + 1)
+            oN_data = <long *>PyArray_MultiIter_DATA(multi, k + 2)
+            array_data[i] = func(state, on_data[0], om_data[0], oN_data[0])
+            PyArray_MultiIter_NEXT(multi)
     return array
 
-cdef object discd_array_sc(rk_state *state, rk_discd func, object size,
+cdef object discd_array_sc(rk_state *state, rk_fill_discd fill, object size,
                            double a, object lock):
     cdef long *array_data
+    cdef long value
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
 
     if size is None:
-        return func(state, a)
+        fill(a, 1, &value, state)
+        return value
     else:
         array = <ndarray>np.empty(size, int)
         length = PyArray_SIZE(array)
         array_data = <long *>PyArray_DATA(array)
         with lock, nogil:
-            for i from 0 <= i < length:
-                array_data[i] = func(state, a)
+            fill(a, length, array_data, state)
         return array
 
-cdef object discd_array(rk_state *state, rk_discd func, object size, ndarray oa,
-                        object lock):
+cdef object discd_array(rk_state *state, rk_discd func, object size,
+                        ndarray oa, object lock):
     cdef long *array_data
     cdef double *oa_data
     cdef ndarray array "arrayObject"
     cdef npy_intp length
-    cdef npy_intp i
-    cdef broadcast multi
+    cdef npy_intp i, sa
     cdef flatiter itera
+    cdef broadcast multi
 
     if size is None:
         array = <ndarray>PyArray_SimpleNew(PyArray_NDIM(oa),
                 PyArray_DIMS(oa), NPY_LONG)
         length = PyArray_SIZE(array)
         array_data = <long *>PyArray_DATA(array)
+        if PyArray_CHKFLAGS(oa, NPY_ARRAY_C_CONTIGUOUS):
+            oa_data = <double *>PyArray_DATA(oa)
+            with lock, nogil:
+                for i from 0 <= i < length:
+                    array_data[i] = func(state, oa_data[i])
+            return array
         itera = <flatiter>PyArray_IterNew(<object>oa)
         with lock, nogil:
             for i from 0 <= i < length:
@@ -552,6 +876,14 @@ cdef object discd_array(rk_state *state, rk_discd func, object size, ndarray oa,
         multi = <broadcast>PyArray_MultiIterNew(2, <void *>array, <void *>oa)
         if (multi.size != PyArray_SIZE(array)):
             raise ValueError("size is not compatible with inputs")
+        sa = param_step(oa, multi.size)
+        if sa >= 0:
+            # contiguous or single valued parameters need no iterator
+            oa_data = <double *>PyArray_DATA(oa)
+            with lock, nogil:
+                for i from 0 <= i < multi.size:
+                    array_data[i] = func(state, oa_data[i*sa])
+            return array
         with lock, nogil:
             for i from 0 <= i < multi.size:
                 oa_data = <double *>PyArray_MultiIter_DATA(multi, 1)
@@ -874,12 +1206,38 @@ _randint_type = {
     'uint64': (0, 2**64, _rand_uint64)
     }
 
+# Names of the bit generators, indexed by rk_brng
+_brng_names = ('MT19937', 'PCG64', 'xoroshiro128+', 'Philox4x32')
+
+def _brng_from_name(name):
+    for i, brng_name in enumerate(_brng_names):
+        if str(name).lower() == brng_name.lower():
+            return i
+    raise ValueError("brng must be one of %s" % (', '.join(_brng_names),))
+
+def _single_dtype(dtype, name):
+    # Whether the floating point output is single precision
+    key = np.dtype(dtype).name
+    if key not in ('float64', 'float32'):
+        raise TypeError('Unsupported dtype "%s" for %s' % (key, name))
+    return key == 'float32'
+
+# Samplers of the normal, exponential and gamma distributions
+_sampler_names = ('legacy', 'ziggurat')
+
+def _sampler_from_name(name):
+    if name not in _sampler_names:
+        raise ValueError("sampler must be one of %s" %
+                         (', '.join(_sampler_names),))
+    return _sampler_names.index(name)
+
 
 cdef class RandomState:
     """
-    RandomState(seed=None)
+    RandomState(seed=None, brng='MT19937', sampler='legacy')
 
-    Container for the Mersenne Twister pseudo-random number generator.
+    Container for the Mersenne Twister pseudo-random number generator, or
+    one of the faster bit generators PCG64, xoroshiro128+ and Philox4x32.
 
     `RandomState` exposes a number of methods for generating random numbers
     drawn from a variety of probability distributions. In addition to the
@@ -907,6 +1265,20 @@ cdef class RandomState:
         If `seed` is ``None``, then `RandomState` will try to read data from
         ``/dev/urandom`` (or the Windows analogue) if available or seed from
         the clock otherwise.
+    brng : str, optional
+        The bit generator all distributions draw from, one of
+        ``'MT19937'`` (the default), ``'PCG64'``, ``'xoroshiro128+'`` or
+        ``'Philox4x32'``, case insensitive.
+
+        .. versionadded:: 1.11.0
+    sampler : str, optional
+        The method used by `standard_normal`, `normal`,
+        `standard_exponential` and `standard_gamma`: ``'legacy'`` (the
+        default) for the polar Box-Muller method and the inversion of the
+        CDF, or ``'ziggurat'`` for the faster ziggurat method [4]_, which
+        gives a different stream of variates.
+
+        .. versionadded:: 1.11.0
 
     Notes
     -----
@@ -916,13 +1288,41 @@ cdef class RandomState:
     NumPy-aware, has the advantage that it provides a much larger number
     of probability distributions to choose from.
 
+    The other bit generators produce 64 bits at a time, so that a double
+    takes one step instead of two steps of the Mersenne Twister, and have
+    small states. PCG64 [1]_ and xoroshiro128+ [2]_ are the fastest,
+    Philox4x32 [3]_ is counter based and about as fast as the Mersenne
+    Twister. They are seeded from the output of the Mersenne Twister
+    seeded with `seed`, so the same seed gives the same stream for each of
+    them. The compatibility guarantee above holds for each bit generator
+    and each sampler. The other distributions draw their normal,
+    exponential and gamma variates with the legacy methods.
+
+    References
+    ----------
+    .. [1] M. E. O'Neill, "PCG: A Family of Simple Fast Space-Efficient
+           Statistically Good Algorithms for Random Number Generation",
+           Harvey Mudd College, HMC-CS-2014-0905, 2014.
+    .. [2] D. Blackman and S. Vigna, "xoroshiro128+",
+           http://xoroshiro.di.unimi.it
+    .. [3] J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+           "Parallel Random Numbers: As Easy as 1, 2, 3", Proceedings of
+           SC11, 2011.
+    .. [4] G. Marsaglia and W. W. Tsang, "The Ziggurat Method for
+           Generating Random Variables", *Journal of Statistical Software*,
+           Vol. 5, No. 8, 2000.
+
     """
     cdef rk_state *internal_state
+    cdef rk_brng brng
+    cdef int sampler
     cdef object lock
     cdef object state_address
     poisson_lam_max = np.iinfo('l').max - np.sqrt(np.iinfo('l').max)*10
 
-    def __init__(self, seed=None):
+    def __init__(self, seed=None, brng='MT19937', sampler='legacy'):
+        self.brng = <rk_brng><int>_brng_from_name(brng)
+        self.sampler = _sampler_from_name(sampler)
         self.internal_state = <rk_state*>PyMem_Malloc(sizeof(rk_state))
         self.state_address = NpyCapsule_FromVoidPtr(self.internal_state, NULL)
         self.lock = Lock()
@@ -959,12 +1359,14 @@ cdef class RandomState:
             if seed is None:
                 with self.lock:
                     errcode = rk_randomseed(self.internal_state)
+                    rk_set_brng(self.brng, self.internal_state)
             else:
                 idx = operator.index(seed)
                 if idx > int(2**32 - 1) or idx < 0:
                     raise ValueError("Seed must be between 0 and 4294967295")
                 with self.lock:
                     rk_seed(idx, self.internal_state)
+                    rk_set_brng(self.brng, self.internal_state)
         except TypeError:
             obj = np.asarray(seed).astype(np.int64, casting='safe')
             if ((obj > int(2**32 - 1)) | (obj < 0)).any():
@@ -973,6 +1375,7 @@ cdef class RandomState:
             with self.lock:
                 init_by_array(self.internal_state, <unsigned long *>PyArray_DATA(obj),
                     PyArray_DIM(obj, 0))
+                rk_set_brng(self.brng, self.internal_state)
 
     def get_state(self):
         """
@@ -993,6 +1396,10 @@ cdef class RandomState:
             4. an integer ``has_gauss``.
             5. a float ``cached_gaussian``.
 
+            For the other bit generators the tuple is
+            ``(name, words, has_gauss, cached_gaussian)``, where ``words``
+            is a 1-D array of 8 uint64 holding the state of the generator.
+
         See Also
         --------
         set_state
@@ -1005,6 +1412,14 @@ cdef class RandomState:
 
         """
         cdef ndarray state "arrayObject_state"
+        if self.brng != RK_MT19937:
+            state = <ndarray>np.empty(RK_BRNG_WORDS, np.uint64)
+            with self.lock:
+                rk_get_brng_state(<npy_uint64 *>PyArray_DATA(state),
+                                  self.internal_state)
+                has_gauss = self.internal_state.has_gauss
+                gauss = self.internal_state.gauss
+            return (_brng_names[self.brng], state, has_gauss, gauss)
         state = <ndarray>np.empty(624, np.uint)
         with self.lock:
             memcpy(<void*>PyArray_DATA(state), <void*>(self.internal_state.key), 624*sizeof(long))
@@ -1034,6 +1449,10 @@ cdef class RandomState:
             4. an integer ``has_gauss``.
             5. a float ``cached_gaussian``.
 
+            The states of the other bit generators, as returned by
+            `get_state`, are ``(name, words, has_gauss, cached_gaussian)``.
+            Setting a state also switches to its bit generator.
+
         Returns
         -------
         out : None
@@ -1063,9 +1482,28 @@ cdef class RandomState:
         """
         cdef ndarray obj "arrayObject_obj"
         cdef int pos
+        cdef rk_brng brng
         algorithm_name = state[0]
-        if algorithm_name != 'MT19937':
-            raise ValueError("algorithm must be 'MT19937'")
+        if algorithm_name not in _brng_names:
+            raise ValueError("algorithm must be one of %s" %
+                             (', '.join(_brng_names),))
+        brng = <rk_brng><int>_brng_names.index(algorithm_name)
+        if brng != RK_MT19937:
+            if len(state) != 4:
+                raise ValueError("state must be (name, words, has_gauss, "
+                                 "cached_gaussian)")
+            has_gauss, cached_gaussian = state[2:4]
+            obj = <ndarray>PyArray_ContiguousFromObject(state[1], NPY_ULONGLONG,
+                                                         1, 1)
+            if PyArray_DIM(obj, 0) != RK_BRNG_WORDS:
+                raise ValueError("state must be %d uint64" % RK_BRNG_WORDS)
+            with self.lock:
+                rk_set_brng_state(brng, <npy_uint64 *>PyArray_DATA(obj),
+                                  self.internal_state)
+                self.internal_state.has_gauss = has_gauss
+                self.internal_state.gauss = cached_gaussian
+                self.brng = brng
+            return
         key, pos = state[1:3]
         if len(state) == 3:
             has_gauss = 0
@@ -1080,6 +1518,8 @@ cdef class RandomState:
         if PyArray_DIM(obj, 0) != 624:
             raise ValueError("state must be 624 longs")
         with self.lock:
+            rk_set_brng(RK_MT19937, self.internal_state)
+            self.brng = RK_MT19937
             memcpy(<void*>(self.internal_state.key), <void*>PyArray_DATA(obj), 624*sizeof(long))
             self.internal_state.pos = pos
             self.internal_state.has_gauss = has_gauss
@@ -1093,12 +1533,128 @@ cdef class RandomState:
         self.set_state(state)
 
     def __reduce__(self):
+        if self.sampler:
+            return (np.random.__RandomState_ctor,
+                    (_sampler_names[self.sampler],), self.get_state())
         return (np.random.__RandomState_ctor, (), self.get_state())
 
+    # Parallel streams:
+    def jumped(self, jumps=1):
+        """
+        jumped(jumps=1)
+
+        Return a copy of the generator advanced by `jumps` jumps.
+
+        A jump advances the state as if a large number of values had been
+        drawn: 2**128 32 bit values for the Mersenne Twister, 2**64 64 bit
+        values for PCG64 and xoroshiro128+ and 2**65 for Philox4x32.  The
+        streams of generators jumped a different number of times from the
+        same state do not overlap unless that many values are drawn from
+        them, so they can be used in parallel.
+
+        .. versionadded:: 1.11.0
+
+        Parameters
+        ----------
+        jumps : int, optional
+            Number of jumps, at least 0.
+
+        Returns
+        -------
+        out : RandomState
+            A new generator, this one is left unchanged.
+
+        See Also
+        --------
+        spawn
+
+        Notes
+        -----
+        The Mersenne Twister is jumped with the polynomial method of [1]_,
+        which takes a few milliseconds a jump.
+
+        References
+        ----------
+        .. [1] H. Haramoto, M. Matsumoto, T. Nishimura, F. Panneton and
+           P. L'Ecuyer, "Efficient Jump Ahead for F2-Linear Random Number
+           Generators", *INFORMS Journal on Computing*, Vol. 20, No. 3,
+           pp. 385-390, 2008.
+
+        Examples
+        --------
+        >>> rs = np.random.RandomState(1234)
+        >>> streams = [rs.jumped(i) for i in range(4)]
+
+        """
+        cdef RandomState other
+        cdef npy_intp i, n
+        n = operator.index(jumps)
+        if n < 0:
+            raise ValueError("jumps < 0")
+        other = RandomState(0, _brng_names[self.brng],
+                            _sampler_names[self.sampler])
+        with self.lock:
+            memcpy(<void*>(other.internal_state),
+                   <void*>(self.internal_state), sizeof(rk_state))
+        with nogil:
+            for i from 0 <= i < n:
+                rk_jump(other.internal_state)
+        return other
+
+    def spawn(self, n):
+        """
+        spawn(n)
+
+        Return `n` generators with non-overlapping streams.
+
+        The i-th generator is a copy of this one jumped `i` times, see
+        `jumped`, and this one is then advanced by `n` jumps, past the
+        streams of the new ones, so that spawning again gives new streams.
+        The streams are reproducible from the seed of this generator.
+
+        .. versionadded:: 1.11.0
+
+        Parameters
+        ----------
+        n : int
+            Number of generators.
+
+        Returns
+        -------
+        out : list of RandomState
+            The new generators.
+
+        See Also
+        --------
+        jumped
+
+        Examples
+        --------
+        >>> rs = np.random.RandomState(1234)
+        >>> workers = rs.spawn(8)
+        >>> [w.standard_normal(3) for w in workers]  # doctest: +SKIP
+
+        """
+        cdef RandomState other
+        n = operator.index(n)
+        if n < 0:
+            raise ValueError("n < 0")
+        streams = []
+        with self.lock:
+            for i in range(n):
+                other = RandomState(0, _brng_names[self.brng],
+                                    _sampler_names[self.sampler])
+                memcpy(<void*>(other.internal_state),
+                       <void*>(self.internal_state), sizeof(rk_state))
+                streams.append(other)
+                with nogil:
+                    rk_jump(self.internal_state)
+        return streams
+
     # Basic distributions:
-    def random_sample(self, size=None):
+    def random_sample(self, size=None, dtype=np.float64):
         """
-        random_sample(size=None)
+        random_sample(size=None, dtype=np.float64)
 
         Return random floats in the half-open interval [0.0, 1.0).
 
@@ -1114,6 +1670,13 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        dtype : {float64, float32}, optional
+            Desired dtype of the result, float64 by default. The single
+            precision values are the double precision ones truncated to 24
+            bits after the point, so that they stay below 1.0, and the
+            values drawn do not depend on `dtype`.
+
+            .. versionadded:: 1.11.0
 
         Returns
         -------
@@ -1138,7 +1701,10 @@ cdef class RandomState:
                [-1.23204345, -1.75224494]])
 
         """
-        return cont0_array(self.internal_state, rk_double, size, self.lock)
+        if _single_dtype(dtype, 'random_sample'):
+            return float_array(self.internal_state, size, self.lock)
+        return cont0_array(self.internal_state, rk_fill_double, size,
+                           self.lock)
 
     def tomaxint(self, size=None):
         """
@@ -1185,7 +1751,7 @@ cdef class RandomState:
                 [ True,  True]]], dtype=bool)
 
         """
-        return disc0_array(self.internal_state, rk_long, size, self.lock)
+        return disc0_array(self.internal_state, rk_fill_long, size, self.lock)
 
     def randint(self, low, high=None, size=None, dtype='l'):
         """
@@ -1557,7 +2123,7 @@ cdef class RandomState:
             raise OverflowError('Range exceeds valid bounds')
 
         if not PyErr_Occurred():
-            return cont2_array_sc(self.internal_state, rk_uniform, size, flow,
+            return cont2_array_sc(self.internal_state, rk_fill_uniform, size, flow,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -1567,8 +2133,8 @@ cdef class RandomState:
         Py_INCREF(temp)  # needed to get around Pyrex's automatic reference-counting
                          # rules because EnsureArray steals a reference
         odiff = <ndarray>PyArray_EnsureArray(temp)
-        return cont2_array(self.internal_state, rk_uniform, size, olow, odiff,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_uniform_strided, size,
+                           olow, odiff, self.lock)
 
     def rand(self, *args):
         """
@@ -1756,9 +2322,9 @@ cdef class RandomState:
 
 
     # Complicated, continuous distributions:
-    def standard_normal(self, size=None):
+    def standard_normal(self, size=None, dtype=np.float64):
         """
-        standard_normal(size=None)
+        standard_normal(size=None, dtype=np.float64)
 
         Draw samples from a standard Normal distribution (mean=0, stdev=1).
 
@@ -1768,6 +2334,12 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        dtype : {float64, float32}, optional
+            Desired dtype of the result, float64 by default. The single
+            precision values are the double precision ones rounded, so the
+            values drawn do not depend on `dtype`.
+
+            .. versionadded:: 1.11.0
 
         Returns
         -------
@@ -1787,7 +2359,12 @@ cdef class RandomState:
         (3, 4, 2)
 
         """
-        return cont0_array(self.internal_state, rk_gauss, size, self.lock)
+        cdef bint single = _single_dtype(dtype, 'standard_normal')
+        if self.sampler:
+            return cont0_array(self.internal_state, rk_fill_gauss_zig, size,
+                               self.lock, single)
+        return cont0_array(self.internal_state, rk_fill_gauss, size,
+                           self.lock, single)
 
     def normal(self, loc=0.0, scale=1.0, size=None):
         """
@@ -1874,13 +2451,21 @@ cdef class RandomState:
         """
         cdef ndarray oloc, oscale
         cdef double floc, fscale
+        cdef rk_fill_cont2_strided func
+        cdef rk_fill_cont2 fill
 
+        if self.sampler:
+            func = rk_fill_normal_zig_strided
+            fill = rk_fill_normal_zig
+        else:
+            func = rk_fill_normal_strided
+            fill = rk_fill_normal
         floc = PyFloat_AsDouble(loc)
         fscale = PyFloat_AsDouble(scale)
         if not PyErr_Occurred():
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_normal, size, floc,
+            return cont2_array_sc(self.internal_state, fill, size, floc,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -1889,7 +2474,7 @@ cdef class RandomState:
         oscale = <ndarray>PyArray_FROM_OTF(scale, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oscale, 0)):
             raise ValueError("scale <= 0")
-        return cont2_array(self.internal_state, rk_normal, size, oloc, oscale,
+        return cont2_array(self.internal_state, func, size, oloc, oscale,
                            self.lock)
 
     def beta(self, a, b, size=None):
@@ -1940,7 +2525,7 @@ cdef class RandomState:
                 raise ValueError("a <= 0")
             if fb <= 0:
                 raise ValueError("b <= 0")
-            return cont2_array_sc(self.internal_state, rk_beta, size, fa, fb,
+            return cont2_array_sc(self.internal_state, rk_fill_beta, size, fa, fb,
                                   self.lock)
 
         PyErr_Clear()
@@ -1951,8 +2536,8 @@ cdef class RandomState:
             raise ValueError("a <= 0")
         if np.any(np.less_equal(ob, 0)):
             raise ValueError("b <= 0")
-        return cont2_array(self.internal_state, rk_beta, size, oa, ob,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_beta_strided, size, oa,
+                           ob, self.lock)
 
     def exponential(self, scale=1.0, size=None):
         """
@@ -2000,7 +2585,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont1_array_sc(self.internal_state, rk_exponential, size,
+            return cont1_array_sc(self.internal_state, rk_fill_exponential, size,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -2009,12 +2594,12 @@ cdef class RandomState:
                                             NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oscale, 0.0)):
             raise ValueError("scale <= 0")
-        return cont1_array(self.internal_state, rk_exponential, size, oscale,
-                           self.lock)
+        return cont1_array(self.internal_state, rk_fill_exponential_strided,
+                           size, oscale, self.lock)
 
-    def standard_exponential(self, size=None):
+    def standard_exponential(self, size=None, dtype=np.float64):
         """
-        standard_exponential(size=None)
+        standard_exponential(size=None, dtype=np.float64)
 
         Draw samples from the standard exponential distribution.
 
@@ -2027,6 +2612,12 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        dtype : {float64, float32}, optional
+            Desired dtype of the result, float64 by default. The single
+            precision values are the double precision ones rounded, so the
+            values drawn do not depend on `dtype`.
+
+            .. versionadded:: 1.11.0
 
         Returns
         -------
@@ -2040,12 +2631,17 @@ cdef class RandomState:
         >>> n = np.random.standard_exponential((3, 8000))
 
         """
-        return cont0_array(self.internal_state, rk_standard_exponential, size,
-                           self.lock)
-
-    def standard_gamma(self, shape, size=None):
+        cdef bint single = _single_dtype(dtype, 'standard_exponential')
+        if self.sampler:
+            return cont0_array(self.internal_state,
+                               rk_fill_standard_exponential_zig, size,
+                               self.lock, single)
+        return cont0_array(self.internal_state, rk_fill_standard_exponential,
+                           size, self.lock, single)
+
+    def standard_gamma(self, shape, size=None, dtype=np.float64):
         """
-        standard_gamma(shape, size=None)
+        standard_gamma(shape, size=None, dtype=np.float64)
 
         Draw samples from a standard Gamma distribution.
 
@@ -2060,6 +2656,12 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        dtype : {float64, float32}, optional
+            Desired dtype of the result, float64 by default. The single
+            precision values are the double precision ones rounded, so the
+            values drawn do not depend on `dtype`.
+
+            .. versionadded:: 1.11.0
 
         Returns
         -------
@@ -2113,21 +2715,32 @@ cdef class RandomState:
         """
         cdef ndarray oshape
         cdef double fshape
+        cdef rk_fill_cont1_strided func
+        cdef rk_fill_cont1 fill
+        cdef bint single = _single_dtype(dtype, 'standard_gamma')
 
+        if self.sampler:
+            func = rk_fill_standard_gamma_zig_strided
+            fill = rk_fill_standard_gamma_zig
+        else:
+            func = rk_fill_standard_gamma_strided
+            fill = rk_fill_standard_gamma
         fshape = PyFloat_AsDouble(shape)
         if not PyErr_Occurred():
             if fshape <= 0:
                 raise ValueError("shape <= 0")
-            return cont1_array_sc(self.internal_state, rk_standard_gamma,
-                                  size, fshape, self.lock)
+            return cont1_array_sc(self.internal_state, fill, size, fshape,
+                                  self.lock, single)
 
         PyErr_Clear()
         oshape = <ndarray> PyArray_FROM_OTF(shape, NPY_DOUBLE,
                                             NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oshape, 0.0)):
             raise ValueError("shape <= 0")
-        return cont1_array(self.internal_state, rk_standard_gamma, size,
-                           oshape, self.lock)
+        out = cont1_array(self.internal_state, func, size, oshape, self.lock)
+        if single:
+            return out.astype(np.float32)
+        return out
 
     def gamma(self, shape, scale=1.0, size=None):
         """
@@ -2210,7 +2823,7 @@ cdef class RandomState:
                 raise ValueError("shape <= 0")
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_gamma, size, fshape,
+            return cont2_array_sc(self.internal_state, rk_fill_gamma, size, fshape,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -2220,8 +2833,8 @@ cdef class RandomState:
             raise ValueError("shape <= 0")
         if np.any(np.less_equal(oscale, 0.0)):
             raise ValueError("scale <= 0")
-        return cont2_array(self.internal_state, rk_gamma, size, oshape, oscale,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_gamma_strided, size,
+                           oshape, oscale, self.lock)
 
     def f(self, dfnum, dfden, size=None):
         """
@@ -2315,7 +2928,7 @@ cdef class RandomState:
                 raise ValueError("shape <= 0")
             if fdfden <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_f, size, fdfnum,
+            return cont2_array_sc(self.internal_state, rk_fill_f, size, fdfnum,
                                   fdfden, self.lock)
 
         PyErr_Clear()
@@ -2326,8 +2939,8 @@ cdef class RandomState:
             raise ValueError("dfnum <= 0")
         if np.any(np.less_equal(odfden, 0.0)):
             raise ValueError("dfden <= 0")
-        return cont2_array(self.internal_state, rk_f, size, odfnum, odfden,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_f_strided, size,
+                           odfnum, odfden, self.lock)
 
     def noncentral_f(self, dfnum, dfden, nonc, size=None):
         """
@@ -2407,7 +3020,7 @@ cdef class RandomState:
                 raise ValueError("dfden <= 0")
             if fnonc < 0:
                 raise ValueError("nonc < 0")
-            return cont3_array_sc(self.internal_state, rk_noncentral_f, size,
+            return cont3_array_sc(self.internal_state, rk_fill_noncentral_f, size,
                                   fdfnum, fdfden, fnonc, self.lock)
 
         PyErr_Clear()
@@ -2422,8 +3035,8 @@ cdef class RandomState:
             raise ValueError("dfden <= 0")
         if np.any(np.less(ononc, 0.0)):
             raise ValueError("nonc < 0")
-        return cont3_array(self.internal_state, rk_noncentral_f, size, odfnum,
-                           odfden, ononc, self.lock)
+        return cont3_array(self.internal_state, rk_fill_noncentral_f_strided,
+                           size, odfnum, odfden, ononc, self.lock)
 
     def chisquare(self, df, size=None):
         """
@@ -2495,7 +3108,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fdf <= 0:
                 raise ValueError("df <= 0")
-            return cont1_array_sc(self.internal_state, rk_chisquare, size, fdf,
+            return cont1_array_sc(self.internal_state, rk_fill_chisquare, size, fdf,
                                   self.lock)
 
         PyErr_Clear()
@@ -2503,8 +3116,8 @@ cdef class RandomState:
         odf = <ndarray>PyArray_FROM_OTF(df, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(odf, 0.0)):
             raise ValueError("df <= 0")
-        return cont1_array(self.internal_state, rk_chisquare, size, odf,
-                           self.lock)
+        return cont1_array(self.internal_state, rk_fill_chisquare_strided,
+                           size, odf, self.lock)
 
     def noncentral_chisquare(self, df, nonc, size=None):
         """
@@ -2589,7 +3202,7 @@ cdef class RandomState:
                 raise ValueError("df <= 0")
             if fnonc < 0:
                 raise ValueError("nonc < 0")
-            return cont2_array_sc(self.internal_state, rk_noncentral_chisquare,
+            return cont2_array_sc(self.internal_state, rk_fill_noncentral_chisquare,
                                   size, fdf, fnonc, self.lock)
 
         PyErr_Clear()
@@ -2600,8 +3213,9 @@ cdef class RandomState:
             raise ValueError("df <= 0")
         if np.any(np.less(ononc, 0.0)):
             raise ValueError("nonc < 0")
-        return cont2_array(self.internal_state, rk_noncentral_chisquare, size,
-                           odf, ononc, self.lock)
+        return cont2_array(self.internal_state,
+                           rk_fill_noncentral_chisquare_strided, size, odf,
+                           ononc, self.lock)
 
     def standard_cauchy(self, size=None):
         """
@@ -2664,7 +3278,7 @@ cdef class RandomState:
         >>> plt.show()
 
         """
-        return cont0_array(self.internal_state, rk_standard_cauchy, size,
+        return cont0_array(self.internal_state, rk_fill_standard_cauchy, size,
                            self.lock)
 
     def standard_t(self, df, size=None):
@@ -2761,7 +3375,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fdf <= 0:
                 raise ValueError("df <= 0")
-            return cont1_array_sc(self.internal_state, rk_standard_t, size,
+            return cont1_array_sc(self.internal_state, rk_fill_standard_t, size,
                                   fdf, self.lock)
 
         PyErr_Clear()
@@ -2769,8 +3383,8 @@ cdef class RandomState:
         odf = <ndarray> PyArray_FROM_OTF(df, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(odf, 0.0)):
             raise ValueError("df <= 0")
-        return cont1_array(self.internal_state, rk_standard_t, size, odf,
-                           self.lock)
+        return cont1_array(self.internal_state, rk_fill_standard_t_strided,
+                           size, odf, self.lock)
 
     def vonmises(self, mu, kappa, size=None):
         """
@@ -2857,7 +3471,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fkappa < 0:
                 raise ValueError("kappa < 0")
-            return cont2_array_sc(self.internal_state, rk_vonmises, size, fmu,
+            return cont2_array_sc(self.internal_state, rk_fill_vonmises, size, fmu,
                                   fkappa, self.lock)
 
         PyErr_Clear()
@@ -2867,8 +3481,8 @@ cdef class RandomState:
                                             NPY_ARRAY_ALIGNED)
         if np.any(np.less(okappa, 0.0)):
             raise ValueError("kappa < 0")
-        return cont2_array(self.internal_state, rk_vonmises, size, omu, okappa,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_vonmises_strided, size,
+                           omu, okappa, self.lock)
 
     def pareto(self, a, size=None):
         """
@@ -2964,7 +3578,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fa <= 0:
                 raise ValueError("a <= 0")
-            return cont1_array_sc(self.internal_state, rk_pareto, size, fa,
+            return cont1_array_sc(self.internal_state, rk_fill_pareto, size, fa,
                                   self.lock)
 
         PyErr_Clear()
@@ -2972,7 +3586,8 @@ cdef class RandomState:
         oa = <ndarray>PyArray_FROM_OTF(a, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oa, 0.0)):
             raise ValueError("a <= 0")
-        return cont1_array(self.internal_state, rk_pareto, size, oa, self.lock)
+        return cont1_array(self.internal_state, rk_fill_pareto_strided, size,
+                           oa, self.lock)
 
     def weibull(self, a, size=None):
         """
@@ -3072,7 +3687,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fa <= 0:
                 raise ValueError("a <= 0")
-            return cont1_array_sc(self.internal_state, rk_weibull, size, fa,
+            return cont1_array_sc(self.internal_state, rk_fill_weibull, size, fa,
                                   self.lock)
 
         PyErr_Clear()
@@ -3080,8 +3695,8 @@ cdef class RandomState:
         oa = <ndarray>PyArray_FROM_OTF(a, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oa, 0.0)):
             raise ValueError("a <= 0")
-        return cont1_array(self.internal_state, rk_weibull, size, oa,
-                           self.lock)
+        return cont1_array(self.internal_state, rk_fill_weibull_strided, size,
+                           oa, self.lock)
 
     def power(self, a, size=None):
         """
@@ -3184,7 +3799,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fa <= 0:
                 raise ValueError("a <= 0")
-            return cont1_array_sc(self.internal_state, rk_power, size, fa,
+            return cont1_array_sc(self.internal_state, rk_fill_power, size, fa,
                                   self.lock)
 
         PyErr_Clear()
@@ -3192,7 +3807,8 @@ cdef class RandomState:
         oa = <ndarray>PyArray_FROM_OTF(a, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oa, 0.0)):
             raise ValueError("a <= 0")
-        return cont1_array(self.internal_state, rk_power, size, oa, self.lock)
+        return cont1_array(self.internal_state, rk_fill_power_strided, size,
+                           oa, self.lock)
 
     def laplace(self, loc=0.0, scale=1.0, size=None):
         """
@@ -3279,7 +3895,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_laplace, size, floc,
+            return cont2_array_sc(self.internal_state, rk_fill_laplace, size, floc,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -3287,8 +3903,8 @@ cdef class RandomState:
         oscale = PyArray_FROM_OTF(scale, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oscale, 0.0)):
             raise ValueError("scale <= 0")
-        return cont2_array(self.internal_state, rk_laplace, size, oloc, oscale,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_laplace_strided, size,
+                           oloc, oscale, self.lock)
 
     def gumbel(self, loc=0.0, scale=1.0, size=None):
         """
@@ -3408,7 +4024,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_gumbel, size, floc,
+            return cont2_array_sc(self.internal_state, rk_fill_gumbel, size, floc,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -3416,8 +4032,8 @@ cdef class RandomState:
         oscale = PyArray_FROM_OTF(scale, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oscale, 0.0)):
             raise ValueError("scale <= 0")
-        return cont2_array(self.internal_state, rk_gumbel, size, oloc, oscale,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_gumbel_strided, size,
+                           oloc, oscale, self.lock)
 
     def logistic(self, loc=0.0, scale=1.0, size=None):
         """
@@ -3499,7 +4115,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_logistic, size, floc,
+            return cont2_array_sc(self.internal_state, rk_fill_logistic, size, floc,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -3507,8 +4123,8 @@ cdef class RandomState:
         oscale = PyArray_FROM_OTF(scale, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oscale, 0.0)):
             raise ValueError("scale <= 0")
-        return cont2_array(self.internal_state, rk_logistic, size, oloc,
-                           oscale, self.lock)
+        return cont2_array(self.internal_state, rk_fill_logistic_strided, size,
+                           oloc, oscale, self.lock)
 
     def lognormal(self, mean=0.0, sigma=1.0, size=None):
         """
@@ -3623,7 +4239,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fsigma <= 0:
                 raise ValueError("sigma <= 0")
-            return cont2_array_sc(self.internal_state, rk_lognormal, size,
+            return cont2_array_sc(self.internal_state, rk_fill_lognormal, size,
                                   fmean, fsigma, self.lock)
 
         PyErr_Clear()
@@ -3632,8 +4248,8 @@ cdef class RandomState:
         osigma = PyArray_FROM_OTF(sigma, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(osigma, 0.0)):
             raise ValueError("sigma <= 0.0")
-        return cont2_array(self.internal_state, rk_lognormal, size, omean,
-                           osigma, self.lock)
+        return cont2_array(self.internal_state, rk_fill_lognormal_strided,
+                           size, omean, osigma, self.lock)
 
     def rayleigh(self, scale=1.0, size=None):
         """
@@ -3699,7 +4315,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont1_array_sc(self.internal_state, rk_rayleigh, size,
+            return cont1_array_sc(self.internal_state, rk_fill_rayleigh, size,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -3707,8 +4323,8 @@ cdef class RandomState:
         oscale = <ndarray>PyArray_FROM_OTF(scale, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         if np.any(np.less_equal(oscale, 0.0)):
             raise ValueError("scale <= 0.0")
-        return cont1_array(self.internal_state, rk_rayleigh, size, oscale,
-                           self.lock)
+        return cont1_array(self.internal_state, rk_fill_rayleigh_strided, size,
+                           oscale, self.lock)
 
     def wald(self, mean, scale, size=None):
         """
@@ -3782,7 +4398,7 @@ cdef class RandomState:
                 raise ValueError("mean <= 0")
             if fscale <= 0:
                 raise ValueError("scale <= 0")
-            return cont2_array_sc(self.internal_state, rk_wald, size, fmean,
+            return cont2_array_sc(self.internal_state, rk_fill_wald, size, fmean,
                                   fscale, self.lock)
 
         PyErr_Clear()
@@ -3792,8 +4408,8 @@ cdef class RandomState:
             raise ValueError("mean <= 0.0")
         elif np.any(np.less_equal(oscale,0.0)):
             raise ValueError("scale <= 0.0")
-        return cont2_array(self.internal_state, rk_wald, size, omean, oscale,
-                           self.lock)
+        return cont2_array(self.internal_state, rk_fill_wald_strided, size,
+                           omean, oscale, self.lock)
 
     def triangular(self, left, mode, right, size=None):
         """
@@ -3868,7 +4484,7 @@ cdef class RandomState:
                 raise ValueError("mode > right")
             if fleft == fright:
                 raise ValueError("left == right")
-            return cont3_array_sc(self.internal_state, rk_triangular, size,
+            return cont3_array_sc(self.internal_state, rk_fill_triangular, size,
                                   fleft, fmode, fright, self.lock)
 
         PyErr_Clear()
@@ -3882,8 +4498,8 @@ cdef class RandomState:
             raise ValueError("mode > right")
         if np.any(np.equal(oleft, oright)):
             raise ValueError("left == right")
-        return cont3_array(self.internal_state, rk_triangular, size, oleft,
-                           omode, oright, self.lock)
+        return cont3_array(self.internal_state, rk_fill_triangular_strided,
+                           size, oleft, omode, oright, self.lock)
 
     # Complicated, discrete distributions:
     def binomial(self, n, p, size=None):
@@ -3983,7 +4599,7 @@ cdef class RandomState:
                 raise ValueError("p > 1")
             elif np.isnan(fp):
                 raise ValueError("p is nan")
-            return discnp_array_sc(self.internal_state, rk_binomial, size, ln,
+            return discnp_array_sc(self.internal_state, rk_fill_binomial, size, ln,
                                    fp, self.lock)
 
         PyErr_Clear()
@@ -4079,7 +4695,7 @@ cdef class RandomState:
                 raise ValueError("p < 0")
             elif fp > 1:
                 raise ValueError("p > 1")
-            return discdd_array_sc(self.internal_state, rk_negative_binomial,
+            return discdd_array_sc(self.internal_state, rk_fill_negative_binomial,
                                    size, fn, fp, self.lock)
 
         PyErr_Clear()
@@ -4168,7 +4784,7 @@ cdef class RandomState:
                 raise ValueError("lam < 0")
             if lam > self.poisson_lam_max:
                 raise ValueError("lam value too large")
-            return discd_array_sc(self.internal_state, rk_poisson, size, flam,
+            return discd_array_sc(self.internal_state, rk_fill_poisson, size, flam,
                                   self.lock)
 
         PyErr_Clear()
@@ -4259,7 +4875,7 @@ cdef class RandomState:
         if not PyErr_Occurred():
             if fa <= 1.0:
                 raise ValueError("a <= 1.0")
-            return discd_array_sc(self.internal_state, rk_zipf, size, fa,
+            return discd_array_sc(self.internal_state, rk_fill_zipf, size, fa,
                                   self.lock)
 
         PyErr_Clear()
@@ -4324,7 +4940,7 @@ cdef class RandomState:
                 raise ValueError("p < 0.0")
             if fp > 1.0:
                 raise ValueError("p > 1.0")
-            return discd_array_sc(self.internal_state, rk_geometric, size, fp,
+            return discd_array_sc(self.internal_state, rk_fill_geometric, size, fp,
                                   self.lock)
 
         PyErr_Clear()
@@ -4439,7 +5055,7 @@ cdef class RandomState:
                 raise ValueError("nsample < 1")
             if lngood + lnbad < lnsample:
                 raise ValueError("ngood + nbad < nsample")
-            return discnmN_array_sc(self.internal_state, rk_hypergeometric,
+            return discnmN_array_sc(self.internal_state, rk_fill_hypergeometric,
                                     size, lngood, lnbad, lnsample, self.lock)
 
         PyErr_Clear()
@@ -4543,7 +5159,7 @@ cdef class RandomState:
                 raise ValueError("p <= 0.0")
             if fp >= 1.0:
                 raise ValueError("p >= 1.0")
-            return discd_array_sc(self.internal_state, rk_logseries, size, fp,
+            return discd_array_sc(self.internal_state, rk_fill_logseries, size, fp,
                                   self.lock)
 
         PyErr_Clear()
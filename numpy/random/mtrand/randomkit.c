@@ -67,6 +67,7 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <limits.h>
 #include <math.h>
@@ -154,6 +155,8 @@ rk_seed(unsigned long seed, rk_state *state)
     state->gauss = 0;
     state->has_gauss = 0;
     state->has_binomial = 0;
+    state->brng = RK_MT19937;
+    state->has_uint32 = 0;
 }
 
 /* Thomas Wang 32 bits integer hash function */
@@ -186,6 +189,8 @@ rk_randomseed(rk_state *state)
         state->gauss = 0;
         state->has_gauss = 0;
         state->has_binomial = 0;
+        state->brng = RK_MT19937;
+        state->has_uint32 = 0;
 
         for (i = 0; i < 624; i++) {
             state->key[i] &= 0xffffffffUL;
@@ -217,8 +222,8 @@ rk_randomseed(rk_state *state)
  * Note that regardless of the precision of long, only 32 bit random
  * integers are produced
  */
-unsigned long
-rk_random(rk_state *state)
+static NPY_INLINE unsigned long
+rk_mt19937(rk_state *state)
 {
     unsigned long y;
 
@@ -250,14 +255,491 @@ rk_random(rk_state *state)
 }
 
 
+/*
+ * Jump ahead of the Mersenne Twister of Haramoto et al., "Efficient Jump
+ * Ahead for F2-Linear Random Number Generators", INFORMS Journal on
+ * Computing 20(3), 2008.  Advancing the state by J steps is multiplying it
+ * by the J-th power of the transition matrix F, which equals q(F) for the
+ * polynomial q(x) = x^J modulo the characteristic polynomial of F.  q(F)
+ * is applied to the state with Horner's rule, stepping a second state
+ * that is kept as a circular window of the key array starting at `ptr`.
+ * The array of the current generation starts the window, so pos carries
+ * over and the outputs continue J outputs later.
+ */
+#include "mt19937_jump.h"
+
+static NPY_INLINE int
+rk_mt19937_window_next(unsigned long *key, int ptr)
+{
+    const int next = ptr + 1 < N ? ptr + 1 : 0;
+    unsigned long y;
+
+    y = (key[ptr] & UPPER_MASK) | (key[next] & LOWER_MASK);
+    key[ptr] = key[ptr < N - M ? ptr + M : ptr + M - N] ^ (y >> 1) ^
+               (-(y & 1) & MATRIX_A);
+    return next;
+}
+
+static void
+rk_mt19937_jump(rk_state *state, const npy_uint32 *poly)
+{
+    unsigned long acc[N];
+    int i, j, ptr = 0;
+
+    memset(acc, 0, sizeof(acc));
+    for (i = 32*N - 1; i >= 0; i--) {
+        ptr = rk_mt19937_window_next(acc, ptr);
+        if ((poly[i / 32] >> (i % 32)) & 1) {
+            for (j = 0; j < N - ptr; j++) {
+                acc[ptr + j] ^= state->key[j];
+            }
+            for (; j < N; j++) {
+                acc[ptr + j - N] ^= state->key[j];
+            }
+        }
+    }
+    for (j = 0; j < N - ptr; j++) {
+        state->key[j] = acc[ptr + j];
+    }
+    for (; j < N; j++) {
+        state->key[j] = acc[ptr + j - N];
+    }
+}
+
+
+/*
+ * PCG XSL-RR 128/64 of Melissa O'Neill, see http://www.pcg-random.org: a
+ * 128 bit LCG whose output is the xor of the two halves of the state,
+ * rotated by its top 6 bits.  Compilers without a 128 bit integer type
+ * get the multiplication from 64 bit pieces.
+ */
+#define PCG_MULT_HIGH 2549297995355413924ULL
+#define PCG_MULT_LOW 4865540595714422341ULL
+
+static NPY_INLINE void
+rk_umul128(npy_uint64 a, npy_uint64 b, npy_uint64 *high, npy_uint64 *low)
+{
+    const npy_uint64 a_lo = a & 0xffffffffULL, a_hi = a >> 32;
+    const npy_uint64 b_lo = b & 0xffffffffULL, b_hi = b >> 32;
+    const npy_uint64 p0 = a_lo*b_lo, p1 = a_lo*b_hi, p2 = a_hi*b_lo;
+    const npy_uint64 mid = (p0 >> 32) + (p1 & 0xffffffffULL) +
+                           (p2 & 0xffffffffULL);
+
+    *low = (p0 & 0xffffffffULL) | (mid << 32);
+    *high = a_hi*b_hi + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+}
+
+/* a*b + c modulo 2^128, each in two 64 bit halves */
+static NPY_INLINE void
+rk_muladd128(npy_uint64 a_high, npy_uint64 a_low,
+             npy_uint64 b_high, npy_uint64 b_low,
+             npy_uint64 c_high, npy_uint64 c_low,
+             npy_uint64 *high, npy_uint64 *low)
+{
+    npy_uint64 h, l;
+
+    rk_umul128(a_low, b_low, &h, &l);
+    h += a_high*b_low + a_low*b_high;
+    l += c_low;
+    *high = h + c_high + (l < c_low);
+    *low = l;
+}
+
+static NPY_INLINE void
+rk_pcg64_step(rk_pcg64_state *pcg)
+{
+#ifdef __SIZEOF_INT128__
+    const __uint128_t mult = ((__uint128_t)PCG_MULT_HIGH << 64) | PCG_MULT_LOW;
+    __uint128_t state = ((__uint128_t)pcg->state_high << 64) | pcg->state_low;
+
+    state = state*mult + (((__uint128_t)pcg->inc_high << 64) | pcg->inc_low);
+    pcg->state_high = (npy_uint64)(state >> 64);
+    pcg->state_low = (npy_uint64)state;
+#else
+    rk_muladd128(pcg->state_high, pcg->state_low, PCG_MULT_HIGH, PCG_MULT_LOW,
+                 pcg->inc_high, pcg->inc_low,
+                 &pcg->state_high, &pcg->state_low);
+#endif
+}
+
+/*
+ * Advance the LCG by delta steps in O(log(delta)) steps, see F. Brown,
+ * "Random Number Generation with Arbitrary Stride", Trans. Am. Nucl. Soc.,
+ * 1994.  The multiplier and increment of 2^k steps are squared up while
+ * those of the set bits of delta are accumulated.
+ */
+static void
+rk_pcg64_advance(rk_pcg64_state *pcg, npy_uint64 delta_high,
+                 npy_uint64 delta_low)
+{
+    npy_uint64 acc_mult_high = 0, acc_mult_low = 1;
+    npy_uint64 acc_plus_high = 0, acc_plus_low = 0;
+    npy_uint64 cur_mult_high = PCG_MULT_HIGH, cur_mult_low = PCG_MULT_LOW;
+    npy_uint64 cur_plus_high = pcg->inc_high, cur_plus_low = pcg->inc_low;
+    npy_uint64 mult1_high, mult1_low;
+
+    while (delta_high | delta_low) {
+        if (delta_low & 1) {
+            rk_muladd128(acc_mult_high, acc_mult_low,
+                         cur_mult_high, cur_mult_low, 0, 0,
+                         &acc_mult_high, &acc_mult_low);
+            rk_muladd128(acc_plus_high, acc_plus_low,
+                         cur_mult_high, cur_mult_low,
+                         cur_plus_high, cur_plus_low,
+                         &acc_plus_high, &acc_plus_low);
+        }
+        /* cur_plus = (cur_mult + 1)*cur_plus */
+        mult1_low = cur_mult_low + 1;
+        mult1_high = cur_mult_high + (mult1_low == 0);
+        rk_muladd128(mult1_high, mult1_low, cur_plus_high, cur_plus_low, 0, 0,
+                     &cur_plus_high, &cur_plus_low);
+        rk_muladd128(cur_mult_high, cur_mult_low, cur_mult_high, cur_mult_low,
+                     0, 0, &cur_mult_high, &cur_mult_low);
+        delta_low = (delta_low >> 1) | (delta_high << 63);
+        delta_high >>= 1;
+    }
+    rk_muladd128(acc_mult_high, acc_mult_low,
+                 pcg->state_high, pcg->state_low,
+                 acc_plus_high, acc_plus_low,
+                 &pcg->state_high, &pcg->state_low);
+}
+
+static NPY_INLINE npy_uint64
+rk_pcg64_next(rk_pcg64_state *pcg)
+{
+    npy_uint64 x;
+    int rot;
+
+    rk_pcg64_step(pcg);
+    x = pcg->state_high ^ pcg->state_low;
+    rot = (int)(pcg->state_high >> 58);
+    return (x >> rot) | (x << ((-rot) & 63));
+}
+
+/* pcg_setseq_128_srandom_r of the reference implementation */
+static void
+rk_pcg64_seed(rk_pcg64_state *pcg, npy_uint64 state_high,
+              npy_uint64 state_low, npy_uint64 seq_high, npy_uint64 seq_low)
+{
+    pcg->state_high = 0;
+    pcg->state_low = 0;
+    pcg->inc_high = (seq_high << 1) | (seq_low >> 63);
+    pcg->inc_low = (seq_low << 1) | 1;
+    rk_pcg64_step(pcg);
+    pcg->state_low += state_low;
+    pcg->state_high += state_high + (pcg->state_low < state_low);
+    rk_pcg64_step(pcg);
+}
+
+
+/*
+ * xoroshiro128+ of David Blackman and Sebastiano Vigna, see
+ * http://xoroshiro.di.unimi.it.  The all zero state is a fixed point.
+ */
+static NPY_INLINE npy_uint64
+rk_rotl64(npy_uint64 x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static NPY_INLINE npy_uint64
+rk_xoroshiro_next(rk_xoroshiro_state *x)
+{
+    const npy_uint64 s0 = x->s[0];
+    npy_uint64 s1 = x->s[1];
+    const npy_uint64 result = s0 + s1;
+
+    s1 ^= s0;
+    x->s[0] = rk_rotl64(s0, 24) ^ s1 ^ (s1 << 16);
+    x->s[1] = rk_rotl64(s1, 37);
+    return result;
+}
+
+/*
+ * Advance by 2^64 steps.  The constants are the coefficients of x^(2^64)
+ * modulo the characteristic polynomial of the generator, applied as for
+ * the Mersenne Twister.
+ */
+static void
+rk_xoroshiro_jump(rk_xoroshiro_state *x)
+{
+    static const npy_uint64 jump[2] = {0xdf900294d8f554a5ULL,
+                                       0x170865df4b3201fcULL};
+    npy_uint64 s0 = 0, s1 = 0;
+    int i, b;
+
+    for (i = 0; i < 2; i++) {
+        for (b = 0; b < 64; b++) {
+            if ((jump[i] >> b) & 1) {
+                s0 ^= x->s[0];
+                s1 ^= x->s[1];
+            }
+            rk_xoroshiro_next(x);
+        }
+    }
+    x->s[0] = s0;
+    x->s[1] = s1;
+}
+
+
+/*
+ * Philox4x32-10 of Salmon et al., "Parallel Random Numbers: As Easy as 1,
+ * 2, 3", SC11.  The 128 bit counter is encrypted with a 64 bit key in 10
+ * rounds, each block gives two 64 bit outputs.
+ */
+#define PHILOX_M0 0xD2511F53UL
+#define PHILOX_M1 0xCD9E8D57UL
+#define PHILOX_W0 0x9E3779B9UL
+#define PHILOX_W1 0xBB67AE85UL
+
+static void
+rk_philox_block(rk_philox_state *ph)
+{
+    npy_uint32 c0 = (npy_uint32)ph->counter[0];
+    npy_uint32 c1 = (npy_uint32)(ph->counter[0] >> 32);
+    npy_uint32 c2 = (npy_uint32)ph->counter[1];
+    npy_uint32 c3 = (npy_uint32)(ph->counter[1] >> 32);
+    npy_uint32 k0 = ph->key[0], k1 = ph->key[1];
+    npy_uint64 p0, p1;
+    int round;
+
+    for (round = 0; round < 10; round++) {
+        if (round > 0) {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        p0 = (npy_uint64)PHILOX_M0 * c0;
+        p1 = (npy_uint64)PHILOX_M1 * c2;
+        c0 = (npy_uint32)(p1 >> 32) ^ c1 ^ k0;
+        c2 = (npy_uint32)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (npy_uint32)p1;
+        c3 = (npy_uint32)p0;
+    }
+    ph->buffer[0] = c0 | ((npy_uint64)c1 << 32);
+    ph->buffer[1] = c2 | ((npy_uint64)c3 << 32);
+    ph->buffer_pos = 0;
+    if (++ph->counter[0] == 0) {
+        ph->counter[1]++;
+    }
+}
+
+static NPY_INLINE npy_uint64
+rk_philox_next(rk_philox_state *ph)
+{
+    if (ph->buffer_pos >= 2) {
+        rk_philox_block(ph);
+    }
+    return ph->buffer[ph->buffer_pos++];
+}
+
+/*
+ * Advance by 2^64 blocks, 2^65 outputs, by incrementing the upper half of
+ * the counter.  A partly used block is recomputed for the new counter.
+ */
+static void
+rk_philox_jump(rk_philox_state *ph)
+{
+    int pos = ph->buffer_pos;
+
+    ph->counter[1]++;
+    if (pos < 2) {
+        if (ph->counter[0]-- == 0) {
+            ph->counter[1]--;
+        }
+        rk_philox_block(ph);
+        ph->buffer_pos = pos;
+    }
+}
+
+
+/*
+ * Returns the next 64 bits of a bit generator other than the Mersenne
+ * Twister.
+ */
+static NPY_INLINE npy_uint64
+rk_brng_next64(rk_state *state)
+{
+    switch (state->brng) {
+        case RK_PCG64:
+            return rk_pcg64_next(&state->brng_state.pcg64);
+        case RK_XOROSHIRO128PLUS:
+            return rk_xoroshiro_next(&state->brng_state.xoroshiro);
+        default:
+            return rk_philox_next(&state->brng_state.philox);
+    }
+}
+
+/* The 64 bit outputs are split in two, the lower half first. */
+static NPY_INLINE npy_uint32
+rk_brng_next32(rk_state *state)
+{
+    npy_uint64 next;
+
+    if (state->has_uint32) {
+        state->has_uint32 = 0;
+        return state->uinteger;
+    }
+    next = rk_brng_next64(state);
+    state->has_uint32 = 1;
+    state->uinteger = (npy_uint32)(next >> 32);
+    return (npy_uint32)next;
+}
+
+void
+rk_set_brng(rk_brng brng, rk_state *state)
+{
+    npy_uint64 seed[4];
+    int i;
+
+    if (brng != RK_MT19937) {
+        for (i = 0; i < 4; i++) {
+            seed[i] = (npy_uint64)rk_mt19937(state) << 32;
+            seed[i] |= rk_mt19937(state);
+        }
+    }
+    switch (brng) {
+        case RK_PCG64:
+            rk_pcg64_seed(&state->brng_state.pcg64,
+                          seed[0], seed[1], seed[2], seed[3]);
+            break;
+        case RK_XOROSHIRO128PLUS:
+            state->brng_state.xoroshiro.s[0] = seed[0];
+            state->brng_state.xoroshiro.s[1] = seed[1];
+            if ((seed[0] | seed[1]) == 0) {
+                state->brng_state.xoroshiro.s[0] = 1;
+            }
+            break;
+        case RK_PHILOX4X32:
+            state->brng_state.philox.counter[0] = 0;
+            state->brng_state.philox.counter[1] = 0;
+            state->brng_state.philox.key[0] = (npy_uint32)seed[0];
+            state->brng_state.philox.key[1] = (npy_uint32)(seed[0] >> 32);
+            state->brng_state.philox.buffer[0] = 0;
+            state->brng_state.philox.buffer[1] = 0;
+            state->brng_state.philox.buffer_pos = 2;
+            break;
+        default:
+            break;
+    }
+    state->brng = brng;
+    state->has_uint32 = 0;
+    state->uinteger = 0;
+    state->gauss = 0;
+    state->has_gauss = 0;
+    state->has_binomial = 0;
+}
+
+void
+rk_get_brng_state(npy_uint64 *words, rk_state *state)
+{
+    memset(words, 0, RK_BRNG_WORDS*sizeof(npy_uint64));
+    switch (state->brng) {
+        case RK_PCG64:
+            words[0] = state->brng_state.pcg64.state_high;
+            words[1] = state->brng_state.pcg64.state_low;
+            words[2] = state->brng_state.pcg64.inc_high;
+            words[3] = state->brng_state.pcg64.inc_low;
+            break;
+        case RK_XOROSHIRO128PLUS:
+            words[0] = state->brng_state.xoroshiro.s[0];
+            words[1] = state->brng_state.xoroshiro.s[1];
+            break;
+        case RK_PHILOX4X32:
+            words[0] = state->brng_state.philox.counter[0];
+            words[1] = state->brng_state.philox.counter[1];
+            words[2] = state->brng_state.philox.key[0] |
+                       ((npy_uint64)state->brng_state.philox.key[1] << 32);
+            words[3] = state->brng_state.philox.buffer[0];
+            words[4] = state->brng_state.philox.buffer[1];
+            words[5] = state->brng_state.philox.buffer_pos;
+            break;
+        default:
+            break;
+    }
+    words[6] = state->has_uint32;
+    words[7] = state->uinteger;
+}
+
+void
+rk_set_brng_state(rk_brng brng, const npy_uint64 *words, rk_state *state)
+{
+    switch (brng) {
+        case RK_PCG64:
+            state->brng_state.pcg64.state_high = words[0];
+            state->brng_state.pcg64.state_low = words[1];
+            state->brng_state.pcg64.inc_high = words[2];
+            state->brng_state.pcg64.inc_low = words[3] | 1;
+            break;
+        case RK_XOROSHIRO128PLUS:
+            state->brng_state.xoroshiro.s[0] = words[0];
+            state->brng_state.xoroshiro.s[1] = words[1];
+            break;
+        case RK_PHILOX4X32:
+            state->brng_state.philox.counter[0] = words[0];
+            state->brng_state.philox.counter[1] = words[1];
+            state->brng_state.philox.key[0] = (npy_uint32)words[2];
+            state->brng_state.philox.key[1] = (npy_uint32)(words[2] >> 32);
+            state->brng_state.philox.buffer[0] = words[3];
+            state->brng_state.philox.buffer[1] = words[4];
+            state->brng_state.philox.buffer_pos =
+                words[5] < 2 ? (int)words[5] : 2;
+            break;
+        default:
+            break;
+    }
+    state->brng = brng;
+    state->has_uint32 = words[6] != 0;
+    state->uinteger = (npy_uint32)words[7];
+}
+
+void
+rk_jump(rk_state *state)
+{
+    switch (state->brng) {
+        case RK_MT19937:
+            rk_mt19937_jump(state, rk_mt19937_jump_poly);
+            break;
+        case RK_PCG64:
+            rk_pcg64_advance(&state->brng_state.pcg64, 1, 0);
+            break;
+        case RK_XOROSHIRO128PLUS:
+            rk_xoroshiro_jump(&state->brng_state.xoroshiro);
+            break;
+        case RK_PHILOX4X32:
+            rk_philox_jump(&state->brng_state.philox);
+            break;
+        default:
+            break;
+    }
+    state->has_uint32 = 0;
+    state->gauss = 0;
+    state->has_gauss = 0;
+    state->has_binomial = 0;
+}
+
+unsigned long
+rk_random(rk_state *state)
+{
+    if (state->brng != RK_MT19937) {
+        return rk_brng_next32(state);
+    }
+    return rk_mt19937(state);
+}
+
+
 /*
  * Returns an unsigned 64 bit random integer.
  */
-NPY_INLINE static npy_uint64
+npy_uint64
 rk_uint64(rk_state *state)
 {
-    npy_uint64 upper = (npy_uint64)rk_random(state) << 32;
-    npy_uint64 lower = (npy_uint64)rk_random(state);
+    npy_uint64 upper, lower;
+
+    if (state->brng != RK_MT19937) {
+        return rk_brng_next64(state);
+    }
+    upper = (npy_uint64)rk_random(state) << 32;
+    lower = (npy_uint64)rk_random(state);
     return upper | lower;
 }
 
@@ -474,6 +956,9 @@ rk_ulong(rk_state *state)
 #if ULONG_MAX <= 0xffffffffUL
     return rk_random(state);
 #else
+    if (state->brng != RK_MT19937) {
+        return rk_brng_next64(state);
+    }
     return (rk_random(state) << 32) | (rk_random(state));
 #endif
 }
@@ -514,10 +999,87 @@ double
 rk_double(rk_state *state)
 {
     /* shifts : 67108864 = 0x4000000, 9007199254740992 = 0x20000000000000 */
-    long a = rk_random(state) >> 5, b = rk_random(state) >> 6;
+    long a, b;
+
+    if (state->brng != RK_MT19937) {
+        /* the top 53 bits of a single 64 bit output */
+        return (rk_brng_next64(state) >> 11) / 9007199254740992.0;
+    }
+    a = rk_random(state) >> 5;
+    b = rk_random(state) >> 6;
     return (a * 67108864.0 + b) / 9007199254740992.0;
 }
 
+/*
+ * The fill functions give the same values as cnt calls of the single value
+ * functions, with the choice of the bit generator made once.
+ */
+void
+rk_fill_double(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+    long a, b;
+
+    switch (state->brng) {
+        case RK_MT19937:
+            for (i = 0; i < cnt; i++) {
+                a = rk_mt19937(state) >> 5;
+                b = rk_mt19937(state) >> 6;
+                out[i] = (a * 67108864.0 + b) / 9007199254740992.0;
+            }
+            break;
+        case RK_PCG64:
+            for (i = 0; i < cnt; i++) {
+                out[i] = (rk_pcg64_next(&state->brng_state.pcg64) >> 11) /
+                         9007199254740992.0;
+            }
+            break;
+        case RK_XOROSHIRO128PLUS:
+            for (i = 0; i < cnt; i++) {
+                out[i] = (rk_xoroshiro_next(&state->brng_state.xoroshiro) >>
+                          11) / 9007199254740992.0;
+            }
+            break;
+        default:
+            for (i = 0; i < cnt; i++) {
+                out[i] = (rk_philox_next(&state->brng_state.philox) >> 11) /
+                         9007199254740992.0;
+            }
+            break;
+    }
+}
+
+/*
+ * Rounding to the nearest float would give 1 for the doubles just below it,
+ * so the doubles are truncated to the 24 bits a float holds at the top of
+ * the interval instead.
+ */
+void
+rk_fill_float(npy_intp cnt, float *out, rk_state *state)
+{
+    double buffer[256];
+    npy_intp i, j, n;
+
+    for (i = 0; i < cnt; i += n) {
+        n = (cnt - i < 256) ? cnt - i : 256;
+        rk_fill_double(n, buffer, state);
+        for (j = 0; j < n; j++) {
+            out[i + j] = (float)((long)(buffer[j] * 16777216.0) /
+                                 16777216.0);
+        }
+    }
+}
+
+void
+rk_fill_long(npy_intp cnt, long *out, rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++) {
+        out[i] = rk_long(state);
+    }
+}
+
 void
 rk_fill(void *buffer, size_t size, rk_state *state)
 {
@@ -622,3 +1184,35 @@ rk_gauss(rk_state *state)
         return f*x2;
     }
 }
+
+void
+rk_fill_gauss(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i = 0;
+    double f, x1, x2, r2;
+
+    if (cnt > 0 && state->has_gauss) {
+        out[i++] = state->gauss;
+        state->gauss = 0;
+        state->has_gauss = 0;
+    }
+    while (i < cnt) {
+        do {
+            x1 = 2.0*rk_double(state) - 1.0;
+            x2 = 2.0*rk_double(state) - 1.0;
+            r2 = x1*x1 + x2*x2;
+        }
+        while (r2 >= 1.0 || r2 == 0.0);
+
+        /* both values of each pair, in the order of rk_gauss */
+        f = sqrt(-2.0*log(r2)/r2);
+        out[i++] = f*x2;
+        if (i < cnt) {
+            out[i++] = f*x1;
+        }
+        else {
+            state->gauss = f*x1;
+            state->has_gauss = 1;
+        }
+    }
+}
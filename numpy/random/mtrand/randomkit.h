@@ -65,6 +65,43 @@
 
 #define RK_STATE_LEN 624
 
+/*
+ * The bit generators rk_random can draw from.  The Mersenne Twister is the
+ * default, the others are selected with rk_set_brng.
+ */
+typedef enum {
+    RK_MT19937 = 0, /* Mersenne Twister, 32 bit outputs */
+    RK_PCG64 = 1, /* PCG XSL-RR 128/64, 64 bit outputs */
+    RK_XOROSHIRO128PLUS = 2, /* xoroshiro128+, 64 bit outputs */
+    RK_PHILOX4X32 = 3, /* counter based Philox4x32-10, 4x32 bit outputs */
+    RK_BRNG_MAX = 4
+} rk_brng;
+
+/* number of npy_uint64 words of rk_get_brng_state and rk_set_brng_state */
+#define RK_BRNG_WORDS 8
+
+typedef struct rk_pcg64_state_
+{
+    npy_uint64 state_high, state_low;
+    npy_uint64 inc_high, inc_low;
+}
+rk_pcg64_state;
+
+typedef struct rk_xoroshiro_state_
+{
+    npy_uint64 s[2];
+}
+rk_xoroshiro_state;
+
+typedef struct rk_philox_state_
+{
+    npy_uint64 counter[2];
+    npy_uint32 key[2];
+    npy_uint64 buffer[2];
+    int buffer_pos;
+}
+rk_philox_state;
+
 typedef struct rk_state_
 {
     unsigned long key[RK_STATE_LEN];
@@ -96,6 +133,20 @@ typedef struct rk_state_
     double p3;
     double p4;
 
+    /*
+     * The bit generator.  key and pos above hold the state of the Mersenne
+     * Twister, the other generators keep theirs in brng_state.  Their 64
+     * bit outputs are split in two when 32 bits are asked for, the unused
+     * half is kept in uinteger.
+     */
+    rk_brng brng;
+    int has_uint32;
+    npy_uint32 uinteger;
+    union {
+        rk_pcg64_state pcg64;
+        rk_xoroshiro_state xoroshiro;
+        rk_philox_state philox;
+    } brng_state;
 }
 rk_state;
 
@@ -130,6 +181,32 @@ extern void rk_seed(unsigned long seed, rk_state *state);
  */
 extern rk_error rk_randomseed(rk_state *state);
 
+/*
+ * Switch the RNG state to the bit generator brng.  Generators other than
+ * the Mersenne Twister are seeded from the output of the Mersenne Twister
+ * state, so seeding with rk_seed, rk_randomseed or init_by_array and then
+ * calling rk_set_brng gives the same streams for the same seeds.  Cached
+ * gaussian and binomial values are dropped.
+ */
+extern void rk_set_brng(rk_brng brng, rk_state *state);
+
+/*
+ * Store the state of a bit generator other than the Mersenne Twister in
+ * RK_BRNG_WORDS words, or restore it from them.
+ */
+extern void rk_get_brng_state(npy_uint64 *words, rk_state *state);
+extern void rk_set_brng_state(rk_brng brng, const npy_uint64 *words,
+                              rk_state *state);
+
+/*
+ * Advance the RNG state as if a large number of values had been drawn:
+ * 2^128 32 bit values of the Mersenne Twister, 2^64 64 bit values of
+ * PCG64 and xoroshiro128+, 2^65 of Philox4x32.  States jumped a different
+ * number of times give streams that do not overlap unless that many values
+ * are drawn from them.  Cached values are dropped.
+ */
+extern void rk_jump(rk_state *state);
+
 /*
  * Returns a random unsigned long between 0 and RK_MAX inclusive
  */
@@ -140,6 +217,12 @@ extern unsigned long rk_random(rk_state *state);
  */
 extern long rk_long(rk_state *state);
 
+/*
+ * Returns a random unsigned 64 bit integer, from a single step of the
+ * 64 bit generators.
+ */
+extern npy_uint64 rk_uint64(rk_state *state);
+
 /*
  * Returns a random unsigned long between 0 and ULONG_MAX inclusive
  */
@@ -190,6 +273,19 @@ extern void rk_random_bool(npy_bool off, npy_bool rng, npy_intp cnt,
  */
 extern double rk_double(rk_state *state);
 
+/*
+ * Fill out with cnt random doubles, or longs, the same as cnt calls of
+ * rk_double or rk_long.
+ */
+extern void rk_fill_double(npy_intp cnt, double *out, rk_state *state);
+extern void rk_fill_long(npy_intp cnt, long *out, rk_state *state);
+
+/*
+ * Fill out with cnt random floats in [0, 1), the doubles of rk_fill_double
+ * truncated to 24 bits after the point.
+ */
+extern void rk_fill_float(npy_intp cnt, float *out, rk_state *state);
+
 /*
  * fill the buffer with size random bytes
  */
@@ -219,6 +315,11 @@ extern rk_error rk_altfill(void *buffer, size_t size, int strong,
  */
 extern double rk_gauss(rk_state *state);
 
+/*
+ * Fill out with cnt gaussian deviates, the same as cnt calls of rk_gauss.
+ */
+extern void rk_fill_gauss(npy_intp cnt, double *out, rk_state *state);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,543 @@
+/*
+ * Generated by generate_ziggurat.py, do not edit.
+ *
+ * Ziggurats of 256 layers for the normal and exponential samplers.
+ */
+
+#define RK_ZIG_NORM_R 3.6541528853610092
+
+static const npy_uint64 rk_zig_norm_k[256] = {
+    0x000ef33d8025ef65ULL, 0x0000000000000000ULL, 0x000c08be98fbc783ULL,
+    0x000da354fabd8190ULL, 0x000e51f67ec1ef11ULL, 0x000eb255e9d3f794ULL,
+    0x000eef4b817ecac9ULL, 0x000f19470afa44b6ULL, 0x000f37ed61ffcb1fULL,
+    0x000f4f4695612562ULL, 0x000f61a5e41ba39bULL, 0x000f707a755396a8ULL,
+    0x000f7cb2ec28449fULL, 0x000f86f10c6357d6ULL, 0x000f8fa6578325e1ULL,
+    0x000f9724c74dd0dbULL, 0x000f9da907dbf50aULL, 0x000fa360f581fa74ULL,
+    0x000fa86fde5b4bfaULL, 0x000facf160d354ddULL, 0x000fb0fb6718b90fULL,
+    0x000fb49f8d5374c7ULL, 0x000fb7ec2366fe79ULL, 0x000fbaece9a1e50dULL,
+    0x000fbdab9d040befULL, 0x000fc03060ff6c58ULL, 0x000fc2821037a249ULL,
+    0x000fc4a67ae25bd2ULL, 0x000fc6a2977aee30ULL, 0x000fc87aa92896a5ULL,
+    0x000fca325e4bde85ULL, 0x000fcbcce902231bULL, 0x000fcd4d12f839c5ULL,
+    0x000fceb54d8fec99ULL, 0x000fd007bf1dc931ULL, 0x000fd1464dd6c4e5ULL,
+    0x000fd272a8e2f450ULL, 0x000fd38e4ff0c91fULL, 0x000fd49a9990b479ULL,
+    0x000fd598b8920f53ULL, 0x000fd689c08e99edULL, 0x000fd76ea9c8e831ULL,
+    0x000fd848547b08e8ULL, 0x000fd9178bad2c8cULL, 0x000fd9dd07a7add2ULL,
+    0x000fda9970105e8bULL, 0x000fdb4d5dc02e20ULL, 0x000fdbf95c5bfcd1ULL,
+    0x000fdc9debb99a7dULL, 0x000fdd3b8118729dULL, 0x000fddd288342f8fULL,
+    0x000fde6364369f63ULL, 0x000fdeee708d514eULL, 0x000fdf7401a6b42fULL,
+    0x000fdff46599ed3eULL, 0x000fe06fe4bc24f1ULL, 0x000fe0e6c225a259ULL,
+    0x000fe1593c28b84cULL, 0x000fe1c78cbc3f99ULL, 0x000fe231e9db1ca9ULL,
+    0x000fe29885da1b92ULL, 0x000fe2fb8fb54186ULL, 0x000fe35b33558d4aULL,
+    0x000fe3b799d0002bULL, 0x000fe410e99ead7fULL, 0x000fe46746d47734ULL,
+    0x000fe4bad34c095cULL, 0x000fe50baed29524ULL, 0x000fe559f74ebc77ULL,
+    0x000fe5a5c8e41212ULL, 0x000fe5ef3e13868aULL, 0x000fe6366fd91077ULL,
+    0x000fe67b75c6d578ULL, 0x000fe6be661e11abULL, 0x000fe6ff55e5f4f1ULL,
+    0x000fe73e5900a702ULL, 0x000fe77b823e9e39ULL, 0x000fe7b6e37070a2ULL,
+    0x000fe7f08d774242ULL, 0x000fe8289053f08cULL, 0x000fe85efb35173bULL,
+    0x000fe893dc840864ULL, 0x000fe8c741f0cebcULL, 0x000fe8f9387d4ef6ULL,
+    0x000fe929cc879b1cULL, 0x000fe95909d388ebULL, 0x000fe986fb939aa1ULL,
+    0x000fe9b3ac714865ULL, 0x000fe9df2694b6d5ULL, 0x000fea0973abe67bULL,
+    0x000fea329cf166a4ULL, 0x000fea5aab32952dULL, 0x000fea81a6d57419ULL,
+    0x000feaa797de1cefULL, 0x000feacc85f3d91fULL, 0x000feaf07865e63cULL,
+    0x000feb13762fec12ULL, 0x000feb3585fe2a4aULL, 0x000feb56ae3162b5ULL,
+    0x000feb76f4e284f9ULL, 0x000feb965fe62013ULL, 0x000febb4f4cf9d7cULL,
+    0x000febd2b8f449cfULL, 0x000febefb16e2e3eULL, 0x000fec0be31ebde8ULL,
+    0x000fec2752b15a14ULL, 0x000fec42049dafd3ULL, 0x000fec5bfd29f196ULL,
+    0x000fec75406ceef4ULL, 0x000fec8dd2500cb4ULL, 0x000feca5b6911f11ULL,
+    0x000fecbcf0c427feULL, 0x000fecd38454fb16ULL, 0x000fece97488c8b3ULL,
+    0x000fecfec47f91b7ULL, 0x000fed1377358528ULL, 0x000fed278f844903ULL,
+    0x000fed3b10242f4cULL, 0x000fed4dfbad586eULL, 0x000fed605498c3ddULL,
+    0x000fed721d414fe7ULL, 0x000fed8357e4a982ULL, 0x000fed9406a42cc9ULL,
+    0x000feda42b85b705ULL, 0x000fedb3c8746ab3ULL, 0x000fedc2df416652ULL,
+    0x000fedd171a46e52ULL, 0x000feddf813c8ad3ULL, 0x000feded0f90997fULL,
+    0x000fedfa1e0fd414ULL, 0x000fee06ae124bc5ULL, 0x000fee12c0d95a06ULL,
+    0x000fee1e579006dfULL, 0x000fee29734b6524ULL, 0x000fee34150ae4bcULL,
+    0x000fee3e3db89b3dULL, 0x000fee47ee2982f3ULL, 0x000fee51271db086ULL,
+    0x000fee59e9407f41ULL, 0x000fee623528b42dULL, 0x000fee6a0b5897f0ULL,
+    0x000fee716c3e077aULL, 0x000fee7858327b81ULL, 0x000fee7ecf7b06b9ULL,
+    0x000fee84d2484ab3ULL, 0x000fee8a60b66343ULL, 0x000fee8f7accc851ULL,
+    0x000fee94207e25daULL, 0x000fee9851a829ebULL, 0x000fee9c0e13485bULL,
+    0x000fee9f557273f3ULL, 0x000feea22762ccaeULL, 0x000feea4836b42abULL,
+    0x000feea668fc2d71ULL, 0x000feea7d76ed6f9ULL, 0x000feea8ce04fa0aULL,
+    0x000feea94be8333cULL, 0x000feea95029640fULL, 0x000feea8d9c0075eULL,
+    0x000feea7e7897653ULL, 0x000feea678481d24ULL, 0x000feea48aa29e82ULL,
+    0x000feea21d22e4d9ULL, 0x000fee9f2e352025ULL, 0x000fee9bbc26af2eULL,
+    0x000fee97c524f2e3ULL, 0x000fee93473c0a39ULL, 0x000fee8e40557515ULL,
+    0x000fee88ae369c79ULL, 0x000fee828e7f3dfdULL, 0x000fee7bdea7b888ULL,
+    0x000fee749bff37ffULL, 0x000fee6cc3a9bd5eULL, 0x000fee64529e007eULL,
+    0x000fee5b45a32889ULL, 0x000fee51994e57b6ULL, 0x000fee474a0006cfULL,
+    0x000fee3c53e12c4fULL, 0x000fee30b2e02ad7ULL, 0x000fee2462ad8205ULL,
+    0x000fee175eb83c5aULL, 0x000fee09a22a1447ULL, 0x000fedfb27e349ccULL,
+    0x000fedebea76216cULL, 0x000feddbe422047eULL, 0x000fedcb0ece39d3ULL,
+    0x000fedb964042cf4ULL, 0x000feda6dce938c9ULL, 0x000fed937237e98dULL,
+    0x000fed7f1c38a836ULL, 0x000fed69d2b9c02bULL, 0x000fed538d06adffULL,
+    0x000fed3c41dea422ULL, 0x000fed23e76a2fd7ULL, 0x000fed0a732fe643ULL,
+    0x000fecefda07fe34ULL, 0x000fecd4100eb7b8ULL, 0x000fecb708956eb4ULL,
+    0x000fec98b61230c1ULL, 0x000fec790a0da978ULL, 0x000fec57f50f31feULL,
+    0x000fec356686c961ULL, 0x000fec114cb4b335ULL, 0x000febeb948e6fd0ULL,
+    0x000febc429a0b691ULL, 0x000feb9af5ee0cdcULL, 0x000feb6fe1c98542ULL,
+    0x000feb42d3ad1f9eULL, 0x000feb13b00b2d4bULL, 0x000feae2591a02e9ULL,
+    0x000feaaeae992257ULL, 0x000fea788d8ee326ULL, 0x000fea3fcffd73e5ULL,
+    0x000fea044c8dd9f6ULL, 0x000fe9c5d62f563aULL, 0x000fe9843ba947a3ULL,
+    0x000fe93f471d4729ULL, 0x000fe8f6bd76c5d6ULL, 0x000fe8aa5dc4e8e6ULL,
+    0x000fe859e07ab1eaULL, 0x000fe804f690a940ULL, 0x000fe7ab488233bfULL,
+    0x000fe74c751f6aa5ULL, 0x000fe6e8102aa201ULL, 0x000fe67da0b6abd8ULL,
+    0x000fe60c9f38307eULL, 0x000fe5947338f742ULL, 0x000fe51470977280ULL,
+    0x000fe48bd436f458ULL, 0x000fe3f9bffd1e37ULL, 0x000fe35d35eeb19bULL,
+    0x000fe2b5122fe4fcULL, 0x000fe20003995557ULL, 0x000fe13c82788314ULL,
+    0x000fe068c4ee67afULL, 0x000fdf82b02b71a9ULL, 0x000fde87c57efeaaULL,
+    0x000fdd7509c63bfdULL, 0x000fdc46e529bf13ULL, 0x000fdaf8f82e0282ULL,
+    0x000fd985e1b2ba75ULL, 0x000fd7e6ef48cf04ULL, 0x000fd613adbd650bULL,
+    0x000fd40149e2f012ULL, 0x000fd1a1a7b4c7acULL, 0x000fcee204761f9eULL,
+    0x000fcba8d85e11b1ULL, 0x000fc7d26ecd2d22ULL, 0x000fc32b2f1e22edULL,
+    0x000fbd6581c0b83aULL, 0x000fb606c4005433ULL, 0x000fac40582a2873ULL,
+    0x000f9e971e014597ULL, 0x000f89fa48a41dfcULL, 0x000f66c5f7f0302cULL,
+    0x000f1a5a4b331c4aULL
+};
+
+static const double rk_zig_norm_w[256] = {
+    8.683627060801317e-16, 4.7793301757283223e-17, 6.3543524174056296e-17,
+    7.4548704812479761e-17, 8.3293668157933327e-17, 9.0680604050596857e-17,
+    9.7148600765679418e-17, 1.0294750314241179e-16, 1.0823430288447832e-16,
+    1.1311470196109169e-16, 1.1766359457023049e-16, 1.2193617278714484e-16,
+    1.2597439914637204e-16, 1.2981099886264135e-16, 1.3347203736824219e-16,
+    1.3697864842571299e-16, 1.4034823001242476e-16, 1.4359529452057037e-16,
+    1.4673208742364508e-16, 1.4976904668391123e-16, 1.5271515003596284e-16,
+    1.5557818169460848e-16, 1.5836494009290964e-16, 1.6108140175275009e-16,
+    1.637328520396993e-16, 1.6632399058420909e-16, 1.6885901708676668e-16,
+    1.7134170176559727e-16, 1.7377544365864928e-16, 1.7616331923001065e-16,
+    1.7850812316976796e-16, 1.8081240285799216e-16, 1.8307848764826812e-16,
+    1.8530851388618081e-16, 1.8750444639373941e-16, 1.8966809700774819e-16,
+    1.9180114064838679e-16, 1.939051293062516e-16, 1.9598150426628879e-16,
+    1.9803160683128228e-16, 2.0005668776273379e-16, 2.0205791562071703e-16,
+    2.0403638415480261e-16, 2.0599311887403756e-16, 2.0792908290414067e-16,
+    2.0984518222370401e-16, 2.1174227035760391e-16, 2.1362115259449915e-16,
+    2.1548258978581505e-16, 2.1732730177564414e-16, 2.191559705042732e-16,
+    2.2096924282235367e-16, 2.2276773304789603e-16, 2.2455202529414405e-16,
+    2.2632267559285733e-16, 2.280802138345023e-16, 2.2982514554424738e-16,
+    2.3155795351040853e-16, 2.3327909928004405e-16, 2.3498902453471004e-16,
+    2.3668815235791648e-16, 2.3837688840454288e-16, 2.4005562198135107e-16,
+    2.417247270467507e-16, 2.4338456313711073e-16, 2.4503547622614998e-16,
+    2.4667779952327094e-16, 2.4831185421610916e-16, 2.4993795016204569e-16,
+    2.5155638653296618e-16, 2.5316745241713617e-16, 2.5477142738169481e-16,
+    2.5636858199894003e-16, 2.5795917833928702e-16, 2.5954347043351737e-16,
+    2.6112170470670223e-16, 2.6269412038597286e-16, 2.6426094988411925e-16,
+    2.6582241916083103e-16, 2.6737874806323667e-16, 2.6893015064726189e-16,
+    2.7047683548119981e-16, 2.720190059327735e-16, 2.735568604408682e-16,
+    2.7509059277301701e-16, 2.7662039226963933e-16, 2.7814644407595471e-16,
+    2.796689293624233e-16, 2.8118802553450237e-16, 2.8270390643244822e-16,
+    2.842167425218409e-16, 2.857267010754604e-16, 2.8723394634709824e-16,
+    2.8873863973784844e-16, 2.9024093995538448e-16, 2.917410031666948e-16,
+    2.9323898314471846e-16, 2.9473503140929379e-16, 2.9622929736280689e-16,
+    2.9772192842090319e-16, 2.992130701386016e-16, 3.007028663321334e-16,
+    3.021914591968065e-16, 3.0367898942118048e-16, 3.0516559629782222e-16,
+    3.066514178308958e-16, 3.0813659084083006e-16, 3.0962125106629265e-16,
+    3.1110553326368969e-16, 3.1258957130440029e-16, 3.1407349826994501e-16,
+    3.1555744654528046e-16, 3.170415479104032e-16, 3.1852593363044099e-16,
+    3.2001073454440148e-16, 3.2149608115274505e-16, 3.229821037039419e-16,
+    3.2446893228017012e-16, 3.2595669688230818e-16, 3.2744552751437102e-16,
+    3.2893555426753736e-16, 3.3042690740391323e-16, 3.3191971744017558e-16,
+    3.3341411523123754e-16, 3.3491023205407819e-16, 3.364081996918768e-16,
+    3.3790815051859528e-16, 3.3941021758414921e-16, 3.409145347003129e-16,
+    3.4242123652750211e-16, 3.4393045866258338e-16, 3.4544233772785865e-16,
+    3.4695701146137865e-16, 3.4847461880874167e-16, 3.499953000165384e-16,
+    3.5151919672760769e-16, 3.5304645207827426e-16, 3.5457721079774382e-16,
+    3.5611161930983909e-16, 3.576498258372653e-16, 3.5919198050860329e-16,
+    3.6073823546823548e-16, 3.622887449894195e-16, 3.6384366559073478e-16,
+    3.6540315615613729e-16, 3.6696737805887039e-16, 3.6853649528949165e-16,
+    3.7011067458829008e-16, 3.716900855823825e-16, 3.732749009277946e-16,
+    3.7486529645684912e-16, 3.7646145133120307e-16, 3.7806354820089623e-16,
+    3.7967177336979462e-16, 3.8128631696783794e-16, 3.8290737313052447e-16,
+    3.8453514018609605e-16, 3.8616982085091503e-16, 3.8781162243355877e-16,
+    3.8946075704819272e-16, 3.9111744183782064e-16, 3.927818992080543e-16,
+    3.9445435707208786e-16, 3.9613504910761364e-16, 3.9782421502646836e-16,
+    3.995221008578566e-16, 4.0122895924606306e-16, 4.0294504976363294e-16,
+    4.0467063924107514e-16, 4.0640600211422519e-16, 4.0815142079049397e-16,
+    4.0990718603532674e-16, 4.1167359738030262e-16, 4.1345096355442365e-16,
+    4.1523960294026883e-16, 4.1703984405683159e-16, 4.1885202607101123e-16,
+    4.2067649933990151e-16, 4.2251362598620494e-16, 4.243637805093078e-16,
+    4.2622735043477981e-16, 4.2810473700531167e-16, 4.2999635591638323e-16,
+    4.3190263810026294e-16, 4.3382403056227908e-16, 4.357609972736849e-16,
+    4.3771402012585875e-16, 4.3968359995105214e-16, 4.4167025761542035e-16,
+    4.4367453519065673e-16, 4.4569699721120431e-16, 4.4773823202475339e-16,
+    4.4979885324455497e-16, 4.5187950131300588e-16, 4.539808451870034e-16,
+    4.5610358415674221e-16, 4.5824844981095667e-16, 4.6041620816311528e-16,
+    4.6260766195478457e-16, 4.6482365315432074e-16, 4.6706506567126306e-16,
+    4.6933282830933289e-16, 4.7162791798383513e-16, 4.7395136323258672e-16,
+    4.7630424805331374e-16, 4.7868771610487228e-16, 4.8110297531474172e-16,
+    4.8355130294115252e-16, 4.860340511450812e-16, 4.8855265313536034e-16,
+    4.9110862995952696e-16, 4.9370359802403345e-16, 4.9633927744039873e-16,
+    4.9901750130918225e-16, 5.0174022607180904e-16, 5.0450954308187285e-16,
+    5.0732769157335421e-16, 5.1019707323415618e-16, 5.1312026863067837e-16,
+    5.1610005577432282e-16, 5.1913943117576986e-16, 5.2224163380002343e-16,
+    5.2541017241775973e-16, 5.2864885695049451e-16, 5.3196183453384004e-16,
+    5.3535363118164969e-16, 5.3882920013340532e-16, 5.4239397822017123e-16,
+    5.4605395190747804e-16, 5.4981573508928141e-16, 5.536866612467876e-16,
+    5.5767489329265775e-16, 5.6178955535554176e-16, 5.6604089200824241e-16,
+    5.7044046212913911e-16, 5.7500137689198982e-16, 5.7973859457245966e-16,
+    5.846692893455482e-16, 5.8981331764779024e-16, 5.9519381496414471e-16,
+    6.0083796962719113e-16, 6.0677804093334505e-16, 6.1305272087252826e-16,
+    6.1970898945816265e-16, 6.2680469633012844e-16, 6.344122407127506e-16,
+    6.4262396595480554e-16, 6.5156033173449936e-16, 6.6138278850976642e-16,
+    6.7231504625055866e-16, 6.8468034175642597e-16, 6.9897183363876209e-16,
+    7.1599949348306652e-16, 7.3724243017987989e-16, 7.6589363708055728e-16,
+    8.1138493376564852e-16
+};
+
+static const double rk_zig_norm_f[256] = {
+    1, 0.97710170126766605, 0.95987909180010211,
+    0.94519895344229565, 0.9320600759592268, 0.91999150503934357,
+    0.90872644005212766, 0.89809592189834042, 0.88798466075583049,
+    0.87830965580891462, 0.86900868803685438, 0.86003362119632898,
+    0.85134625845867551, 0.84291565311220185, 0.83471629298688121,
+    0.82672683394621915, 0.81892919160370015, 0.81130787431265405,
+    0.80384948317096216, 0.79654233042295686, 0.78937614356602248,
+    0.7823418326548004, 0.77543130498118518, 0.76863731579848427,
+    0.76195334683679339, 0.75537350650709423, 0.74889244721915504,
+    0.74250529634014928, 0.73620759812686087, 0.72999526456147446,
+    0.72386453346862845, 0.7178119326307203, 0.71183424887824676,
+    0.70592850133275264, 0.70009191813651006, 0.69432191612611516,
+    0.68861608300467025, 0.6829721616449933, 0.67738803621877197,
+    0.67186171989708066, 0.66639134390874877, 0.66097514777666178,
+    0.65561147057969593, 0.65029874311081537, 0.64503548082082096,
+    0.63982027745305525, 0.63465179928762228, 0.62952877992483536,
+    0.62445001554702517, 0.61941436060583299, 0.61442072388891256,
+    0.6094680649257721, 0.60455539069746644, 0.59968175261912393,
+    0.594846243767986, 0.59004799633282445, 0.5852861792633699,
+    0.58055999610078957, 0.57586868297235239, 0.57121150673525189,
+    0.56658776325616311, 0.56199677581452323, 0.55743789361876472,
+    0.55291049042583107, 0.54841396325526459, 0.54394773119002504,
+    0.53951123425695091, 0.5351039323804565, 0.53072530440366095,
+    0.52637484717168337, 0.52205207467232084, 0.51775651722975535,
+    0.51348772074732596, 0.50924524599574705, 0.50502866794346735,
+    0.5008375751261479, 0.49667156905248894, 0.49253026364386776,
+    0.4884132847054572, 0.48432026942668244, 0.48025086590904598,
+    0.47620473271950514, 0.47218153846772942, 0.46818096140569282,
+    0.46420268904817352, 0.46024641781284209, 0.45631185267871566,
+    0.4523987068618478, 0.44850670150720229, 0.44463556539573862,
+    0.44078503466580327, 0.43695485254798488, 0.43314476911265165,
+    0.42935454102944082, 0.4255839313380213, 0.42183270922949528,
+    0.4181006498378475, 0.4143875340408904, 0.41069314827018755,
+    0.40701728432947265, 0.40335973922111379, 0.3997203149801965,
+    0.39609881851583162, 0.39249506145931484, 0.38890886001878799,
+    0.38534003484007651, 0.38178841087339283, 0.3782538172456183,
+    0.37473608713789019, 0.37123505766823856, 0.36775056977903164,
+    0.36428246812900311, 0.3608306009896472, 0.35739482014577972,
+    0.35397498080007594, 0.35057094148140533, 0.34718256395679287,
+    0.34380971314684994, 0.34045225704452103, 0.33711006663700532,
+    0.33378301583071757, 0.33047098137916275, 0.32717384281360057,
+    0.32389148237639043, 0.32062378495690469, 0.31737063802991289,
+    0.31413193159633651, 0.3109075581262859, 0.30769741250429145,
+    0.30450139197664938, 0.30131939610080249, 0.29815132669668498,
+    0.29499708779996126, 0.2918565856170946, 0.28872972848218231,
+    0.2856164268155012, 0.28251659308370708, 0.27943014176163744,
+    0.27635698929566782, 0.27329705406857657, 0.27025025636587496,
+    0.2672165183435608, 0.26419576399726047, 0.26118791913272055,
+    0.25819291133761862, 0.25521066995466141, 0.25224112605594168,
+    0.24928421241852802, 0.24633986350126344, 0.2434080154227499,
+    0.24048860594050009, 0.23758157443123773, 0.23468686187232965,
+    0.23180441082433836, 0.22893416541467998, 0.22607607132237997,
+    0.22323007576391726, 0.22039612748015178, 0.21757417672433102,
+    0.21476417525117344, 0.21196607630703004, 0.20917983462112485,
+    0.20640540639788052, 0.20364274931033471, 0.20089182249465645,
+    0.19815258654577494, 0.19542500351413411, 0.19270903690358893,
+    0.19000465167046479, 0.18731181422380005, 0.1846304924267991,
+    0.18196065559952238, 0.1793022745228475, 0.17665532144373478,
+    0.17401977008183855, 0.17139559563750575, 0.16878277480121129,
+    0.16618128576448191, 0.16359110823236558, 0.16101222343751101,
+    0.15844461415592428, 0.1558882647244792, 0.15334316106026286,
+    0.15080929068184568, 0.14828664273257455, 0.14577520800599403,
+    0.14327497897351346, 0.1407859498144447, 0.13830811644855073,
+    0.13584147657125376, 0.13338602969166916, 0.13094177717364436,
+    0.12850872227999957, 0.12608687022018589, 0.12367622820159657,
+    0.12127680548479031, 0.11888861344291006, 0.11651166562561087,
+    0.11414597782783849, 0.11179156816383809, 0.1094484571468118,
+    0.1071166677746838, 0.10479622562248707, 0.10248715894193525,
+    0.10018949876881002, 0.097903279038862465, 0.095628536713008999,
+    0.093365311912691012, 0.091113648066373759, 0.088873592068275886,
+    0.086645194450558072, 0.084428509570353472, 0.082223595813202904,
+    0.08003051581466307, 0.077849336702096053, 0.075680130358927108,
+    0.073522973713981324, 0.071377949058890403, 0.069245144397006755,
+    0.067124653827788497, 0.065016577971242898, 0.062921024437758141,
+    0.060838108349539878, 0.058767952920933737, 0.056710690106202902,
+    0.054666461324888921, 0.05263541827679219, 0.050617723860947782,
+    0.048613553215868542, 0.046623094901930381, 0.044646552251294463,
+    0.042684144916474424, 0.040736110655940898, 0.038802707404526064,
+    0.036884215688567222, 0.034980941461716021, 0.03309321945857846,
+    0.031221417191920189, 0.029365939758133255, 0.027527235669603013,
+    0.025705804008548817, 0.023902203305795823, 0.022117062707308819,
+    0.020351096230044483, 0.018605121275724622, 0.016880083152543142,
+    0.015177088307935309, 0.013497450601739867, 0.011842757857907879,
+    0.010214971439701459, 0.0086165827693987194, 0.0070508754713732164,
+    0.0055224032992509864, 0.0040379725933630236, 0.0026090727461021593,
+    0.0012602859304985956
+};
+
+#define RK_ZIG_EXP_R 7.69711747013105
+
+static const npy_uint64 rk_zig_exp_k[256] = {
+    0x001c5214272497c7ULL, 0x0000000000000000ULL, 0x00137d5bd79c3243ULL,
+    0x00186ef58e3f3c5bULL, 0x001a9bb7320eb0d6ULL, 0x001bd127f7194492ULL,
+    0x001c951d0f886528ULL, 0x001d1bfe2d5c397cULL, 0x001d7e5bd56b18bcULL,
+    0x001dc934dd172c77ULL, 0x001e0409dfac9dd0ULL, 0x001e337b71d4783cULL,
+    0x001e5a8b177cb7a6ULL, 0x001e7b42096f046eULL, 0x001e970daf08ae42ULL,
+    0x001eaef5b14ef09fULL, 0x001ec3bd07b4655cULL, 0x001ed5f6f08799cfULL,
+    0x001ee614ae6e5689ULL, 0x001ef46eca361cd0ULL, 0x001f014b76ddd4a8ULL,
+    0x001f0ce313a796b9ULL, 0x001f176369f1f77dULL, 0x001f20f20c452571ULL,
+    0x001f29ae1951a876ULL, 0x001f31b18fb95533ULL, 0x001f39125157c107ULL,
+    0x001f3fe2eb6e694eULL, 0x001f463332d788faULL, 0x001f4c10bf1d3a11ULL,
+    0x001f51874c5c3324ULL, 0x001f56a109c3ecc0ULL, 0x001f5b66d9099998ULL,
+    0x001f5fe08210d08dULL, 0x001f6414dd445771ULL, 0x001f6809f685967aULL,
+    0x001f6bc52a2b02e8ULL, 0x001f6f4b3d32e4f5ULL, 0x001f72a07190f13bULL,
+    0x001f75c8974d09d8ULL, 0x001f78c71b045cc1ULL, 0x001f7b9f12413ff7ULL,
+    0x001f7e5346079f8aULL, 0x001f80e63be21138ULL, 0x001f835a3dad9162ULL,
+    0x001f85b16056b915ULL, 0x001f87ed89b24262ULL, 0x001f8a10759374fcULL,
+    0x001f8c1bba3d39adULL, 0x001f8e10cc45d04aULL, 0x001f8ff102013e17ULL,
+    0x001f91bd968358e1ULL, 0x001f9377ac47afd9ULL, 0x001f95204f8b64dcULL,
+    0x001f96b878633893ULL, 0x001f98410c968891ULL, 0x001f99bae146ba82ULL,
+    0x001f9b26bc697f00ULL, 0x001f9c85561b717bULL, 0x001f9dd759cfd804ULL,
+    0x001f9f1d6761a1cfULL, 0x001fa058140936c1ULL, 0x001fa187eb3a333aULL,
+    0x001fa2ad6f6bc4fcULL, 0x001fa3c91ace0684ULL, 0x001fa4db5fee6aa3ULL,
+    0x001fa5e4aa4d097eULL, 0x001fa6e55ee46784ULL, 0x001fa7dddca51ec5ULL,
+    0x001fa8ce7ce6a876ULL, 0x001fa9b793ce5ff0ULL, 0x001faa9970adb85aULL,
+    0x001fab745e588233ULL, 0x001fac48a3740585ULL, 0x001fad1682bf9febULL,
+    0x001fadde3b5782c1ULL, 0x001faea008f21d6eULL, 0x001faf5c2418b07eULL,
+    0x001fb012c25b7a15ULL, 0x001fb0c41681dff5ULL, 0x001fb17050b6f1fcULL,
+    0x001fb2179eb2963bULL, 0x001fb2ba2bdfa84bULL, 0x001fb358217f4e19ULL,
+    0x001fb3f1a6c9be0dULL, 0x001fb486e10cacd7ULL, 0x001fb517f3c793fcULL,
+    0x001fb5a500c5fdaaULL, 0x001fb62e2837fe59ULL, 0x001fb6b388c9010cULL,
+    0x001fb7353fb5079aULL, 0x001fb7b368dc7da9ULL, 0x001fb82e1ed6ba0aULL,
+    0x001fb8a57b0347f6ULL, 0x001fb919959a0f74ULL, 0x001fb98a85ba7204ULL,
+    0x001fb9f861796f26ULL, 0x001fba633deee287ULL, 0x001fbacb2f41ec17ULL,
+    0x001fbb3048b49145ULL, 0x001fbb929caea4e4ULL, 0x001fbbf23cc8029eULL,
+    0x001fbc4f39d22996ULL, 0x001fbca9a3e140d5ULL, 0x001fbd018a548fa0ULL,
+    0x001fbd56fbde729dULL, 0x001fbdaa068bd66cULL, 0x001fbdfab7cb3f42ULL,
+    0x001fbe491c7364dfULL, 0x001fbe9540c96960ULL, 0x001fbedf3086b129ULL,
+    0x001fbf26f6de6175ULL, 0x001fbf6c9e828ae3ULL, 0x001fbfb031a904c4ULL,
+    0x001fbff1ba0ffdb2ULL, 0x001fc03141024589ULL, 0x001fc06ecf5b54b4ULL,
+    0x001fc0aa6d8b1428ULL, 0x001fc0e42399698bULL, 0x001fc11bf9298a65ULL,
+    0x001fc151f57d1943ULL, 0x001fc1861f770f4cULL, 0x001fc1b87d9e74b4ULL,
+    0x001fc1e91620ea43ULL, 0x001fc217eed505dfULL, 0x001fc2450d3c8400ULL,
+    0x001fc27076864fc2ULL, 0x001fc29a2f906310ULL, 0x001fc2c23ce98046ULL,
+    0x001fc2e8a2d2c6b5ULL, 0x001fc30d654122eeULL, 0x001fc33087de9c0fULL,
+    0x001fc3520e0b7ec8ULL, 0x001fc371fadf66f8ULL, 0x001fc390512a2887ULL,
+    0x001fc3ad137497faULL, 0x001fc3c844013349ULL, 0x001fc3e1e4ccab40ULL,
+    0x001fc3f9f78e4da9ULL, 0x001fc4107db85061ULL, 0x001fc4257877fd68ULL,
+    0x001fc438e8b5bfc7ULL, 0x001fc44acf15112bULL, 0x001fc45b2bf447e9ULL,
+    0x001fc469ff6c4505ULL, 0x001fc477495001b2ULL, 0x001fc483092bfbbaULL,
+    0x001fc48d3e457ff7ULL, 0x001fc495e799d21cULL, 0x001fc49d03dd30b1ULL,
+    0x001fc4a29179b434ULL, 0x001fc4a68e8e07fcULL, 0x001fc4a8f8ebfb8dULL,
+    0x001fc4a9ce16ea9fULL, 0x001fc4a90b41fa36ULL, 0x001fc4a6ad4e28a1ULL,
+    0x001fc4a2b0c82e76ULL, 0x001fc49d11e62de3ULL, 0x001fc495cc852df4ULL,
+    0x001fc48cdc265ec1ULL, 0x001fc4823bec237aULL, 0x001fc475e696dee7ULL,
+    0x001fc467d6817e83ULL, 0x001fc458059dc038ULL, 0x001fc4466d702e22ULL,
+    0x001fc433070bcb9aULL, 0x001fc41dcb0d6e0eULL, 0x001fc406b196bbf7ULL,
+    0x001fc3edb248cb62ULL, 0x001fc3d2c43e593eULL, 0x001fc3b5de0591b5ULL,
+    0x001fc396f599614dULL, 0x001fc376005a4594ULL, 0x001fc352f3069372ULL,
+    0x001fc32dc1b2281bULL, 0x001fc3065fbd7888ULL, 0x001fc2dcbfcbf264ULL,
+    0x001fc2b0d3b99fa0ULL, 0x001fc2828c8ffcf0ULL, 0x001fc251da79f164ULL,
+    0x001fc21eacb6d39eULL, 0x001fc1e8f18c6757ULL, 0x001fc1b09637bb3dULL,
+    0x001fc17586dccd0fULL, 0x001fc137ae74d6b8ULL, 0x001fc0f6f6bb2416ULL,
+    0x001fc0b348184da4ULL, 0x001fc06c898baff1ULL, 0x001fc022a092f365ULL,
+    0x001fbfd5710f72baULL, 0x001fbf84dd294890ULL, 0x001fbf30c52fc60dULL,
+    0x001fbed907770cc6ULL, 0x001fbe7d80327ddcULL, 0x001fbe1e094ba615ULL,
+    0x001fbdba7a354408ULL, 0x001fbd52a7b9f826ULL, 0x001fbce663c6201bULL,
+    0x001fbc757d2c4de5ULL, 0x001fbbffbf63b7aaULL, 0x001fbb84f23fe6a2ULL,
+    0x001fbb04d9a0d18eULL, 0x001fba7f351a70adULL, 0x001fb9f3bf92b61aULL,
+    0x001fb9622ed4abfcULL, 0x001fb8ca33174a18ULL, 0x001fb82b76765b54ULL,
+    0x001fb7859c5b895dULL, 0x001fb6d840d55594ULL, 0x001fb622f7d96943ULL,
+    0x001fb5654c6f37e2ULL, 0x001fb49ebfbf69d3ULL, 0x001fb3cec803e747ULL,
+    0x001fb2f4cf539c40ULL, 0x001fb21032442854ULL, 0x001fb1203e5a9605ULL,
+    0x001fb0243042e1c3ULL, 0x001faf1b31c479a7ULL, 0x001fae045767e106ULL,
+    0x001facde9dbf2d73ULL, 0x001faba8e640060bULL, 0x001faa61f399ff29ULL,
+    0x001fa908656f66a2ULL, 0x001fa79ab3508d3dULL, 0x001fa61726d1f213ULL,
+    0x001fa47bd48bea00ULL, 0x001fa2c693c5c095ULL, 0x001fa0f4f47df316ULL,
+    0x001f9f04336bbe0bULL, 0x001f9cf12b79f9bdULL, 0x001f9ab84415abc5ULL,
+    0x001f98555b782fb9ULL, 0x001f95c3abd03f7aULL, 0x001f92fda9cef1f3ULL,
+    0x001f8ffcda9ae41dULL, 0x001f8cb99e7385f8ULL, 0x001f892aec479608ULL,
+    0x001f8545f904db90ULL, 0x001f80fdc336039bULL, 0x001f7c427839e926ULL,
+    0x001f7700a3582aceULL, 0x001f71200f1a241dULL, 0x001f6a8234b7352cULL,
+    0x001f630000a8e267ULL, 0x001f5a66904fe3c6ULL, 0x001f50724ece1173ULL,
+    0x001f44c7665c6fdbULL, 0x001f36e5a38a59a4ULL, 0x001f261434503409ULL,
+    0x001f113e047b0414ULL, 0x001ef6aefa57cbe7ULL, 0x001ed38ca188151eULL,
+    0x001ea2a61e122db2ULL, 0x001e5961c78b267dULL, 0x001dddf62bac0bb1ULL,
+    0x001cdb4dd9e4e8c0ULL
+};
+
+static const double rk_zig_exp_w[256] = {
+    9.6557400632091849e-16, 7.0890142439558719e-18, 1.1639412496691561e-17,
+    1.5243915123532434e-17, 1.8332848857237673e-17, 2.1089651094645076e-17,
+    2.3611280778431579e-17, 2.5955957723109131e-17, 2.8161735541977702e-17,
+    3.0255041303213996e-17, 3.2255082548363913e-17, 3.4176323401850424e-17,
+    3.6029969787344679e-17, 3.7824907768696645e-17, 3.9568321980975674e-17,
+    4.1266117781759612e-17, 4.2923218084425386e-17, 4.454377743282385e-17,
+    4.6131339814832001e-17, 4.7688957252646501e-17, 4.9219280437279758e-17,
+    5.0724629045031587e-17, 5.2207047027926828e-17, 5.3668346617182039e-17,
+    5.5110143728351058e-17, 5.6533886732396782e-17, 5.7940880048527777e-17,
+    5.9332303652089529e-17, 6.0709229328471907e-17, 6.2072634311632033e-17,
+    6.3423412803030864e-17, 6.476238575956152e-17, 6.6090309257694151e-17,
+    6.7407881678727321e-17, 6.8715749911838235e-17, 7.0014514734039407e-17,
+    7.1304735496606533e-17, 7.2586934224146582e-17, 7.3861599213818006e-17,
+    7.5129188207237367e-17, 7.6390131195508344e-17, 7.7644832907978567e-17,
+    7.8893675027297992e-17, 8.0137018166754643e-17, 8.1375203640417721e-17,
+    8.2608555052100468e-17, 8.3837379725391492e-17, 8.5061969993853318e-17,
+    8.6282604367841216e-17, 8.7499548592161924e-17, 8.8713056606902621e-17,
+    8.9923371422153669e-17, 9.113072591597919e-17, 9.2335343563817968e-17,
+    9.3537439106491376e-17, 9.4737219163129594e-17, 9.5934882794580072e-17,
+    9.7130622022215311e-17, 9.83246223064952e-17, 9.9517062989150805e-17,
+    1.0070811770242958e-16, 1.0189795474846949e-16, 1.0308673745154228e-16,
+    1.0427462448561895e-16, 1.0546177017945773e-16, 1.0664832480119157e-16,
+    1.0783443482419495e-16, 1.0902024317583513e-16, 1.102058894705579e-16,
+    1.1139151022861982e-16, 1.1257723908165682e-16, 1.1376320696616852e-16,
+    1.1494954230590098e-16, 1.1613637118402188e-16, 1.1732381750590463e-16,
+    1.1851200315326702e-16, 1.1970104813034657e-16, 1.2089107070273863e-16,
+    1.2208218752947066e-16, 1.2327451378884157e-16, 1.244681632985113e-16,
+    1.256632486302899e-16, 1.2685988122003983e-16, 1.2805817147307501e-16,
+    1.29258228865412e-16, 1.3046016204120296e-16, 1.3166407890665733e-16,
+    1.3287008672073819e-16, 1.3407829218290004e-16, 1.3528880151811762e-16,
+    1.3650172055943985e-16, 1.3771715482828817e-16, 1.3893520961270644e-16,
+    1.401559900437572e-16, 1.4137960117024857e-16, 1.4260614803196659e-16,
+    1.4383573573157909e-16, 1.4506846950536884e-16, 1.4630445479294765e-16,
+    1.4754379730609524e-16, 1.4878660309686266e-16, 1.5003297862507374e-16,
+    1.5128303082535399e-16, 1.5253686717381263e-16, 1.5379459575449974e-16,
+    1.5505632532575776e-16, 1.563221653865838e-16, 1.5759222624311766e-16,
+    1.5886661907536844e-16, 1.601454560042917e-16, 1.6142885015932789e-16,
+    1.6271691574651307e-16, 1.6400976811727184e-16, 1.6530752383800374e-16,
+    1.6661030076057423e-16, 1.6791821809382291e-16, 1.6923139647620225e-16,
+    1.7054995804966301e-16, 1.7187402653490319e-16, 1.7320372730810086e-16,
+    1.7453918747925342e-16, 1.7588053597224916e-16, 1.7722790360680067e-16,
+    1.7858142318237329e-16, 1.799412295642464e-16, 1.8130745977185018e-16,
+    1.8268025306952525e-16, 1.8405975105985881e-16, 1.8544609777975697e-16,
+    1.8683943979941929e-16, 1.8823992632438923e-16, 1.896477093008617e-16,
+    1.9106294352443768e-16, 1.9248578675252443e-16, 1.9391639982058999e-16,
+    1.9535494676249096e-16, 1.9680159493510381e-16, 1.9825651514750198e-16,
+    1.9971988179493426e-16, 2.0119187299787352e-16, 2.026726707464199e-16,
+    2.0416246105035895e-16, 2.0566143409519184e-16, 2.0716978440447375e-16,
+    2.0868771100881602e-16, 2.1021541762192933e-16, 2.1175311282410764e-16,
+    2.1330101025357796e-16, 2.1485932880616636e-16, 2.1642829284376052e-16,
+    2.1800813241207843e-16, 2.195990834682871e-16, 2.2120138811904962e-16,
+    2.228152948696181e-16, 2.2444105888463086e-16, 2.2607894226131737e-16,
+    2.277292143158621e-16, 2.2939215188373114e-16, 2.3106803963482138e-16,
+    2.3275717040435351e-16, 2.3445984554049584e-16, 2.3617637526977745e-16,
+    2.3790707908142772e-16, 2.396522861318624e-16, 2.4141233567062933e-16,
+    2.431875774892256e-16, 2.4497837239430707e-16, 2.4678509270692892e-16,
+    2.4860812278958522e-16, 2.504478596029557e-16, 2.523047132944217e-16,
+    2.5417910782058122e-16, 2.5607148160617708e-16, 2.5798228824205309e-16,
+    2.5991199722497464e-16, 2.6186109474239242e-16, 2.6383008450549423e-16,
+    2.6581948863418446e-16, 2.6782984859795252e-16, 2.6986172621694889e-16,
+    2.7191570472798185e-16, 2.7399238992058148e-16, 2.7609241134876166e-16,
+    2.7821642362464361e-16, 2.8036510780069835e-16, 2.8253917284802532e-16,
+    2.8473935723881741e-16, 2.8696643064198177e-16, 2.8922119574179956e-16,
+    2.9150449019052932e-16, 2.9381718870700281e-16, 2.9616020533454652e-16,
+    2.9853449587300448e-16, 3.0094106050126176e-16, 3.0338094660850024e-16,
+    3.0585525185448599e-16, 3.0836512748153095e-16, 3.1091178190342659e-16,
+    3.1349648459966631e-16, 3.1612057034671057e-16, 3.1878544382197131e-16,
+    3.2149258462067974e-16, 3.2424355273094516e-16, 3.2703999451822404e-16,
+    3.2988364927722831e-16, 3.3277635641716714e-16, 3.3572006335532441e-16,
+    3.3871683420455047e-16, 3.4176885935256365e-16, 3.4487846604534239e-16,
+    3.4804813010374418e-16, 3.5128048892229789e-16, 3.5457835592247914e-16,
+    3.579447366604276e-16, 3.6138284682190601e-16, 3.6489613237645421e-16,
+    3.6848829220956203e-16, 3.7216330360802068e-16, 3.7592545104162555e-16,
+    3.7977935876688739e-16, 3.8373002787892132e-16, 3.8778287856078948e-16,
+    3.9194379843114284e-16, 3.9621919807867745e-16, 4.0061607510565417e-16,
+    4.0514208829565732e-16, 4.0980564389030625e-16, 4.1461599642909046e-16,
+    4.1958336720733989e-16, 4.247190841824385e-16, 4.3003574816674707e-16,
+    4.355474314693952e-16, 4.4126991690360704e-16, 4.4722098742599323e-16,
+    4.5342077985658345e-16, 4.5989222049059325e-16, 4.6666156647114758e-16,
+    4.737590853262492e-16, 4.8121991728292379e-16, 4.8908518273922099e-16,
+    4.9740342361919398e-16, 5.0623250721441597e-16, 5.156421828878083e-16,
+    5.2571758020222748e-16, 5.3656409771120206e-16, 5.4831440342587029e-16,
+    5.6113874546751586e-16, 5.7526064815033307e-16, 5.909817641652102e-16,
+    6.0872314161809077e-16, 6.290979034877557e-16, 6.5304920535640408e-16,
+    6.8213930790289286e-16, 7.1924449660893616e-16, 7.7060953500320968e-16,
+    8.5455170385840274e-16
+};
+
+static const double rk_zig_exp_f[256] = {
+    1, 0.93814368086217081, 0.90046992992574371,
+    0.87170433238120149, 0.84778550062398783, 0.82699329664304877,
+    0.80842165152300693, 0.79152763697249429, 0.77595685204011433,
+    0.76146338884989506, 0.74786862198519399, 0.73503809243142249,
+    0.72286765959357102, 0.71127476080507501, 0.70019265508278727,
+    0.6895664961170771, 0.67935057226476459, 0.66950631673192396,
+    0.66000084107899892, 0.65080583341457021, 0.64189671642726531,
+    0.6332519942143654, 0.62485273870366531, 0.61668218091520699,
+    0.60872538207962146, 0.60096896636523167, 0.59340090169173287,
+    0.58601031847726748, 0.57878735860284447, 0.57172304866482526,
+    0.56480919291239973, 0.558038282262587, 0.55140341654064084,
+    0.54489823767243917, 0.53851687200286136, 0.53225388026304277,
+    0.52610421398361928, 0.52006317736823315, 0.51412639381474812,
+    0.50828977641064244, 0.50254950184134728, 0.49690198724154916,
+    0.49134386959403215, 0.48587198734188453, 0.48048336393045382,
+    0.47517519303737699, 0.46994482528395959, 0.46478975625042579,
+    0.4597076156421373, 0.45469615747461511, 0.44975325116275461,
+    0.44487687341454812, 0.44006510084235351, 0.43531610321563624,
+    0.4306281372884585, 0.42599954114303401, 0.42142872899761624,
+    0.41691418643300254, 0.41245446599716085, 0.40804818315203206,
+    0.40369401253052994, 0.39939068447523074, 0.39513698183328982,
+    0.39093173698479677, 0.38677382908413738, 0.3826621814960095,
+    0.37859575940958051, 0.37457356761590188, 0.37059464843514572,
+    0.36665807978151388, 0.3627629733548175, 0.35890847294874956,
+    0.35509375286678729, 0.35131801643748317, 0.34758049462163682,
+    0.34388044470450224, 0.34021714906677986, 0.33658991402867738,
+    0.33299806876180876, 0.32944096426413616, 0.32591797239355602,
+    0.322428484956089, 0.31897191284495702, 0.31554768522712873,
+    0.31215524877417938, 0.30879406693455996, 0.30546361924459003,
+    0.30216340067569331, 0.29889292101558151, 0.29565170428126097,
+    0.29243928816189241, 0.28925522348967758, 0.28609907373707671,
+    0.28297041453878063, 0.27986883323697276, 0.27679392844851719,
+    0.2737453096528028, 0.27072259679905986, 0.26772541993204463,
+    0.26475341883506204, 0.26180624268936281, 0.25888354974901606,
+    0.25598500703041527, 0.25311029001562935, 0.25025908236886218,
+    0.24743107566532754, 0.24462596913189202, 0.24184346939887713,
+    0.23908329026244909, 0.23634515245705956, 0.23362878343743329,
+    0.23093391716962736, 0.22826029393071662, 0.22560766011668396,
+    0.22297576805812011, 0.22036437584335944, 0.21777324714870047,
+    0.21520215107537863, 0.21265086199297822, 0.21011915938898823,
+    0.20760682772422198, 0.20511365629383765, 0.20263943909370896,
+    0.20018397469191121, 0.19774706610509882, 0.19532852067956319,
+    0.1929281499767713, 0.19054576966319536, 0.18818119940425426,
+    0.18583426276219708, 0.18350478709776744, 0.18119260347549626,
+    0.17889754657247828, 0.17661945459049483, 0.17435816917135341,
+    0.17211353531531998, 0.16988540130252755, 0.16767361861725008,
+    0.16547804187493592, 0.16329852875190173, 0.16113493991759195,
+    0.15898713896931413, 0.15685499236936515, 0.15473836938446803,
+    0.1526371420274428, 0.15055118500103984, 0.14848037564386674,
+    0.14642459387834489, 0.14438372216063472, 0.14235764543247215,
+    0.1403462510748624, 0.13834942886358018, 0.13636707092642883,
+    0.1343990717022136, 0.13244532790138749, 0.13050573846833077,
+    0.1285802045452282, 0.12666862943751067, 0.12477091858083093,
+    0.12288697950954511, 0.12101672182667479, 0.11916005717532764,
+    0.11731689921155553, 0.11548716357863351, 0.11367076788274429,
+    0.11186763167005628, 0.11007767640518536, 0.10830082545103376,
+    0.10653700405000163, 0.10478613930657016, 0.1030481601712577,
+    0.10132299742595363, 0.099610583670637132, 0.097910853311492213,
+    0.096223742550432825, 0.094549189376055873, 0.092887133556043569,
+    0.091237516631040197, 0.089600281910032886, 0.087975374467270231,
+    0.086362741140756927, 0.084762330532368146, 0.083174093009632397,
+    0.081597980709237419, 0.080033947542319905, 0.078481949201606435,
+    0.076941943170480517, 0.07541388873405841, 0.073897746992364746,
+    0.072393480875708752, 0.070901055162371843, 0.069420436498728783,
+    0.067951593421936643, 0.066494496385339816, 0.065049117786753805,
+    0.063615431999807376, 0.062193415408541036, 0.06078304644547966,
+    0.05938430563342028, 0.057997175631200659, 0.05662164128374287,
+    0.05525768967669703, 0.05390531019604608, 0.052564494593071685,
+    0.051235237055126281, 0.049917534282706379, 0.048611385573379504,
+    0.047316792913181561, 0.046033761076175184, 0.044762297732943289,
+    0.043502413568888197, 0.042254122413316254, 0.04101744138041484,
+    0.039792391023374139, 0.038578995503074871, 0.037377282772959382,
+    0.036187284781931443, 0.035009037697397431, 0.033842582150874358,
+    0.032687963508959555, 0.031545232172893622, 0.030414443910466622,
+    0.029295660224637411, 0.028188948763978646, 0.027094383780955803,
+    0.026012046645134221, 0.024942026419731787, 0.023884420511558174,
+    0.02283933540638524, 0.021806887504283581, 0.020787204072578114,
+    0.01978042433800974, 0.018786700744696024, 0.017806200410911355,
+    0.016839106826039941, 0.015885621839973156, 0.014945968011691148,
+    0.014020391403181943, 0.013109164931254991, 0.012212592426255378,
+    0.0113310135978346, 0.010464810181029981, 0.0096144136425022116,
+    0.008780314985808977, 0.0079630774380170435, 0.0071633531836349908,
+    0.0063819059373191834, 0.0056196422072054891, 0.0048776559835423958,
+    0.004157295120833797, 0.003460264777836904, 0.0027887987935740757,
+    0.0021459677437189071, 0.0015362997803015726, 0.00096726928232717432,
+    0.0004541343538414966
+};
@@ -3,7 +3,7 @@ from __future__ import division, absolute_import, print_function
 import numpy as np
 from numpy.testing import (
         TestCase, run_module_suite, assert_, assert_raises, assert_equal,
-        assert_warns)
+        assert_warns, assert_allclose)
 from numpy import random
 from numpy.compat import asbytes
 import sys
@@ -128,6 +128,275 @@ class TestSetState(TestCase):
         # arguments without truncation.
         self.prng.negative_binomial(0.5, 0.5)
 
+
+class TestBitGenerators(TestCase):
+    brngs = ['MT19937', 'PCG64', 'xoroshiro128+', 'Philox4x32']
+
+    def test_random_sample(self):
+        desired = {
+            'MT19937': [0.19151945037889229, 0.62210877103983186,
+                        0.43772773900711448],
+            'PCG64': [0.88765704137664347, 0.72103345932775942,
+                      0.52006300075946277],
+            'xoroshiro128+': [0.81362821681320241, 0.21330282978002646,
+                              0.92312172125925696],
+            'Philox4x32': [0.89682275349511265, 0.2226468001144043,
+                           0.13956988831068873]}
+        for brng in self.brngs:
+            actual = random.RandomState(1234, brng).random_sample(3)
+            assert_equal(actual, desired[brng])
+            actual = random.RandomState(1234, brng.upper()).random_sample(3)
+            assert_equal(actual, desired[brng])
+
+    def test_get_set_state(self):
+        for brng in self.brngs[1:]:
+            prng = random.RandomState(1234, brng)
+            prng.standard_normal()
+            prng.randint(10, dtype=np.uint32)
+            state = prng.get_state()
+            assert_equal(state[0], brng)
+            old = prng.standard_normal(size=5)
+            other = random.RandomState(1234)
+            other.set_state(state)
+            assert_equal(other.standard_normal(size=5), old)
+            other.set_state(random.RandomState(1234).get_state())
+            assert_equal(other.get_state()[0], 'MT19937')
+
+    def test_pickle(self):
+        import pickle
+        for brng in self.brngs:
+            prng = random.RandomState(1234, brng)
+            prng.random_sample()
+            prng2 = pickle.loads(pickle.dumps(prng))
+            assert_equal(prng2.randint(2**30, size=10),
+                         prng.randint(2**30, size=10))
+
+    def test_invalid(self):
+        assert_raises(ValueError, random.RandomState, 1234, 'MT')
+        state = random.RandomState(1234, 'PCG64').get_state()
+        prng = random.RandomState(1234)
+        assert_raises(ValueError, prng.set_state, state[:3])
+        assert_raises(ValueError, prng.set_state,
+                      (state[0], state[1][:4]) + state[2:])
+
+class TestJump(TestCase):
+    brngs = ['MT19937', 'PCG64', 'xoroshiro128+', 'Philox4x32']
+
+    def test_jumped(self):
+        desired = {
+            'MT19937': [0.56361716955219776, 0.71063764760124504,
+                        0.21514543496313776],
+            'PCG64': [0.13831374630788285, 0.80024581506403836,
+                      0.56705236935136361],
+            'xoroshiro128+': [0.14083720439664815, 0.26735673847442321,
+                              0.50559720924967244],
+            'Philox4x32': [0.18778422367069814, 0.23889342138908887,
+                           0.34914368133109297]}
+        for brng in self.brngs:
+            prng = random.RandomState(1234, brng)
+            assert_equal(prng.jumped().random_sample(3), desired[brng])
+            # the original is left unchanged
+            assert_equal(prng.get_state()[1],
+                         random.RandomState(1234, brng).get_state()[1])
+            prng.random_sample(5)
+            assert_equal(prng.jumped(0).random_sample(5),
+                         prng.random_sample(5))
+            assert_equal(prng.jumped(2).random_sample(5),
+                         prng.jumped().jumped().random_sample(5))
+
+    def test_jump_commutes(self):
+        # jumping from part way through a block of output is the same as
+        # jumping first and drawing afterwards
+        for brng in self.brngs:
+            prng = random.RandomState(1234, brng)
+            other = prng.jumped()
+            for n in [1, 2, 311, 313]:
+                prng.random_sample(n)
+                other.random_sample(n)
+                assert_equal(prng.jumped().random_sample(5),
+                             other.random_sample(5))
+                prng.random_sample(5)
+
+    def test_spawn(self):
+        for brng in self.brngs:
+            prng = random.RandomState(1234, brng)
+            streams = prng.spawn(3)
+            assert_equal(len(streams), 3)
+            assert_equal(streams[0].random_sample(5),
+                         random.RandomState(1234, brng).random_sample(5))
+            assert_equal(streams[2].random_sample(5),
+                         random.RandomState(1234, brng).jumped(2)
+                         .random_sample(5))
+            # the parent moved past the spawned streams
+            assert_equal(prng.random_sample(5),
+                         random.RandomState(1234, brng).jumped(3)
+                         .random_sample(5))
+            assert_equal(prng.spawn(0), [])
+
+    def test_invalid(self):
+        prng = random.RandomState(1234)
+        assert_raises(ValueError, prng.jumped, -1)
+        assert_raises(ValueError, prng.spawn, -1)
+        assert_raises(TypeError, prng.jumped, 1.5)
+
+
+class TestZiggurat(TestCase):
+
+    def test_values(self):
+        desired = {
+            'MT19937': [[1.1832178296817082, 0.98790135758916786,
+                         -0.72994114267784549],
+                        [0.23547281855872654, 1.0866023278863732,
+                         1.0247552783585985],
+                        [4.416664930762682, 1.2600411212261051,
+                         2.9065824959416755],
+                        [0.036679699873432982, 0.19160557349628052,
+                         0.82889243095119403]],
+            'PCG64': [[0.04430150815830481, 1.9894875215655423,
+                       0.070223456286205188],
+                      [2.3868740016896095, 0.40313022928356301,
+                       1.3984284446482935],
+                      [2.2325331166270583, 2.2716852868413975,
+                       1.2067369781089936],
+                      [1.5538267886243833, 0.27089591962632897,
+                       0.18357150111901535]]}
+        for brng in desired:
+            def prng():
+                return random.RandomState(1234, brng, 'ziggurat')
+            normal, exponential, gamma, gamma_small = desired[brng]
+            assert_equal(prng().standard_normal(3), normal)
+            assert_allclose(prng().normal(2.0, 3.0, size=3),
+                            2.0 + 3.0*np.array(normal))
+            assert_equal(prng().standard_exponential(3), exponential)
+            assert_equal(prng().standard_gamma(2.5, 3), gamma)
+            assert_equal(prng().standard_gamma([0.5]*3), gamma_small)
+            assert_equal(prng().standard_gamma(1.0, 3), exponential)
+
+    def test_legacy(self):
+        # the default sampler keeps the original streams
+        for method in ['standard_normal', 'standard_exponential']:
+            assert_equal(
+                getattr(random.RandomState(1234), method)(5),
+                getattr(random.RandomState(1234, sampler='legacy'), method)(5))
+            assert_(np.all(
+                getattr(random.RandomState(1234), method)(5) !=
+                getattr(random.RandomState(1234, sampler='ziggurat'),
+                        method)(5)))
+
+    def test_moments(self):
+        prng = random.RandomState(1234, 'PCG64', 'ziggurat')
+        x = prng.standard_normal(100000)
+        assert_allclose([x.mean(), x.var()], [0, 1], atol=0.02)
+        assert_allclose(np.mean(np.abs(x) > 3), 0.0027, atol=0.001)
+        x = prng.standard_exponential(100000)
+        assert_allclose([x.mean(), x.var()], [1, 1], atol=0.03)
+        for shape in [0.3, 4.0]:
+            x = prng.standard_gamma(shape, 100000)
+            assert_allclose([x.mean(), x.var()], [shape, shape], rtol=0.05)
+
+    def test_pickle_and_jump(self):
+        import pickle
+        prng = random.RandomState(1234, 'xoroshiro128+', 'ziggurat')
+        prng.standard_normal()
+        ref = random.RandomState(0, 'xoroshiro128+', 'ziggurat')
+        ref.set_state(prng.get_state())
+        desired = ref.standard_normal(5)
+        for other in [pickle.loads(pickle.dumps(prng)), prng.jumped(0),
+                      prng.spawn(1)[0]]:
+            assert_equal(other.standard_normal(5), desired)
+
+    def test_invalid(self):
+        assert_raises(ValueError, random.RandomState, 1234, sampler='zig')
+
+
+class TestBulk(TestCase):
+    brngs = ['MT19937', 'PCG64', 'xoroshiro128+', 'Philox4x32']
+
+    def test_float32(self):
+        # single precision output is the double stream rounded, or for
+        # random_sample truncated to 24 bits
+        def single(method, x):
+            if method == 'random_sample':
+                x = np.floor(np.multiply(x, 2**24)) / 2**24
+            return np.asarray(x).astype(np.float32)
+
+        for brng in self.brngs:
+            for sampler in ['legacy', 'ziggurat']:
+                for method, args in [('random_sample', ()),
+                                     ('standard_normal', ()),
+                                     ('standard_exponential', ()),
+                                     ('standard_gamma', (0.5,)),
+                                     ('standard_gamma', (2.5,))]:
+                    prng = random.RandomState(1234, brng, sampler)
+                    ref = random.RandomState(1234, brng, sampler)
+                    func = getattr(prng, method)
+                    desired = getattr(ref, method)(*(args + (1001,)))
+                    actual = func(*(args + (1001,)), dtype=np.float32)
+                    assert_equal(actual.dtype, np.float32)
+                    assert_equal(actual, single(method, desired))
+                    x = func(*args, dtype=np.float32)
+                    assert_(isinstance(x, np.float32))
+                    desired = getattr(ref, method)(*args)
+                    assert_equal(x, single(method, desired))
+                    assert_equal(prng.random_sample(), ref.random_sample())
+
+    def test_float32_below_one(self):
+        # the last double drawn rounds to 1.0 in single precision
+        x = random.RandomState(48).random_sample(122691)
+        assert_equal(np.float32(x[-1]), 1.0)
+        x = random.RandomState(48).random_sample(122691, dtype=np.float32)
+        assert_(x.max() < 1.0)
+
+    def test_float32_invalid(self):
+        prng = random.RandomState(1234)
+        for dtype in [np.int32, np.float16, np.complex64, 'f8,f8']:
+            assert_raises(TypeError, prng.random_sample, 3, dtype=dtype)
+            assert_raises(TypeError, prng.standard_gamma, 1.0, dtype=dtype)
+
+    def test_strided_parameters(self):
+        # parameters which are neither contiguous nor scalars go through
+        # the iterators and must draw the same values
+        a = np.linspace(1, 5, 24).reshape(4, 6)
+        n = np.arange(1, 25).reshape(4, 6)
+        for method, args in [('chisquare', (a,)), ('poisson', (a,)),
+                             ('normal', (a, a)), ('normal', (a, 2.0)),
+                             ('gamma', (2.0, a)), ('binomial', (n, 0.3)),
+                             ('hypergeometric', (n, n, n)),
+                             ('triangular', (-a, 0.0, a))]:
+            for strided in [lambda x: x[:, ::2], lambda x: x.T]:
+                def view(x):
+                    return strided(x) if isinstance(x, np.ndarray) else x
+                sargs = tuple(view(x) for x in args)
+                cargs = tuple(np.ascontiguousarray(x) for x in sargs)
+                for size in [None, (3,) + np.broadcast(0, *sargs).shape]:
+                    desired = getattr(random.RandomState(1234), method)(
+                        *cargs, size=size)
+                    actual = getattr(random.RandomState(1234), method)(
+                        *sargs, size=size)
+                    assert_equal(actual, desired)
+
+    def test_array_parameters(self):
+        # array parameters are filled in blocks and must draw the same
+        # values as one call per element
+        a = np.linspace(1, 5, 1000)
+        for method, args in [('uniform', (a, 2 * a)), ('normal', (a, 2.0)),
+                             ('exponential', (a,)), ('lognormal', (0.0, a)),
+                             ('gamma', (a, a)), ('triangular', (-a, 0.0, a))]:
+            for sampler in ['legacy', 'ziggurat']:
+                for view in [lambda x: x, lambda x: x[::2],
+                             lambda x: x[:600].reshape(20, 30).T]:
+                    vargs = tuple(view(x) if isinstance(x, np.ndarray)
+                                  else x for x in args)
+                    ref = getattr(random.RandomState(1234, sampler=sampler),
+                                  method)
+                    bargs = np.broadcast_arrays(*vargs)
+                    desired = [ref(*[float(x.flat[i]) for x in bargs])
+                               for i in range(bargs[0].size)]
+                    prng = random.RandomState(1234, sampler=sampler)
+                    actual = getattr(prng, method)(*vargs)
+                    assert_equal(actual.ravel(), desired)
+
+
 class TestRandint(TestCase):
 
     rfunc = np.random.randint